@@ -40,6 +40,7 @@
 #define MAX_NAMES_SIZE 24
 #define MAX_ATTID_SIZE 24
 #define MAX_PV_SIZE 4
+#define MAX_BATCH_SIZE 3
 
 /* Unit tests on the sphere_ml mesh and model in the test directory */
 static int
@@ -89,6 +90,14 @@ static int projectToMeshTopoGeometry(
         const char *expectedProjectionEntityName,
         const char *msgLead);
 
+/* Batch point projection compared against single point projection */
+static int checkProjectPoints(
+        GeometryKernelObj geom_kernel,
+        GeometryGroupObj geom_group,
+        const MLREAL *points,
+        MLINT numPoints,
+        const char *msgLead);
+
 static MLREAL
 distBetweenPoints(MLVector3D pt1, MLVector3D pt2)
 {
@@ -379,6 +388,21 @@ int projectToMeshTopoGeometry(
             }
 
             ML_freeProjectionDataObj(&projectionData);
+
+            {
+                /* batch of the point, its projection and their mid-point */
+                MLREAL points[9];
+                int n;
+                for (n = 0; n < 3; ++n) {
+                    points[n] = point[n];
+                    points[3 + n] = projectedPt[n];
+                    points[6 + n] = 0.5 * (point[n] + projectedPt[n]);
+                }
+                if (0 != checkProjectPoints(geom_kernel, geom_group,
+                    points, 3, msgLead)) {
+                    return 1;
+                }
+            }
         }
         else {
             printf("%s: missing Geometry Group\n", msgLead);
@@ -390,6 +414,86 @@ int projectToMeshTopoGeometry(
     return status;
 }
 
+/* Batch point projection compared against single point projection */
+int checkProjectPoints(
+    GeometryKernelObj geom_kernel,
+    GeometryGroupObj geom_group,
+    const MLREAL *points,
+    MLINT numPoints,
+    const char *msgLead
+)
+{
+    MLREAL tol = 1e-5;
+    MLREAL xyz[3 * MAX_BATCH_SIZE];
+    MLREAL UV[2 * MAX_BATCH_SIZE];
+    MLREAL distance[MAX_BATCH_SIZE];
+    MLREAL tolerance[MAX_BATCH_SIZE];
+    char entityNames[MAX_BATCH_SIZE * MAX_STRING_SIZE];
+    MLINT pointStatus[MAX_BATCH_SIZE];
+    MLINT i;
+
+    if (numPoints > MAX_BATCH_SIZE) {
+        printf("%s: batch too large\n", msgLead);
+        return 1;
+    }
+
+    if (ML_STATUS_OK != ML_projectPoints(geom_kernel, geom_group,
+        points, numPoints, xyz, UV, distance, tolerance,
+        entityNames, MAX_STRING_SIZE, pointStatus)) {
+        printf("%s: batch point projection failed\n", msgLead);
+        return 1;
+    }
+
+    for (i = 0; i < numPoints; ++i) {
+        ProjectionDataObj projectionData = NULL;
+        MLVector3D point;
+        MLVector3D projectedPt;
+        MLVector2D projectedUV;
+        MLREAL projDist;
+        MLREAL projTol;
+        char entity_name[MAX_STRING_SIZE];
+        int n;
+
+        if (ML_STATUS_OK != pointStatus[i]) {
+            printf("%s: batch point %" MLINT_FORMAT " failed\n", msgLead, i);
+            return 1;
+        }
+
+        VEC_SET(point, (&points[3 * i]));
+        ML_createProjectionDataObj(geom_kernel, &projectionData);
+        if (0 != ML_projectPoint(
+            geom_kernel, geom_group, point, projectionData) ||
+            0 != ML_getProjectionInfo(geom_kernel, projectionData,
+                projectedPt, projectedUV, entity_name, MAX_STRING_SIZE,
+                &projDist, &projTol)) {
+            printf("%s: Point projection failed\n", msgLead);
+            ML_freeProjectionDataObj(&projectionData);
+            return 1;
+        }
+        ML_freeProjectionDataObj(&projectionData);
+
+        if (distBetweenPoints(&xyz[3 * i], projectedPt) > tol) {
+            printf("%s: bad batch point projection\n", msgLead);
+            return 1;
+        }
+        for (n = 0; n < 2; ++n) {
+            if (fabs(UV[2 * i + n] - projectedUV[n]) > tol) {
+                printf("%s: bad batch projection UV\n", msgLead);
+                return 1;
+            }
+        }
+        if (fabs(distance[i] - projDist) > tol) {
+            printf("%s: bad batch projection distance\n", msgLead);
+            return 1;
+        }
+        if (0 != strcmp(&entityNames[MAX_STRING_SIZE * i], entity_name)) {
+            printf("%s: bad batch projection entity\n", msgLead);
+            return 1;
+        }
+    }
+    return 0;
+}
+
 /*===============================================================================================
 * MESH POINT Test (lowest topological match for point index )
 */
@@ -28,14 +28,20 @@
 #include "MeshAssociativity.h"
 
 #if defined(HAVE_XERCES)
+#include "MeshLinkAsyncWriter.h"
+#include "MeshLinkBinary.h"
+#include "MeshLinkOutput.h"
 #include "MeshLinkParser_xerces.h"
+#include "MeshLinkStreamWriter.h"
 #include "MeshLinkWriter_xerces.h"
 #endif
 
+#include <ctype.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <cmath>
+#include <vector>
 
 
 // Test the mesh-geometry associativity in sphere_ml.xml
@@ -60,6 +66,15 @@ static int projectToMeshTopoGeometry(
     const char *msgLead
 );
 
+// Batch point projection compared against single point projection
+static int checkProjectPoints(
+    GeometryKernel *geom_kernel,
+    GeometryGroup *geom_group,
+    const MLREAL *points,
+    MLINT numPoints,
+    const char *msgLead
+);
+
 // Evaluation of parametric coordinates
 static int evaluateParamPoint(
     MeshAssociativity &meshAssoc,
@@ -82,6 +97,45 @@ static int interpolateFaceMidPoint(
     MeshFace *face,
     MLVector3D expectedInterpolatedPoint);
 
+#if defined(HAVE_XERCES)
+// Write a MeshLink file, read it back and compare it with the original
+static int roundTripMeshLinkFile(
+    MeshAssociativity &meshAssoc,
+    MeshLinkWriter &writer,
+    const std::string &fname);
+
+// Compare the mesh faces and edges of two MeshAssociativity objects
+static int compareMeshAssociativity(
+    MeshAssociativity &expected,
+    MeshAssociativity &actual,
+    const char *msgLead);
+
+// Read a MeshLink file with the DOM and SAX parsers and compare the results
+static int compareParsers(const std::string &fname);
+
+// Compare two XML files, ignoring insignificant whitespace
+static int compareXmlFiles(
+    const std::string &fname1,
+    const std::string &fname2);
+
+// Compare a database read from two copies of a MeshLink file with one
+// read from a single copy
+static int checkMergedCopies(
+    MeshAssociativity &single,
+    MeshAssociativity &merged);
+
+// Check the database extracted for one partition of the mesh points
+static int checkPartition(
+    MeshAssociativity &meshAssoc,
+    const std::vector<MLINT> &pointPartition,
+    MLINT part,
+    MeshAssociativity &partAssoc,
+    const std::vector<MLINT> &localToGlobal);
+
+// Read a MeshLink file with model, sheet and string load filters
+static int checkLoadFilters(const std::string &fname);
+#endif
+
 //===============================================================================
 // MAIN routine
 int main(int argc, char** argv)
@@ -186,6 +240,243 @@ int main(int argc, char** argv)
             return (-1);
         }
     }
+#if defined(IS64BIT)
+    // Write a face with 64-bit point indices; the base64 index array
+    // of its sheet is written 64 bits wide
+    {
+        std::vector<MeshModel *> models;
+        meshAssoc->getMeshModels(models);
+        MeshModel *model = NULL;
+        MeshSheet *sheet = NULL;
+        std::vector<const MeshFace *> faces;
+        for (size_t i = 0; i < models.size() && NULL == sheet; ++i) {
+            std::vector<MeshSheet *> sheets;
+            models[i]->getMeshSheets(sheets);
+            for (size_t j = 0; j < sheets.size() && NULL == sheet; ++j) {
+                sheets[j]->getMeshFaces(faces);
+                if (!faces.empty()) {
+                    model = models[i];
+                    sheet = sheets[j];
+                }
+            }
+        }
+        if (NULL != sheet) {
+            // stored in the model and the sheet, as when read; the
+            // faces of a sheet are written with the first face's IDs
+            const MLINT wide = (MLINT)1 << 33;
+            MLINT mid = faces[0]->getID();
+            MLINT aref = faces[0]->getAref();
+            MLINT gref = faces[0]->getGref();
+            std::string name;
+            if (!model->addFace(wide, wide + 1, wide + 2, mid, aref, gref,
+                    name, NULL, NULL, NULL, true) ||
+                    !sheet->addFace(wide, wide + 1, wide + 2, mid, aref, gref,
+                    name, NULL, NULL, NULL, true)) {
+                printf("Error adding 64-bit mesh face\n");
+                return (-1);
+            }
+        }
+
+        MeshLinkWriterXerces writer;
+        writer.setMeshLinkAttributes(xmlns, xmlns_xsi, schemaLocation);
+        if (0 != roundTripMeshLinkFile(*meshAssoc, writer,
+                std::string("wide_") + meshlink_fname)) {
+            printf("Error in 64-bit base64 round trip\n");
+            return (-1);
+        }
+    }
+#endif
+    // Write the packed binary arrays with each available codec
+    {
+        const MeshLinkCompression::Codec codecs[] = {
+            MeshLinkCompression::CodecNone,
+            MeshLinkCompression::CodecLZW,
+            MeshLinkCompression::CodecDeflate
+        };
+        const char *codecNames[] = { "none", "lzw", "deflate" };
+        for (int i = 0; i < 3; ++i) {
+            if (!MeshLinkCompression::isAvailable(codecs[i])) {
+                continue;
+            }
+            MeshLinkWriterXerces writer;
+            writer.setMeshLinkAttributes(xmlns, xmlns_xsi, schemaLocation);
+            if (!writer.setCompressionCodec(codecs[i]) ||
+                    0 != roundTripMeshLinkFile(*meshAssoc, writer,
+                    std::string(codecNames[i]) + "_" + meshlink_fname)) {
+                printf("Error in %s compression round trip\n", codecNames[i]);
+                return (-1);
+            }
+        }
+    }
+    // Write and load the binary container
+    {
+        MeshLinkBinaryWriter writer(xmlns, xmlns_xsi, schemaLocation);
+        std::string mlb_fname =
+            meshlink_fname.substr(0, meshlink_fname.find_last_of('.')) + ".mlb";
+        if (0 != roundTripMeshLinkFile(*meshAssoc, writer, mlb_fname)) {
+            printf("Error in binary container round trip\n");
+            return (-1);
+        }
+    }
+    // Write and read gzip-compressed files
+    if (MeshLinkGzipSink::isAvailable()) {
+        MeshLinkWriterXerces domWriter;
+        domWriter.setMeshLinkAttributes(xmlns, xmlns_xsi, schemaLocation);
+        MeshLinkStreamWriter streamWriter(xmlns, xmlns_xsi, schemaLocation);
+        if (0 != roundTripMeshLinkFile(*meshAssoc, domWriter,
+                    std::string("dom_") + meshlink_fname + ".gz") ||
+                0 != roundTripMeshLinkFile(*meshAssoc, streamWriter,
+                    std::string("stream_") + meshlink_fname + ".gz")) {
+            printf("Error in gzip round trip\n");
+            return (-1);
+        }
+    }
+    // Read each test file with the DOM and SAX parsers
+    {
+        const char *testFiles[] = {
+            "hemi_cyl.xml",
+            "om6.xml",
+            "oneraM6.xml",
+            "periodic_translation.xml",
+            "sphere_ml.xml",
+            "sphere_str_refine.xml"
+        };
+        for (size_t i = 0; i < sizeof(testFiles) / sizeof(testFiles[0]); ++i) {
+            if (0 != compareParsers(testFiles[i])) {
+                printf("Error comparing DOM and SAX parsers\n");
+                return (-1);
+            }
+        }
+    }
+    // Write with the DOM and stream writers; the files may differ
+    // only in whitespace
+    {
+        MeshLinkWriterXerces domWriter;
+        domWriter.setMeshLinkAttributes(xmlns, xmlns_xsi, schemaLocation);
+        MeshLinkStreamWriter streamWriter(xmlns, xmlns_xsi, schemaLocation);
+        std::string dom_fname = std::string("dom_") + meshlink_fname;
+        std::string stream_fname = std::string("stream_") + meshlink_fname;
+        printf("\nWriting %s and %s...\n\n", dom_fname.c_str(),
+            stream_fname.c_str());
+        if (!domWriter.writeMeshLinkFile(dom_fname, meshAssoc, true) ||
+                !streamWriter.writeMeshLinkFile(stream_fname, meshAssoc, true) ||
+                0 != compareXmlFiles(dom_fname, stream_fname)) {
+            printf("Error comparing DOM and stream writers\n");
+            return (-1);
+        }
+    }
+    // Read two copies of a file into one database
+    {
+        MeshAssociativity single;
+        MeshLinkParserXerces parser;
+        printf("\nParsing %s...\n\n", meshlink_fname.c_str());
+        if (!parser.parseMeshLinkFile(meshlink_fname, &single)) {
+            printf("Error parsing geometry-mesh associativity\n");
+            return (-1);
+        }
+
+        MeshAssociativity merged;
+        MeshLinkParserXerces filesParser;
+        std::vector<std::string> fnames(2, meshlink_fname);
+        printf("\nParsing two copies of %s...\n\n", meshlink_fname.c_str());
+        if (!filesParser.parseMeshLinkFiles(fnames, &merged) ||
+                0 != checkMergedCopies(single, merged)) {
+            printf("Error merging geometry-mesh associativity\n");
+            return (-1);
+        }
+    }
+    // Extract two partitions, splitting the points at the middle index
+    {
+        MeshAssociativity assoc;
+        MeshLinkParserXerces parser;
+        printf("\nParsing %s...\n\n", meshlink_fname.c_str());
+        if (!parser.parseMeshLinkFile(meshlink_fname, &assoc)) {
+            printf("Error parsing geometry-mesh associativity\n");
+            return (-1);
+        }
+        MLINT minIndex, maxIndex;
+        if (!assoc.getPointIndexRange(&minIndex, &maxIndex)) {
+            printf("Error getting point index range\n");
+            return (-1);
+        }
+        std::vector<MLINT> pointPartition((size_t)maxIndex + 1, -1);
+        for (MLINT n = minIndex; n <= maxIndex; ++n) {
+            pointPartition[n] = (n <= (minIndex + maxIndex) / 2) ? 0 : 1;
+        }
+
+        std::vector<MeshAssociativity *> parts;
+        std::vector<std::vector<MLINT> > localToGlobal;
+        int partRet = 0;
+        if (!assoc.extractPartitions(pointPartition, 2, parts, &localToGlobal)) {
+            partRet = 1;
+        }
+        for (size_t part = 0; 0 == partRet && part < parts.size(); ++part) {
+            partRet = checkPartition(assoc, pointPartition, (MLINT)part,
+                *parts[part], localToGlobal[part]);
+        }
+        for (size_t part = 0; part < parts.size(); ++part) {
+            delete parts[part];
+        }
+        if (0 != partRet) {
+            printf("Error extracting partitions\n");
+            return (-1);
+        }
+    }
+    // Read with load filters
+    if (0 != checkLoadFilters(meshlink_fname)) {
+        printf("Error reading with load filters\n");
+        return (-1);
+    }
+    // Write in the background, modifying the database once the write has
+    // started; the file holds the data as it was when the write started
+    {
+        MeshAssociativity assoc;
+        MeshAssociativity expected;
+        MeshLinkParserXerces parser;
+        MeshLinkParserXerces expectedParser;
+        printf("\nParsing %s...\n\n", meshlink_fname.c_str());
+        if (!parser.parseMeshLinkFile(meshlink_fname, &assoc) ||
+                !expectedParser.parseMeshLinkFile(meshlink_fname, &expected)) {
+            printf("Error parsing geometry-mesh associativity\n");
+            return (-1);
+        }
+
+        MeshLinkStreamWriter writer(xmlns, xmlns_xsi, schemaLocation);
+        MeshLinkAsyncWriter asyncWriter(writer);
+        std::string async_fname = std::string("async_") + meshlink_fname;
+        printf("\nWriting %s...\n\n", async_fname.c_str());
+        if (!asyncWriter.start(async_fname, &assoc, true)) {
+            printf("Error starting background write\n");
+            return (-1);
+        }
+
+        std::vector<MeshModel *> models;
+        assoc.getMeshModels(models);
+        MLINT minIndex, maxIndex;
+        if (!models.empty() && assoc.getPointIndexRange(&minIndex, &maxIndex)) {
+            std::string name;
+            if (!models[0]->addEdge(maxIndex + 1, maxIndex + 2,
+                    MESH_TOPO_INVALID_REF, MESH_TOPO_INVALID_REF,
+                    MESH_TOPO_INVALID_REF, name, NULL, NULL, false)) {
+                printf("Error adding mesh edge\n");
+                return (-1);
+            }
+        }
+
+        MeshAssociativity readAssoc;
+        MeshLinkParserXerces readParser;
+        if (!asyncWriter.wait()) {
+            printf("Error writing %s\n", async_fname.c_str());
+            return (-1);
+        }
+        printf("\nParsing %s...\n\n", async_fname.c_str());
+        if (!readParser.parseMeshLinkFile(async_fname, &readAssoc) ||
+                0 != compareMeshAssociativity(expected, readAssoc,
+                    async_fname.c_str())) {
+            printf("Error in background write\n");
+            return (-1);
+        }
+    }
 #else
     printf("Error parsing geometry-mesh associativity\n");
     return (-1);
@@ -195,6 +486,586 @@ int main(int argc, char** argv)
 }
 
 
+#if defined(HAVE_XERCES)
+/***********************************************************
+*  roundTripMeshLinkFile
+*
+*  Write a MeshLink file, read it back into a new
+*  MeshAssociativity and compare it with the original
+*/
+int
+roundTripMeshLinkFile(
+    MeshAssociativity &meshAssoc,
+    MeshLinkWriter &writer,
+    const std::string &fname)
+{
+    printf("\nWriting %s...\n\n", fname.c_str());
+    if (!writer.writeMeshLinkFile(fname, &meshAssoc, true)) {
+        printf("Error writing %s\n", fname.c_str());
+        return 1;
+    }
+
+    MeshAssociativity readAssoc;
+    MeshLinkParserXerces parser;
+    printf("\nParsing %s...\n\n", fname.c_str());
+    if (!parser.parseMeshLinkFile(fname, &readAssoc)) {
+        printf("Error parsing %s\n", fname.c_str());
+        return 1;
+    }
+    return compareMeshAssociativity(meshAssoc, readAssoc, fname.c_str());
+}
+
+
+/***********************************************************
+*  compareMeshAssociativity
+*
+*  Every mesh face and edge of expected must be in actual,
+*  with the same ID and references (unnamed entities are
+*  named anew when read)
+*/
+int
+compareMeshAssociativity(
+    MeshAssociativity &expected,
+    MeshAssociativity &actual,
+    const char *msgLead)
+{
+    std::vector<MeshModel *> models;
+    expected.getMeshModels(models);
+    if (models.size() != actual.getMeshModelCount()) {
+        printf("%s: bad mesh model count\n", msgLead);
+        return 1;
+    }
+
+    for (size_t i = 0; i < models.size(); ++i) {
+        MeshModel *model = models[i];
+        MeshModel *actualModel =
+            actual.getMeshModelByRef(model->getRef().c_str());
+        if (NULL == actualModel) {
+            printf("%s: missing mesh model %s\n", msgLead,
+                model->getRef().c_str());
+            return 1;
+        }
+        if (model->getNumFaces() != actualModel->getNumFaces() ||
+                model->getNumEdges() != actualModel->getNumEdges()) {
+            printf("%s: bad mesh face or edge count in %s\n", msgLead,
+                model->getRef().c_str());
+            return 1;
+        }
+
+        std::vector<const MeshFace *> faces;
+        model->getMeshFaces(faces);
+        for (size_t n = 0; n < faces.size(); ++n) {
+            MLINT inds[4] = { MESH_TOPO_INDEX_UNUSED, MESH_TOPO_INDEX_UNUSED,
+                MESH_TOPO_INDEX_UNUSED, MESH_TOPO_INDEX_UNUSED };
+            MLINT numInds = 0;
+            faces[n]->getInds(inds, &numInds);
+            // faces defined by reference have no indices
+            const MeshFace *face = (0 == numInds) ?
+                actualModel->getMeshFaceByRef(faces[n]->getRef()) :
+                actualModel->findFaceByInds(inds[0], inds[1], inds[2], inds[3]);
+            if (NULL == face ||
+                    face->getID() != faces[n]->getID() ||
+                    face->getAref() != faces[n]->getAref() ||
+                    face->getGref() != faces[n]->getGref()) {
+                printf("%s: bad mesh face %" MLINT_FORMAT "\n", msgLead,
+                    faces[n]->getID());
+                return 1;
+            }
+        }
+
+        std::vector<const MeshEdge *> edges;
+        model->getMeshEdges(edges);
+        for (size_t n = 0; n < edges.size(); ++n) {
+            MLINT inds[2] = { MESH_TOPO_INDEX_UNUSED, MESH_TOPO_INDEX_UNUSED };
+            MLINT numInds = 0;
+            edges[n]->getInds(inds, &numInds);
+            const MeshEdge *edge = (0 == numInds) ?
+                actualModel->getMeshEdgeByRef(edges[n]->getRef()) :
+                actualModel->findEdgeByInds(inds[0], inds[1]);
+            if (NULL == edge ||
+                    edge->getID() != edges[n]->getID() ||
+                    edge->getAref() != edges[n]->getAref() ||
+                    edge->getGref() != edges[n]->getGref()) {
+                printf("%s: bad mesh edge %" MLINT_FORMAT "\n", msgLead,
+                    edges[n]->getID());
+                return 1;
+            }
+        }
+    }
+    return 0;
+}
+
+
+/***********************************************************
+*  compareParsers
+*
+*  Read a MeshLink file with the DOM and SAX parsers; the
+*  databases must hold the same items
+*/
+int
+compareParsers(const std::string &fname)
+{
+    MeshAssociativity domAssoc;
+    MeshLinkParserXerces domParser;
+    printf("\nParsing %s (DOM)...\n\n", fname.c_str());
+    if (!domParser.parseMeshLinkFile(fname, &domAssoc)) {
+        printf("Error parsing %s\n", fname.c_str());
+        return 1;
+    }
+
+    MeshAssociativity saxAssoc;
+    MeshLinkParserXercesSAX saxParser;
+    printf("\nParsing %s (SAX)...\n\n", fname.c_str());
+    if (!saxParser.parseMeshLinkFile(fname, &saxAssoc)) {
+        printf("Error parsing %s\n", fname.c_str());
+        return 1;
+    }
+
+    if (domAssoc.getGeometryGroupCount() != saxAssoc.getGeometryGroupCount() ||
+            domAssoc.getAttributes().size() != saxAssoc.getAttributes().size() ||
+            domAssoc.getTransformCount() != saxAssoc.getTransformCount() ||
+            domAssoc.getMeshElementLinkageCount() !=
+                saxAssoc.getMeshElementLinkageCount()) {
+        printf("%s: bad group, attribute, transform or linkage count\n",
+            fname.c_str());
+        return 1;
+    }
+
+    std::vector<MeshModel *> models;
+    domAssoc.getMeshModels(models);
+    for (size_t i = 0; i < models.size(); ++i) {
+        MeshModel *saxModel =
+            saxAssoc.getMeshModelByRef(models[i]->getRef().c_str());
+        if (NULL != saxModel && (
+                models[i]->getMeshSheetCount() != saxModel->getMeshSheetCount() ||
+                models[i]->getMeshStringCount() != saxModel->getMeshStringCount())) {
+            printf("%s: bad mesh sheet or string count in %s\n", fname.c_str(),
+                models[i]->getRef().c_str());
+            return 1;
+        }
+    }
+    return compareMeshAssociativity(domAssoc, saxAssoc, fname.c_str());
+}
+
+
+/***********************************************************
+*  readXmlText
+*
+*  Read an XML file, dropping whitespace next to markup and
+*  collapsing other runs of whitespace to one space
+*/
+static bool
+readXmlText(const std::string &fname, std::string &text)
+{
+    FILE *fp = fopen(fname.c_str(), "rb");
+    if (NULL == fp) {
+        return false;
+    }
+    std::string raw;
+    char buf[65536];
+    size_t len;
+    while ((len = fread(buf, 1, sizeof(buf), fp)) > 0) {
+        raw.append(buf, len);
+    }
+    fclose(fp);
+
+    text.clear();
+    size_t i = 0;
+    while (i < raw.size()) {
+        if (!isspace((unsigned char)raw[i])) {
+            text += raw[i++];
+            continue;
+        }
+        while (i < raw.size() && isspace((unsigned char)raw[i])) {
+            ++i;
+        }
+        if (!text.empty() && '>' != text[text.size() - 1] &&
+                i < raw.size() && '<' != raw[i]) {
+            text += ' ';
+        }
+    }
+    return true;
+}
+
+
+/***********************************************************
+*  compareXmlFiles
+*
+*  Two XML files must match except for insignificant
+*  whitespace
+*/
+int
+compareXmlFiles(
+    const std::string &fname1,
+    const std::string &fname2)
+{
+    std::string text1;
+    std::string text2;
+    if (!readXmlText(fname1, text1) || !readXmlText(fname2, text2)) {
+        printf("Error reading %s or %s\n", fname1.c_str(), fname2.c_str());
+        return 1;
+    }
+    if (text1 != text2) {
+        size_t n = 0;
+        while (n < text1.size() && n < text2.size() && text1[n] == text2[n]) {
+            ++n;
+        }
+        printf("%s and %s differ at character %lu\n", fname1.c_str(),
+            fname2.c_str(), (unsigned long)n);
+        return 1;
+    }
+    return 0;
+}
+
+
+/***********************************************************
+*  checkMergedCopies
+*
+*  The point indices of the second copy must follow those
+*  of the first, its groups, attributes and transforms must
+*  be shared with the first, and each mesh face and edge
+*  must be present at both sets of point indices
+*/
+int
+checkMergedCopies(
+    MeshAssociativity &single,
+    MeshAssociativity &merged)
+{
+    MLINT minIndex, maxIndex;
+    MLINT mergedMin, mergedMax;
+    if (!single.getPointIndexRange(&minIndex, &maxIndex) ||
+            !merged.getPointIndexRange(&mergedMin, &mergedMax)) {
+        printf("merged copies: no point indices\n");
+        return 1;
+    }
+    const MLINT offset = maxIndex + 1 - minIndex;
+    if (mergedMin != minIndex || mergedMax != maxIndex + offset) {
+        printf("merged copies: bad point index range\n");
+        return 1;
+    }
+
+    if (merged.getGeometryGroupCount() != single.getGeometryGroupCount() ||
+            merged.getAttributes().size() != single.getAttributes().size() ||
+            merged.getTransformCount() != single.getTransformCount()) {
+        printf("merged copies: groups, attributes or transforms not shared\n");
+        return 1;
+    }
+
+    std::vector<MeshModel *> models;
+    single.getMeshModels(models);
+    if (models.size() != merged.getMeshModelCount()) {
+        printf("merged copies: bad mesh model count\n");
+        return 1;
+    }
+    for (size_t i = 0; i < models.size(); ++i) {
+        MeshModel *model = models[i];
+        MeshModel *mergedModel =
+            merged.getMeshModelByRef(model->getRef().c_str());
+        if (NULL == mergedModel) {
+            printf("merged copies: missing mesh model %s\n",
+                model->getRef().c_str());
+            return 1;
+        }
+
+        std::vector<const MeshFace *> faces;
+        model->getMeshFaces(faces);
+        for (size_t n = 0; n < faces.size(); ++n) {
+            MLINT inds[4] = { MESH_TOPO_INDEX_UNUSED, MESH_TOPO_INDEX_UNUSED,
+                MESH_TOPO_INDEX_UNUSED, MESH_TOPO_INDEX_UNUSED };
+            MLINT numInds = 0;
+            faces[n]->getInds(inds, &numInds);
+            if (0 == numInds) {
+                continue;
+            }
+            for (int copy = 0; copy < 2; ++copy) {
+                const MeshFace *face = mergedModel->findFaceByInds(
+                    inds[0], inds[1], inds[2], inds[3]);
+                if (NULL == face ||
+                        face->getAref() != faces[n]->getAref() ||
+                        face->getGref() != faces[n]->getGref()) {
+                    printf("merged copies: bad mesh face %" MLINT_FORMAT "\n",
+                        faces[n]->getID());
+                    return 1;
+                }
+                for (MLINT k = 0; k < numInds; ++k) {
+                    inds[k] += offset;
+                }
+            }
+        }
+
+        std::vector<const MeshEdge *> edges;
+        model->getMeshEdges(edges);
+        for (size_t n = 0; n < edges.size(); ++n) {
+            MLINT inds[2] = { MESH_TOPO_INDEX_UNUSED, MESH_TOPO_INDEX_UNUSED };
+            MLINT numInds = 0;
+            edges[n]->getInds(inds, &numInds);
+            if (0 == numInds) {
+                continue;
+            }
+            for (int copy = 0; copy < 2; ++copy) {
+                const MeshEdge *edge =
+                    mergedModel->findEdgeByInds(inds[0], inds[1]);
+                if (NULL == edge ||
+                        edge->getAref() != edges[n]->getAref() ||
+                        edge->getGref() != edges[n]->getGref()) {
+                    printf("merged copies: bad mesh edge %" MLINT_FORMAT "\n",
+                        edges[n]->getID());
+                    return 1;
+                }
+                inds[0] += offset;
+                inds[1] += offset;
+            }
+        }
+    }
+    return 0;
+}
+
+
+/***********************************************************
+*  checkPartition
+*
+*  The points owned by the partition must be numbered first,
+*  in global order. Exactly the sheets and strings with an
+*  element using an owned point must be extracted, and each
+*  extracted element must use an owned point and match an
+*  element of the original at the global point indices.
+*/
+int
+checkPartition(
+    MeshAssociativity &meshAssoc,
+    const std::vector<MLINT> &pointPartition,
+    MLINT part,
+    MeshAssociativity &partAssoc,
+    const std::vector<MLINT> &localToGlobal)
+{
+    MLINT numOwned = 0;
+    for (size_t n = 0; n < pointPartition.size(); ++n) {
+        if (part != pointPartition[n]) {
+            continue;
+        }
+        if (numOwned >= (MLINT)localToGlobal.size() ||
+                localToGlobal[numOwned] != (MLINT)n) {
+            printf("partition %" MLINT_FORMAT ": bad owned point numbering\n",
+                part);
+            return 1;
+        }
+        ++numOwned;
+    }
+
+    std::vector<MeshModel *> models;
+    meshAssoc.getMeshModels(models);
+    for (size_t i = 0; i < models.size(); ++i) {
+        MeshModel *model = models[i];
+
+        std::vector<MeshSheet *> sheets;
+        model->getMeshSheets(sheets);
+        for (size_t j = 0; j < sheets.size(); ++j) {
+            std::vector<const MeshFace *> faces;
+            sheets[j]->getMeshFaces(faces);
+            bool touching = false;
+            for (size_t n = 0; n < faces.size() && !touching; ++n) {
+                MLINT inds[4];
+                MLINT numInds = 0;
+                faces[n]->getInds(inds, &numInds);
+                for (MLINT k = 0; k < numInds; ++k) {
+                    if (inds[k] >= 0 &&
+                            inds[k] < (MLINT)pointPartition.size() &&
+                            part == pointPartition[inds[k]]) {
+                        touching = true;
+                    }
+                }
+            }
+
+            MeshModel *partModel;
+            MeshSheet *partSheet;
+            if (touching != partAssoc.getMeshSheetByName(
+                    sheets[j]->getName(), &partModel, &partSheet)) {
+                printf("partition %" MLINT_FORMAT ": mesh sheet %s %s\n",
+                    part, sheets[j]->getName().c_str(),
+                    touching ? "missing" : "not touching");
+                return 1;
+            }
+            if (!touching) {
+                continue;
+            }
+
+            partSheet->getMeshFaces(faces);
+            for (size_t n = 0; n < faces.size(); ++n) {
+                MLINT inds[4] = { MESH_TOPO_INDEX_UNUSED, MESH_TOPO_INDEX_UNUSED,
+                    MESH_TOPO_INDEX_UNUSED, MESH_TOPO_INDEX_UNUSED };
+                MLINT numInds = 0;
+                faces[n]->getInds(inds, &numInds);
+                bool owned = false;
+                bool valid = true;
+                for (MLINT k = 0; k < numInds; ++k) {
+                    if (inds[k] < 1 || inds[k] > (MLINT)localToGlobal.size()) {
+                        valid = false;
+                        break;
+                    }
+                    owned = owned || inds[k] <= numOwned;
+                    inds[k] = localToGlobal[inds[k] - 1];
+                }
+                const MeshFace *face = (valid && owned) ?
+                    model->findFaceByInds(inds[0], inds[1], inds[2], inds[3]) :
+                    NULL;
+                if (NULL == face ||
+                        face->getAref() != faces[n]->getAref() ||
+                        face->getGref() != faces[n]->getGref()) {
+                    printf("partition %" MLINT_FORMAT ": bad mesh face %"
+                        MLINT_FORMAT "\n", part, faces[n]->getID());
+                    return 1;
+                }
+            }
+        }
+
+        std::vector<MeshString *> strings;
+        model->getMeshStrings(strings);
+        for (size_t j = 0; j < strings.size(); ++j) {
+            std::vector<const MeshEdge *> edges;
+            strings[j]->getMeshEdges(edges);
+            bool touching = false;
+            for (size_t n = 0; n < edges.size() && !touching; ++n) {
+                MLINT inds[2];
+                MLINT numInds = 0;
+                edges[n]->getInds(inds, &numInds);
+                for (MLINT k = 0; k < numInds; ++k) {
+                    if (inds[k] >= 0 &&
+                            inds[k] < (MLINT)pointPartition.size() &&
+                            part == pointPartition[inds[k]]) {
+                        touching = true;
+                    }
+                }
+            }
+
+            MeshModel *partModel;
+            MeshString *partString;
+            if (touching != partAssoc.getMeshStringByName(
+                    strings[j]->getName(), &partModel, &partString)) {
+                printf("partition %" MLINT_FORMAT ": mesh string %s %s\n",
+                    part, strings[j]->getName().c_str(),
+                    touching ? "missing" : "not touching");
+                return 1;
+            }
+            if (!touching) {
+                continue;
+            }
+
+            partString->getMeshEdges(edges);
+            for (size_t n = 0; n < edges.size(); ++n) {
+                MLINT inds[2] = { MESH_TOPO_INDEX_UNUSED, MESH_TOPO_INDEX_UNUSED };
+                MLINT numInds = 0;
+                edges[n]->getInds(inds, &numInds);
+                bool owned = false;
+                bool valid = true;
+                for (MLINT k = 0; k < numInds; ++k) {
+                    if (inds[k] < 1 || inds[k] > (MLINT)localToGlobal.size()) {
+                        valid = false;
+                        break;
+                    }
+                    owned = owned || inds[k] <= numOwned;
+                    inds[k] = localToGlobal[inds[k] - 1];
+                }
+                const MeshEdge *edge = (valid && owned) ?
+                    model->findEdgeByInds(inds[0], inds[1]) : NULL;
+                if (NULL == edge ||
+                        edge->getAref() != edges[n]->getAref() ||
+                        edge->getGref() != edges[n]->getGref()) {
+                    printf("partition %" MLINT_FORMAT ": bad mesh edge %"
+                        MLINT_FORMAT "\n", part, edges[n]->getID());
+                    return 1;
+                }
+            }
+        }
+    }
+    return 0;
+}
+
+
+/***********************************************************
+*  checkLoadFilters
+*
+*  Read a MeshLink file skipping its first mesh model, then
+*  reading only the first sheet of the model, then skipping
+*  the first string of the model
+*/
+int
+checkLoadFilters(const std::string &fname)
+{
+    MeshAssociativity all;
+    MeshLinkParserXerces parser;
+    printf("\nParsing %s...\n\n", fname.c_str());
+    if (!parser.parseMeshLinkFile(fname, &all)) {
+        printf("Error parsing %s\n", fname.c_str());
+        return 1;
+    }
+    std::vector<MeshModel *> models;
+    all.getMeshModels(models);
+    if (models.empty()) {
+        return 0;
+    }
+    MeshModel *model = models[0];
+
+    if (!model->getName().empty()) {
+        MeshAssociativity filtered;
+        MeshLinkParserXerces filterParser;
+        filterParser.getModelFilter().exclude(model->getName());
+        printf("\nParsing %s without mesh model %s...\n\n", fname.c_str(),
+            model->getName().c_str());
+        if (!filterParser.parseMeshLinkFile(fname, &filtered) ||
+                filtered.getMeshModelCount() != models.size() - 1 ||
+                NULL != filtered.getMeshModelByRef(model->getRef().c_str())) {
+            printf("%s: mesh model filter failed\n", fname.c_str());
+            return 1;
+        }
+    }
+
+    std::vector<MeshSheet *> sheets;
+    model->getMeshSheets(sheets);
+    if (!sheets.empty()) {
+        MeshAssociativity filtered;
+        MeshLinkParserXerces filterParser;
+        filterParser.getSheetFilter().include(sheets[0]->getName());
+        printf("\nParsing %s with only mesh sheet %s...\n\n", fname.c_str(),
+            sheets[0]->getName().c_str());
+        MeshModel *filteredModel = NULL;
+        MeshSheet *filteredSheet;
+        if (!filterParser.parseMeshLinkFile(fname, &filtered) ||
+                !filtered.getMeshSheetByName(sheets[0]->getName(),
+                    &filteredModel, &filteredSheet) ||
+                1 != filteredModel->getMeshSheetCount()) {
+            printf("%s: mesh sheet filter failed\n", fname.c_str());
+            return 1;
+        }
+    }
+
+    std::vector<MeshString *> strings;
+    model->getMeshStrings(strings);
+    if (!strings.empty()) {
+        MeshAssociativity filtered;
+        MeshLinkParserXerces filterParser;
+        filterParser.getStringFilter().exclude(strings[0]->getName());
+        printf("\nParsing %s without mesh string %s...\n\n", fname.c_str(),
+            strings[0]->getName().c_str());
+        MeshModel *filteredModel;
+        MeshString *filteredString;
+        if (!filterParser.parseMeshLinkFile(fname, &filtered) ||
+                filtered.getMeshStringByName(strings[0]->getName(),
+                    &filteredModel, &filteredString)) {
+            printf("%s: mesh string filter failed\n", fname.c_str());
+            return 1;
+        }
+        filteredModel = filtered.getMeshModelByRef(model->getRef().c_str());
+        if (NULL == filteredModel ||
+                filteredModel->getMeshStringCount() != strings.size() - 1) {
+            printf("%s: mesh string filter failed\n", fname.c_str());
+            return 1;
+        }
+    }
+    return 0;
+}
+#endif
+
+
 
 /***********************************************************
 *  geomGroupsHaveCommonEntity
@@ -1312,6 +2183,17 @@ int projectToMeshTopoGeometry(
                     return 1;
                 }
 
+                // batch of the point, its projection and their mid-point
+                MLREAL points[9];
+                for (int n = 0; n < 3; ++n) {
+                    points[n] = point[n];
+                    points[3 + n] = projectedPt[n];
+                    points[6 + n] = 0.5 * (point[n] + projectedPt[n]);
+                }
+                if (0 != checkProjectPoints(geom_kernel, geom_group,
+                        points, 3, msgLead)) {
+                    return 1;
+                }
             }
         }
         else {
@@ -1324,6 +2206,88 @@ int projectToMeshTopoGeometry(
     return status;
 }
 
+// Batch point projection compared against single point projection
+int checkProjectPoints(
+    GeometryKernel *geom_kernel,
+    GeometryGroup *geom_group,
+    const MLREAL *points,
+    MLINT numPoints,
+    const char *msgLead
+)
+{
+    MLREAL tol = 1e-5;
+    const MLINT nameLen = 256;
+    std::vector<MLREAL> xyz(3 * numPoints);
+    std::vector<MLREAL> UV(2 * numPoints);
+    std::vector<char> names(nameLen * numPoints);
+    std::vector<MLINT> pointStatus(numPoints);
+
+    ProjectionResults results;
+    results.xyz = &xyz[0];
+    results.UV = &UV[0];
+    results.entityNames = &names[0];
+    results.entityNameBufLen = nameLen;
+    results.status = &pointStatus[0];
+
+    // serial, then parallel batch projection
+    for (int pass = 0; pass < 2; ++pass) {
+        const char *passName = (0 == pass) ? "projectPoints" :
+            "projectPointsParallel";
+        bool ok = (0 == pass) ?
+            geom_kernel->projectPoints(geom_group, points, numPoints, results) :
+            geom_kernel->projectPointsParallel(geom_group, points, numPoints,
+                results, 2);
+        if (!ok) {
+            printf("%s: %s failed\n", msgLead, passName);
+            return 1;
+        }
+
+        for (MLINT i = 0; i < numPoints; ++i) {
+            if (ML_STATUS_OK != pointStatus[i]) {
+                printf("%s: %s point %" MLINT_FORMAT " failed\n",
+                    msgLead, passName, i);
+                return 1;
+            }
+
+            ProjectionData projectionData(geom_kernel);
+            MLVector3D point = { points[3 * i], points[3 * i + 1],
+                points[3 * i + 2] };
+            if (!geom_kernel->projectPoint(geom_group, point, projectionData)) {
+                printf("%s: Point projection failed\n", msgLead);
+                return 1;
+            }
+            MLVector3D projectedPt = { 0.0, 0.0, 0.0 };
+            MLVector2D projectedUV = { 0.0, 0.0 };
+            std::string entity_name;
+            geom_kernel->getProjectionXYZ(projectionData, projectedPt);
+            geom_kernel->getProjectionUV(projectionData, projectedUV);
+            geom_kernel->getProjectionEntityName(projectionData, entity_name);
+
+            MLREAL dist = 0.0;
+            for (int n = 0; n < 3; ++n) {
+                dist += std::pow((xyz[3 * i + n] - projectedPt[n]), 2.0);
+            }
+            dist = std::sqrt(dist);
+            if (dist > tol) {
+                printf("%s: %s bad projection\n", msgLead, passName);
+                ML_assert(dist < tol);
+                return 1;
+            }
+            for (int n = 0; n < 2; ++n) {
+                if (std::fabs(UV[2 * i + n] - projectedUV[n]) > tol) {
+                    printf("%s: %s bad projection UV\n", msgLead, passName);
+                    return 1;
+                }
+            }
+            if (0 != strcmp(&names[nameLen * i], entity_name.c_str())) {
+                printf("%s: %s bad projection entity\n", msgLead, passName);
+                return 1;
+            }
+        }
+    }
+    return 0;
+}
+
 // Evaluation of parametric coordinates
 int evaluateParamPoint(
     MeshAssociativity &meshAssoc,
@@ -0,0 +1,128 @@
+/****************************************************************************
+ *
+ * (C) 2021 Cadence Design Systems, Inc. All rights reserved worldwide.
+ *
+ * This sample source code is not supported by Cadence Design Systems, Inc.
+ * It is provided freely for demonstration purposes only.
+ * SEE THE WARRANTY DISCLAIMER AT THE BOTTOM OF THIS FILE.
+ *
+ ***************************************************************************/
+
+/***********************************************************************
+**  MeshLink File Converter
+**
+**  Convert between MeshLink XML files and MeshLink binary
+**  containers (.mlb).
+**     + read the input file, XML or binary
+**     + write the output file, binary if its name ends in .mlb,
+**       otherwise XML; gzip-compressed if its name ends in .gz
+**/
+
+#include <Types.h>
+
+#include "MeshAssociativity.h"
+
+#if defined(HAVE_XERCES)
+#include "MeshLinkParser_xerces.h"
+#include "MeshLinkBinary.h"
+#include "MeshLinkStreamWriter.h"
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+// Whether a file name has an extension
+static bool
+hasExtension(const std::string &fname, const std::string &ext)
+{
+    return fname.size() > ext.size() &&
+        0 == fname.compare(fname.size() - ext.size(), ext.size(), ext);
+}
+
+
+// Whether a file name has the binary container extension
+static bool
+isBinaryName(const std::string &fname)
+{
+    return hasExtension(fname, ".mlb") || hasExtension(fname, ".mlb.gz");
+}
+
+
+//===============================================================================
+// MAIN routine
+int main(int argc, char** argv)
+{
+    if (argc < 3) {
+        printf("usage: <program name> <input file name> <output file name>\n");
+        printf("  output file names ending in .mlb are written as binary containers\n");
+        printf("  output file names ending in .gz are written gzip-compressed\n");
+        ::exit(1);
+    }
+
+    std::string input_fname(argv[1]);
+    std::string output_fname(argv[2]);
+    std::string schema_fname;  // empty schema filename causes schemaLocation in meshlink file to be used
+
+    // Needed for writing out Xml file
+    std::string xmlns;
+    std::string xmlns_xsi;
+    std::string schemaLocation;
+
+    MeshAssociativity meshAssoc;
+
+#if defined(HAVE_XERCES)
+    // Read Geometry-Mesh associativity
+    {
+        // Reads MeshLink XML files and binary containers
+        MeshLinkParserXerces parser;
+
+        if (!MeshLinkBinary::isBinaryFile(input_fname) &&
+                !hasExtension(input_fname, ".gz")) {
+            // Validate first
+            parser.validate(input_fname, schema_fname);
+        }
+
+        printf("\nParsing %s...\n\n", input_fname.c_str());
+        if (!parser.parseMeshLinkFile(input_fname, &meshAssoc)) {
+            printf("Error parsing geometry-mesh associativity\n");
+            return (-1);
+        }
+        parser.getMeshLinkAttributes(xmlns, xmlns_xsi, schemaLocation);
+    }
+
+    // Write Geometry-Mesh associativity
+    {
+        MeshLinkStreamWriter xmlWriter;
+        MeshLinkBinaryWriter binaryWriter;
+        MeshLinkWriter *writer = &xmlWriter;
+        if (isBinaryName(output_fname)) {
+            writer = &binaryWriter;
+        }
+        writer->setMeshLinkAttributes(xmlns, xmlns_xsi, schemaLocation);
+
+        printf("\nWriting %s...\n\n", output_fname.c_str());
+        // true: Base64 encoding
+        if (!writer->writeMeshLinkFile(output_fname, &meshAssoc, true)) {
+            printf("Error writing geometry-mesh associativity\n");
+            return (-1);
+        }
+    }
+#else
+    printf("Error parsing geometry-mesh associativity\n");
+    return (-1);
+#endif
+    return 0;
+}
+
+/****************************************************************************
+ *
+ * This file is licensed under the Cadence Public License Version 1.0 (the
+ * "License"), a copy of which is found in the included file named "LICENSE",
+ * and is distributed "AS IS." TO THE MAXIMUM EXTENT PERMITTED BY APPLICABLE
+ * LAW, CADENCE DISCLAIMS ALL WARRANTIES AND IN NO EVENT SHALL BE LIABLE TO
+ * ANY PARTY FOR ANY DAMAGES ARISING OUT OF OR RELATING TO USE OF THIS FILE.
+ * Please see the License for the full text of applicable terms.
+ *
+ ****************************************************************************/
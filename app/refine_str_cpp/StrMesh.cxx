@@ -12,6 +12,7 @@
 #include "MeshAssociativity.h"
 
 #include <algorithm>
+#include <map>
 #include <string.h>
 
 
@@ -276,7 +277,9 @@ StrMesh::adhere(MLINT refine_i, MLINT refine_j, MLINT refine_k,
         printf("ERROR: no active geometry kernel\n");
         return status;
     }
-    ProjectionData projectionData(geom_kernel);
+    // Refined point indices to project, gathered per geometry group
+    // so each group is projected as one batch
+    std::map<GeometryGroup *, std::vector<MLINT> > projectionQueue;
 
     MLINT orig_id = (id_ - 1) / refine_i + 1;
     MLINT orig_jd = (jd_ - 1) / refine_j + 1;
@@ -288,7 +291,6 @@ StrMesh::adhere(MLINT refine_i, MLINT refine_j, MLINT refine_k,
     MeshEdge *edge;
     MLINT indmm, indmp, indpm, indpp, iref1, iref2;
     MeshFace *face;
-    MLVector3D point;
     
     // I-direction edge projection
     if (refine_i > 1) {
@@ -317,14 +319,7 @@ StrMesh::adhere(MLINT refine_i, MLINT refine_j, MLINT refine_k,
                                 rind = ijk2ind(ri, rj, rk, id_, jd_);
                                 pw_assert(rind < (MLINT)xyz_[0].size());
 
-                                for (n = 0; n < 3; ++n) point[n] = xyz_[n][rind];
-                                if (!geom_kernel->projectPoint(geom_group, point, projectionData)) {
-                                    printf("Point projection failed\n");
-                                }
-                                else {
-                                    geom_kernel->getProjectionXYZ(projectionData, point);
-                                    for (n = 0; n < 3; ++n) xyz_[n][rind] = point[n];
-                                }
+                                projectionQueue[geom_group].push_back(rind);
                             }
                         }
                     }
@@ -361,14 +356,7 @@ StrMesh::adhere(MLINT refine_i, MLINT refine_j, MLINT refine_k,
                                 rind = ijk2ind(ri, rj, rk, id_, jd_);
                                 pw_assert(rind < (MLINT)xyz_[0].size());
 
-                                for (n = 0; n < 3; ++n) point[n] = xyz_[n][rind];
-                                if (!geom_kernel->projectPoint(geom_group, point, projectionData)) {
-                                    printf("Point projection failed\n");
-                                }
-                                else {
-                                    geom_kernel->getProjectionXYZ(projectionData, point);
-                                    for (n = 0; n < 3; ++n) xyz_[n][rind] = point[n];
-                                }
+                                projectionQueue[geom_group].push_back(rind);
                             }
                         }
                     }
@@ -404,14 +392,7 @@ StrMesh::adhere(MLINT refine_i, MLINT refine_j, MLINT refine_k,
                                 rind = ijk2ind(ri, rj, rk, id_, jd_);
                                 pw_assert(rind < (MLINT)xyz_[0].size());
 
-                                for (n = 0; n < 3; ++n) point[n] = xyz_[n][rind];
-                                if (!geom_kernel->projectPoint(geom_group, point, projectionData)) {
-                                    printf("Point projection failed\n");
-                                }
-                                else {
-                                    geom_kernel->getProjectionXYZ(projectionData, point);
-                                    for (n = 0; n < 3; ++n) xyz_[n][rind] = point[n];
-                                }
+                                projectionQueue[geom_group].push_back(rind);
                             }
                         }
                     }
@@ -451,14 +432,7 @@ StrMesh::adhere(MLINT refine_i, MLINT refine_j, MLINT refine_k,
                                     rind = ijk2ind(ri, rj, rk, id_, jd_);
                                     pw_assert(rind < (MLINT)xyz_[0].size());
 
-                                    for (n = 0; n < 3; ++n) point[n] = xyz_[n][rind];
-                                    if (!geom_kernel->projectPoint(geom_group, point, projectionData)) {
-                                        printf("Point projection failed\n");
-                                    }
-                                    else {
-                                        geom_kernel->getProjectionXYZ(projectionData, point);
-                                        for (n = 0; n < 3; ++n) xyz_[n][rind] = point[n];
-                                    }
+                                    projectionQueue[geom_group].push_back(rind);
                                 }
                             }
                         }
@@ -499,14 +473,7 @@ StrMesh::adhere(MLINT refine_i, MLINT refine_j, MLINT refine_k,
                                     rind = ijk2ind(ri, rj, rk, id_, jd_);
                                     pw_assert(rind < (MLINT)xyz_[0].size());
 
-                                    for (n = 0; n < 3; ++n) point[n] = xyz_[n][rind];
-                                    if (!geom_kernel->projectPoint(geom_group, point, projectionData)) {
-                                        printf("Point projection failed\n");
-                                    }
-                                    else {
-                                        geom_kernel->getProjectionXYZ(projectionData, point);
-                                        for (n = 0; n < 3; ++n) xyz_[n][rind] = point[n];
-                                    }
+                                    projectionQueue[geom_group].push_back(rind);
                                 }
                             }
                         }
@@ -547,14 +514,7 @@ StrMesh::adhere(MLINT refine_i, MLINT refine_j, MLINT refine_k,
                                     rind = ijk2ind(ri, rj, rk, id_, jd_);
                                     pw_assert(rind < (MLINT)xyz_[0].size());
 
-                                    for (n = 0; n < 3; ++n) point[n] = xyz_[n][rind];
-                                    if (!geom_kernel->projectPoint(geom_group, point, projectionData)) {
-                                        printf("Point projection failed\n");
-                                    }
-                                    else {
-                                        geom_kernel->getProjectionXYZ(projectionData, point);
-                                        for (n = 0; n < 3; ++n) xyz_[n][rind] = point[n];
-                                    }
+                                    projectionQueue[geom_group].push_back(rind);
                                 }
                             }
                         }
@@ -564,6 +524,37 @@ StrMesh::adhere(MLINT refine_i, MLINT refine_j, MLINT refine_k,
         }
     }
 
+    // Project the queued points, splitting each batch across threads
+    // when the kernel is reentrant
+    std::map<GeometryGroup *, std::vector<MLINT> >::const_iterator queueIter;
+    for (queueIter = projectionQueue.begin(); queueIter != projectionQueue.end();
+            ++queueIter) {
+        const std::vector<MLINT> &rinds = queueIter->second;
+        MLINT numPoints = (MLINT)rinds.size();
+        std::vector<MLREAL> points(3 * numPoints);
+        std::vector<MLREAL> projected(3 * numPoints);
+        std::vector<MLINT> pointStatus(numPoints);
+        MLINT p;
+        for (p = 0; p < numPoints; ++p) {
+            for (n = 0; n < 3; ++n) points[3 * p + n] = xyz_[n][rinds[p]];
+        }
+
+        ProjectionResults results;
+        results.xyz = projected.data();
+        results.status = pointStatus.data();
+        geom_kernel->projectPointsParallel(queueIter->first, points.data(),
+            numPoints, results);
+
+        for (p = 0; p < numPoints; ++p) {
+            if (ML_STATUS_OK != pointStatus[p]) {
+                printf("Point projection failed\n");
+            }
+            else {
+                for (n = 0; n < 3; ++n) xyz_[n][rinds[p]] = projected[3 * p + n];
+            }
+        }
+    }
+
     return status;
 }
 
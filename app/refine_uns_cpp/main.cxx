@@ -26,6 +26,7 @@
 #include "MeshAssociativity.h"
 #include "MeshLinkParser_xerces.h"
 #include "MeshLinkWriter_xerces.h"
+#include "MeshLinkAsyncWriter.h"
 
 // Refine_Uns Project Headers
 #include "surf_mesh.h"
@@ -256,23 +257,31 @@ int main(int argc, char** argv)
     // print geometry resolution of the current mesh
     surfMesh.computeGeometryResolutionStatistics(meshAssoc, *meshModel);
 
-    // write the refined mesh
-    if (!surfMesh.writeVrml(vrml_out_fname)) {
-        return (-1);
-    }
-
     // Write out the mesh associativity as a XML, roundtrip-capable
-    // file using xerces MeshLink XML writer
+    // file using xerces MeshLink XML writer. The write runs in the
+    // background while the refined mesh is written; meshAssoc is not
+    // modified again, so no snapshot is needed.
     std::string xmlns;
     std::string xmlns_xsi;
     std::string schemaLocation;
     parser.getMeshLinkAttributes(xmlns, xmlns_xsi, schemaLocation);
     MeshLinkWriterXerces writer;
     writer.setMeshLinkAttributes(xmlns, xmlns_xsi, schemaLocation);
+    MeshLinkAsyncWriter asyncWriter(writer);
     std::string t = std::string("refined_") + meshlink_fname;
     printf("Writing out refined data to new MeshLink XML file: %s\n",
         t.c_str());
-    writer.writeMeshLinkFile(t, &meshAssoc, compress);
+    asyncWriter.start(t, &meshAssoc, compress, false);
+
+    // write the refined mesh
+    if (!surfMesh.writeVrml(vrml_out_fname)) {
+        return (-1);
+    }
+
+    if (!asyncWriter.wait()) {
+        printf("Error writing refined MeshLink XML file: %s\n", t.c_str());
+        ret = -1;
+    }
 
     return ret;
 }
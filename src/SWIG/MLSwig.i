@@ -553,6 +553,95 @@ HANDLE_MLSTRING_BUFFER( vrefBuf, ML_BUFFER_SIZE, vrefBufLen )
 HANDLE_MLSTRING_BUFFER_ARRAY(entityNamesBufArr, ML_BUFFER_ARRAY_SIZE, ML_BUFFER_SIZE, entityNamesArrLen, entityNameBufLen, num_entityNames)	
 
 
+////////////////////////////////////////////////////////////////////////////////////////////////
+// Typemaps to handle batched point projection with ML_projectPoints.
+//
+// The points are input as a flat PyList of 3*N coordinates. The projected
+// XYZ (3*N), UV (2*N), distance (N), tolerance (N), entity names (N) and
+// per-point status (N) are appended to the result as flat PyLists.
+//
+// Requires match of arg types and arg names of ML_projectPoints.
+//
+%typemap(in) (const MLREAL *points, MLINT numPoints,
+    MLREAL *xyz, MLREAL *UV, MLREAL *distance, MLREAL *tolerance,
+    char *entityNamesBufArr, MLINT entityNameBufLen, MLINT *pointStatus)
+    (MLREAL *pointsIn = NULL) {
+    // Handle in flat PyList of point coordinates
+    Py_ssize_t l = PyList_Size( $input );
+    if (l < 0 || 0 != (l % 3)) {
+        SWIG_exception_fail(SWIG_ValueError, "in method 'ML_projectPoints', points must be a list of 3*N coordinates");
+    }
+    $2 = (MLINT) (l / 3);
+    pointsIn = new MLREAL[l + 1];
+    for (Py_ssize_t i = 0; i < l; i++) {
+        PyObject *oo = PyList_GetItem( $input, i );
+        pointsIn[i] = (MLREAL) PyFloat_AsDouble( oo );
+    }
+    $1 = pointsIn;
+    // zero-filled so unprojected points return well-defined values
+    $3 = new MLREAL[3 * $2 + 1]();
+    $4 = new MLREAL[2 * $2 + 1]();
+    $5 = new MLREAL[$2 + 1]();
+    $6 = new MLREAL[$2 + 1]();
+    $8 = ML_BUFFER_SIZE;
+    $7 = new char[$2 * $8 + 1]();
+    $9 = new MLINT[$2 + 1]();
+}
+
+%typemap(freearg) (const MLREAL *points, MLINT numPoints,
+    MLREAL *xyz, MLREAL *UV, MLREAL *distance, MLREAL *tolerance,
+    char *entityNamesBufArr, MLINT entityNameBufLen, MLINT *pointStatus) {
+    // free batched projection arrays
+    delete [] pointsIn$argnum;
+    delete [] $3;
+    delete [] $4;
+    delete [] $5;
+    delete [] $6;
+    delete [] $7;
+    delete [] $9;
+}
+
+%typemap(argout) (const MLREAL *points, MLINT numPoints,
+    MLREAL *xyz, MLREAL *UV, MLREAL *distance, MLREAL *tolerance,
+    char *entityNamesBufArr, MLINT entityNameBufLen, MLINT *pointStatus) {
+    // Handle batched projection arrays out to Python Lists
+    MLINT n = $2;
+    MLINT i;
+    PyObject *argObjs[6];
+    argObjs[0] = PyList_New(3 * n);
+    argObjs[1] = PyList_New(2 * n);
+    argObjs[2] = PyList_New(n);
+    argObjs[3] = PyList_New(n);
+    argObjs[4] = PyList_New(n);
+    argObjs[5] = PyList_New(n);
+    for (i = 0; i < 3 * n; i++) {
+        PyList_SetItem(argObjs[0], i, PyFloat_FromDouble($3[i]));
+    }
+    for (i = 0; i < 2 * n; i++) {
+        PyList_SetItem(argObjs[1], i, PyFloat_FromDouble($4[i]));
+    }
+    for (i = 0; i < n; i++) {
+        PyList_SetItem(argObjs[2], i, PyFloat_FromDouble($5[i]));
+        PyList_SetItem(argObjs[3], i, PyFloat_FromDouble($6[i]));
+        PyList_SetItem(argObjs[4], i, PyString_FromString( &($7[i * $8]) ));
+        PyList_SetItem(argObjs[5], i, PyLong_FromLongLong($9[i]));
+    }
+
+    // return object might not be a PyList
+    if (!PyList_Check($result)) {
+        // remake result as a PyList
+        PyObject *newResult = PyList_New( 1 );
+        PyList_SetItem(newResult, 0, $result);
+        $result = newResult;
+    }
+    for (i = 0; i < 6; i++) {
+        // append each array as a nested list
+        PyList_Append($result, argObjs[i]);
+        Py_DECREF(argObjs[i]);
+    }
+}
+
+
 %include "cpointer.i"
 %include "cstring.i"
 %include "carrays.i"
@@ -343,6 +343,10 @@ def ML_projectPoint(geomKernelObj, geomGroupObj, point, projectionDataObj):
     return _MeshLink.ML_projectPoint(geomKernelObj, geomGroupObj, point, projectionDataObj)
 ML_projectPoint = _MeshLink.ML_projectPoint
 
+def ML_projectPoints(geomKernelObj, geomGroupObj, points):
+    return _MeshLink.ML_projectPoints(geomKernelObj, geomGroupObj, points)
+ML_projectPoints = _MeshLink.ML_projectPoints
+
 def ML_createMeshLinkParserXercesObj(parseObj):
     return _MeshLink.ML_createMeshLinkParserXercesObj(parseObj)
 ML_createMeshLinkParserXercesObj = _MeshLink.ML_createMeshLinkParserXercesObj
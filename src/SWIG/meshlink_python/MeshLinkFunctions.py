@@ -314,6 +314,30 @@ def ProjectPointToMeshTopoGeometry( meshAssoc, geomKernel, meshTopo, point ):
     DeleteProjectionDataObject( projectionDataObj )
     return projectInfo
 
+def ProjectPointsToMeshTopoGeometry( meshAssoc, geomKernel, meshTopo, points ):
+    # points is a flat list of XYZ coordinates [x0, y0, z0, x1, y1, z1, ...]
+    # result lists are flat and indexed by point in the same way
+    projectInfo = {}
+    projectInfo['originalXYZ'] = points
+    projectInfo['success'] = False
+
+    geomGroup = GetGeometryGroupByID( meshAssoc, GetMeshTopoGref( meshTopo ) )
+    if geomGroup is None:
+        print('ProjectPointsToMeshTopoGeometry: missing geometry group')
+        return projectInfo
+
+    ret = ML.ML_projectPoints( geomKernel, geomGroup, points )
+    status = ret.pop(0)
+    # XYZ, UV, distance, tolerance, entity_name, per-point status
+    projectInfo['success'] = (0 == status)
+    projectInfo['XYZ'] = ret.pop(0)
+    projectInfo['UV'] = ret.pop(0)
+    projectInfo['distance'] = ret.pop(0)
+    projectInfo['tolerance'] = ret.pop(0)
+    projectInfo['hitEntityName'] = ret.pop(0)
+    projectInfo['pointSuccess'] = [ (0 == s) for s in ret.pop(0) ]
+    return projectInfo
+
 def GeometryEvalXYZ( geomKernel, UV, entityName ):
     ret = ML.ML_evalXYZ( geomKernel, UV, entityName)
     status = ret.pop(0)
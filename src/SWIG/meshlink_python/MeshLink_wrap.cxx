@@ -6855,6 +6855,139 @@ fail:
 }
 
 
+SWIGINTERN PyObject *_wrap_ML_projectPoints(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  GeometryKernelObj arg1 ;
+  GeometryGroupObj arg2 ;
+  MLREAL *arg3 = (MLREAL *) 0 ;
+  MLINT arg4 ;
+  MLREAL *arg5 = (MLREAL *) 0 ;
+  MLREAL *arg6 = (MLREAL *) 0 ;
+  MLREAL *arg7 = (MLREAL *) 0 ;
+  MLREAL *arg8 = (MLREAL *) 0 ;
+  char *arg9 = (char *) 0 ;
+  MLINT arg10 ;
+  MLINT *arg11 = (MLINT *) 0 ;
+  void *argp1 ;
+  int res1 = 0 ;
+  void *argp2 ;
+  int res2 = 0 ;
+  MLREAL *pointsIn3 = NULL ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  int result;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OOO:ML_projectPoints",&obj0,&obj1,&obj2)) SWIG_fail;
+  {
+    res1 = SWIG_ConvertPtr(obj0, &argp1, SWIGTYPE_p_MeshLinkObject,  0 );
+    if (!SWIG_IsOK(res1)) {
+      SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "ML_projectPoints" "', argument " "1"" of type '" "GeometryKernelObj""'"); 
+    }  
+    if (!argp1) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "ML_projectPoints" "', argument " "1"" of type '" "GeometryKernelObj""'");
+    } else {
+      arg1 = *((GeometryKernelObj *)(argp1));
+    }
+  }
+  {
+    res2 = SWIG_ConvertPtr(obj1, &argp2, SWIGTYPE_p_MeshLinkObject,  0 );
+    if (!SWIG_IsOK(res2)) {
+      SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "ML_projectPoints" "', argument " "2"" of type '" "GeometryGroupObj""'"); 
+    }  
+    if (!argp2) {
+      SWIG_exception_fail(SWIG_ValueError, "invalid null reference " "in method '" "ML_projectPoints" "', argument " "2"" of type '" "GeometryGroupObj""'");
+    } else {
+      arg2 = *((GeometryGroupObj *)(argp2));
+    }
+  }
+  {
+    // Handle in flat PyList of point coordinates
+    Py_ssize_t l = PyList_Size( obj2 );
+    if (l < 0 || 0 != (l % 3)) {
+      SWIG_exception_fail(SWIG_ValueError, "in method 'ML_projectPoints', points must be a list of 3*N coordinates");
+    }
+    arg4 = (MLINT) (l / 3);
+    pointsIn3 = new MLREAL[l + 1];
+    for (Py_ssize_t i = 0; i < l; i++) {
+      PyObject *oo = PyList_GetItem( obj2, i );
+      pointsIn3[i] = (MLREAL) PyFloat_AsDouble( oo );
+    }
+    arg3 = pointsIn3;
+    // zero-filled so unprojected points return well-defined values
+    arg5 = new MLREAL[3 * arg4 + 1]();
+    arg6 = new MLREAL[2 * arg4 + 1]();
+    arg7 = new MLREAL[arg4 + 1]();
+    arg8 = new MLREAL[arg4 + 1]();
+    arg10 = 512;
+    arg9 = new char[arg4 * arg10 + 1]();
+    arg11 = new MLINT[arg4 + 1]();
+  }
+  result = (int)ML_projectPoints(arg1,arg2,(double const *)arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10,arg11);
+  resultobj = SWIG_From_int((int)(result));
+  {
+    // Handle batched projection arrays out to Python Lists
+    MLINT n = arg4;
+    MLINT i;
+    PyObject *argObjs[6];
+    argObjs[0] = PyList_New(3 * n);
+    argObjs[1] = PyList_New(2 * n);
+    argObjs[2] = PyList_New(n);
+    argObjs[3] = PyList_New(n);
+    argObjs[4] = PyList_New(n);
+    argObjs[5] = PyList_New(n);
+    for (i = 0; i < 3 * n; i++) {
+      PyList_SetItem(argObjs[0], i, PyFloat_FromDouble(arg5[i]));
+    }
+    for (i = 0; i < 2 * n; i++) {
+      PyList_SetItem(argObjs[1], i, PyFloat_FromDouble(arg6[i]));
+    }
+    for (i = 0; i < n; i++) {
+      PyList_SetItem(argObjs[2], i, PyFloat_FromDouble(arg7[i]));
+      PyList_SetItem(argObjs[3], i, PyFloat_FromDouble(arg8[i]));
+      PyList_SetItem(argObjs[4], i, PyString_FromString( &(arg9[i * arg10]) ));
+      PyList_SetItem(argObjs[5], i, PyLong_FromLongLong(arg11[i]));
+    }
+    
+    // return object might not be a PyList
+    if (!PyList_Check(resultobj)) {
+      // remake result as a PyList
+      PyObject *newResult = PyList_New( 1 );
+      PyList_SetItem(newResult, 0, resultobj);
+      resultobj = newResult;
+    }
+    for (i = 0; i < 6; i++) {
+      // append each array as a nested list
+      PyList_Append(resultobj, argObjs[i]);
+      Py_DECREF(argObjs[i]);
+    }
+  }
+  {
+    // free batched projection arrays
+    delete [] pointsIn3;
+    delete [] arg5;
+    delete [] arg6;
+    delete [] arg7;
+    delete [] arg8;
+    delete [] arg9;
+    delete [] arg11;
+  }
+  return resultobj;
+fail:
+  {
+    // free batched projection arrays
+    delete [] pointsIn3;
+    delete [] arg5;
+    delete [] arg6;
+    delete [] arg7;
+    delete [] arg8;
+    delete [] arg9;
+    delete [] arg11;
+  }
+  return NULL;
+}
+
+
 SWIGINTERN PyObject *_wrap_ML_createMeshLinkParserXercesObj(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
   PyObject *resultobj = 0;
   MeshLinkParserObj *arg1 = (MeshLinkParserObj *) 0 ;
@@ -6995,6 +7128,7 @@ static PyMethodDef SwigMethods[] = {
 	 { (char *)"ML_createProjectionDataObj", _wrap_ML_createProjectionDataObj, METH_VARARGS, NULL},
 	 { (char *)"ML_freeProjectionDataObj", _wrap_ML_freeProjectionDataObj, METH_VARARGS, NULL},
 	 { (char *)"ML_projectPoint", _wrap_ML_projectPoint, METH_VARARGS, NULL},
+	 { (char *)"ML_projectPoints", _wrap_ML_projectPoints, METH_VARARGS, NULL},
 	 { (char *)"ML_createMeshLinkParserXercesObj", _wrap_ML_createMeshLinkParserXercesObj, METH_VARARGS, NULL},
 	 { (char *)"ML_freeMeshLinkParserXercesObj", _wrap_ML_freeMeshLinkParserXercesObj, METH_VARARGS, NULL},
 	 { (char *)"ML_createGeometryKernelGeodeObj", _wrap_ML_createGeometryKernelGeodeObj, METH_VARARGS, NULL},
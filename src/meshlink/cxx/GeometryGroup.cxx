@@ -12,6 +12,7 @@
 #include "MeshAssociativity.h"
 
 #include <stdio.h>
+#include <utility>
 
 //ML_EXTERN ML_STORAGE_CLASS 
 void
@@ -29,7 +30,7 @@ GeometryGroup::setName(const char* name)
 *
 ***************************************************************************/
 bool
-GeometryGroupManager::addGroup(GeometryGroup &group)
+GeometryGroupManager::canAdd(const GeometryGroup &group)
 {
     GeometryGroup *matchID = getByID(group.getID());
     GeometryGroup *matchName = getByName(group.getName());
@@ -48,7 +49,39 @@ GeometryGroupManager::addGroup(GeometryGroup &group)
             matchName->getID());
         return false;
     }
+    return true;
+}
+
+void
+GeometryGroupManager::indexLastGroup()
+{
+    size_t index = geometry_groups_.size() - 1;
+    const GeometryGroup &group = geometry_groups_[index];
+    idIndex_[group.getID()] = index;
+    if (!group.getName().empty()) {
+        nameIndex_[group.getName()] = index;
+    }
+}
+
+bool
+GeometryGroupManager::addGroup(const GeometryGroup &group)
+{
+    if (!canAdd(group)) {
+        return false;
+    }
     geometry_groups_.push_back(group);
+    indexLastGroup();
+    return true;
+}
+
+bool
+GeometryGroupManager::addGroup(GeometryGroup &&group)
+{
+    if (!canAdd(group)) {
+        return false;
+    }
+    geometry_groups_.push_back(std::move(group));
+    indexLastGroup();
     return true;
 }
 
@@ -69,30 +102,26 @@ GeometryGroupManager::getIDs(std::vector<MLINT> &idList) const
 }
 
 GeometryGroup *
-GeometryGroupManager::getByName(std::string name)
+GeometryGroupManager::getByName(const std::string &name)
 {
-    GeometryGroup *rtn = NULL;
     if (name.empty()) return NULL;
-    for (MLUINT i = 0; i < geometry_groups_.size(); ++i) {
-        if (geometry_groups_[i].getName().empty()) continue;
-        if (0 == name.compare(geometry_groups_[i].getName())) {
-            return &(geometry_groups_[i]);
-        }
+    std::unordered_map<std::string, size_t>::const_iterator iter =
+        nameIndex_.find(name);
+    if (iter == nameIndex_.end()) {
+        return NULL;
     }
-    return rtn;
+    return &(geometry_groups_[iter->second]);
 }
 
 
 GeometryGroup *
 GeometryGroupManager::getByID(MLINT id)
 {
-    GeometryGroup *rtn = NULL;
-    for (MLUINT i = 0; i < geometry_groups_.size(); ++i) {
-        if (id == geometry_groups_[i].getID()) {
-            return &(geometry_groups_[i]);
-        }
+    std::map<MLINT, size_t>::const_iterator iter = idIndex_.find(id);
+    if (iter == idIndex_.end()) {
+        return NULL;
     }
-    return rtn;
+    return &(geometry_groups_[iter->second]);
 }
 
 
@@ -172,6 +201,12 @@ GeometryGroup::setEntityNames(const std::set<std::string> &names) {
     entity_names_ = names;
 }
 
+/// \brief Set the %GeometryGroup's geometry entity list, taking ownership
+void 
+GeometryGroup::setEntityNames(std::set<std::string> &&names) {
+    entity_names_ = std::move(names);
+}
+
 /// \brief Get a set of geometry entity names referenced by the %GeometryGroup
 const std::set<std::string> &
 GeometryGroup::getEntityNameSet() const {
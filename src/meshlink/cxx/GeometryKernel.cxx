@@ -10,6 +10,11 @@
 
 #include "GeometryGroup.h"
 #include "GeometryKernel.h"
+#include "ThreadPool.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
 
 
 // Read the geometry data file
@@ -20,6 +25,10 @@ bool
 GeometryKernel::entityExists(const char* name) { return false; }
 
 
+bool
+GeometryKernel::isReentrant() const { return false; }
+
+
 const char *
 GeometryKernel::getName() const
 {
@@ -35,6 +44,103 @@ GeometryKernel::projectPoint(const GeometryGroup *group,
 }
 
 
+bool
+GeometryKernel::projectPoints(const GeometryGroup *group,
+    const MLREAL *points, MLINT numPoints, ProjectionResults &results)
+{
+    if (NULL == group || numPoints < 0 || (numPoints > 0 && NULL == points)) {
+        return false;
+    }
+    if (NULL != results.entityNames && results.entityNameBufLen < 1) {
+        return false;
+    }
+
+    // One projection data object serves the whole batch
+    ProjectionData projectionData(this);
+    std::string name;
+    bool allProjected = true;
+    MLINT i;
+    for (i = 0; i < numPoints; ++i) {
+        bool ok = projectPoint(group, &points[3 * i], projectionData);
+        if (ok && NULL != results.xyz) {
+            ok = getProjectionXYZ(projectionData, &results.xyz[3 * i]);
+        }
+        if (ok && NULL != results.UV) {
+            ok = getProjectionUV(projectionData, &results.UV[2 * i]);
+        }
+        if (ok && NULL != results.distance) {
+            ok = getProjectionDistance(projectionData, results.distance[i]);
+        }
+        if (ok && NULL != results.tolerance) {
+            ok = getProjectionTolerance(projectionData, results.tolerance[i]);
+        }
+        if (NULL != results.entityNames) {
+            char *nameBuf = &results.entityNames[i * results.entityNameBufLen];
+            ok = ok && getProjectionEntityName(projectionData, name);
+            strncpy(nameBuf, ok ? name.c_str() : "", results.entityNameBufLen);
+            nameBuf[results.entityNameBufLen - 1] = '\0';
+        }
+        if (NULL != results.status) {
+            results.status[i] = ok ? ML_STATUS_OK : ML_STATUS_ERROR;
+        }
+        if (!ok) {
+            allProjected = false;
+        }
+    }
+    return allProjected;
+}
+
+
+bool
+GeometryKernel::projectPointsParallel(const GeometryGroup *group,
+    const MLREAL *points, MLINT numPoints, ProjectionResults &results,
+    MLINT numThreads)
+{
+    // Chunks are small enough to balance uneven projection costs
+    // and large enough to amortize per-chunk setup
+    const MLINT minChunkSize = 64;
+
+    if (numThreads <= 0) {
+        numThreads = (MLINT)ThreadPool::getConcurrency();
+    }
+    numThreads = (std::min)(numThreads, numPoints / minChunkSize);
+    if (numThreads <= 1 || !isReentrant()) {
+        return projectPoints(group, points, numPoints, results);
+    }
+    if (NULL == group || NULL == points) {
+        return false;
+    }
+    if (NULL != results.entityNames && results.entityNameBufLen < 1) {
+        return false;
+    }
+
+    const MLINT chunkSize = (std::max)(minChunkSize, numPoints / (numThreads * 8));
+    const MLINT numChunks = (numPoints + chunkSize - 1) / chunkSize;
+    std::atomic<bool> allProjected(true);
+
+    // Each projectPoints call owns its ProjectionData, so jobs
+    // share nothing but the kernel and the disjoint result ranges
+    auto job = [&](size_t chunk) {
+        MLINT start = (MLINT)chunk * chunkSize;
+        MLINT count = (std::min)(chunkSize, numPoints - start);
+        ProjectionResults chunkResults = results;
+        if (chunkResults.xyz) chunkResults.xyz += 3 * start;
+        if (chunkResults.UV) chunkResults.UV += 2 * start;
+        if (chunkResults.distance) chunkResults.distance += start;
+        if (chunkResults.tolerance) chunkResults.tolerance += start;
+        if (chunkResults.entityNames) {
+            chunkResults.entityNames += start * chunkResults.entityNameBufLen;
+        }
+        if (chunkResults.status) chunkResults.status += start;
+        if (!projectPoints(group, &points[3 * start], count, chunkResults)) {
+            allProjected = false;
+        }
+    };
+    ThreadPool::parallelFor((size_t)numChunks, job, (size_t)numThreads);
+    return allProjected;
+}
+
+
 ProjectionDataObj
 GeometryKernel::getProjectionDataObject()
 {
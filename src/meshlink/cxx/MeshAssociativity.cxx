@@ -10,13 +10,18 @@
 
 #include "GeometryKernel.h"
 #include "MeshAssociativity.h"
+#include "TextScanner.h"
 
+#include <algorithm>
 #include <iostream>
+#include <mutex>
 #include <sstream>
 #include <string.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <istream>
 #include <iterator>
+#include <utility>
 
 GeometryKernelManager MeshAssociativity::geometry_kernel_manager_;
 
@@ -118,7 +123,7 @@ MeshAssociativity::clearAttributes() {
 }
 
 bool
-MeshAssociativity::addAttribute(MeshLinkAttribute &att)
+MeshAssociativity::addAttribute(const MeshLinkAttribute &att)
 {
     if (NULL != getAttributeByID(att.attid_)) {
         // attid already in use
@@ -131,6 +136,21 @@ MeshAssociativity::addAttribute(MeshLinkAttribute &att)
     return true;
 }
 
+bool
+MeshAssociativity::addAttribute(MeshLinkAttribute &&att)
+{
+    if (NULL != getAttributeByID(att.attid_)) {
+        // attid already in use
+        return false;
+    }
+    MLINT attid = att.attid_;
+    if (!att.name_.empty()) {
+        meshAttributeNameToIDMap_[att.name_] = attid;
+    }
+    meshAttributeIDMap_.emplace(attid, std::move(att));
+    return true;
+}
+
 /// \brief Return list of MeshLinkAttribute in the MeshAssociativity database
 std::vector<const MeshLinkAttribute *> 
 MeshAssociativity::getAttributes() const
@@ -168,15 +188,13 @@ MeshLinkTransform::MeshLinkTransform(MLINT xid,
     xid_(xid),
     aref_(MESH_TOPO_INVALID_REF),
     name_(name),
-    contents_(contents)
+    contents_(contents),
+    is_valid_(false)
 {
     std::vector<MLREAL> r;
-    std::stringstream ss(contents_);
-    MLREAL f;
-    while (r.size() < 17 && ss >> f) {
-        r.push_back(f);
-    }
-    if (r.size() == 16) {
+    r.reserve(17);
+    TextScanner scan(contents_);
+    if (16 == scan.scanArray(r, 17)) {
         int n = 0;
         // PW quaternion output is column indexing fastest
         for (int i = 0; i < 4; ++i) {
@@ -261,7 +279,7 @@ MeshAssociativity::clearTransforms() {
 }
 
 bool
-MeshAssociativity::addTransform(MeshLinkTransform &xform)
+MeshAssociativity::addTransform(const MeshLinkTransform &xform)
 {
     if (NULL != getTransformByID(xform.xid_)) {
         // xid already in use
@@ -275,6 +293,21 @@ MeshAssociativity::addTransform(MeshLinkTransform &xform)
     return true;
 }
 
+bool
+MeshAssociativity::addTransform(MeshLinkTransform &&xform)
+{
+    if (NULL != getTransformByID(xform.xid_)) {
+        // xid already in use
+        return false;
+    }
+    MLINT xid = xform.xid_;
+    if (!xform.name_.empty()) {
+        meshTransformNameToIDMap_[xform.name_] = xid;
+    }
+    meshTransformIDMap_.emplace(xid, std::move(xform));
+    return true;
+}
+
 
 void
 MeshAssociativity::getTransforms(std::vector<const MeshLinkTransform *> &xforms) const
@@ -452,10 +485,15 @@ MeshElementLinkage::setName(const char *nameCstr) {
 std::string
 MeshElementLinkage::getNextName()
 {
+    static std::mutex counterMutex;
     std::string basename = getBaseName();
-    MLUINT &counter = getNameCounter();
-    counter++;
-    std::ostringstream s;  s << counter;
+    MLUINT count;
+    {
+        std::lock_guard<std::mutex> lock(counterMutex);
+        MLUINT &counter = getNameCounter();
+        count = ++counter;
+    }
+    std::ostringstream s;  s << count;
     std::string name = basename + s.str();
     return name;
 }
@@ -589,15 +627,25 @@ MeshAssociativity::getMeshStringByName(const std::string &name,
 
 
 void
-MeshAssociativity::addGeometryFile(GeometryFile &file) {
+MeshAssociativity::addGeometryFile(const GeometryFile &file) {
     geometryFiles_.push_back(file);
 }
 
 void
-MeshAssociativity::addMeshFile(MeshFile &file) {
+MeshAssociativity::addGeometryFile(GeometryFile &&file) {
+    geometryFiles_.push_back(std::move(file));
+}
+
+void
+MeshAssociativity::addMeshFile(const MeshFile &file) {
     meshFiles_.push_back(file);
 }
 
+void
+MeshAssociativity::addMeshFile(MeshFile &&file) {
+    meshFiles_.push_back(std::move(file));
+}
+
 const std::vector<GeometryFile> &
 MeshAssociativity::getGeometryFiles() const
 {
@@ -645,15 +693,28 @@ MeshAssociativity::getAttribute(MLINT attID,
 
 
 bool
-MeshAssociativity::addGeometryGroup(GeometryGroup &geometry_group)
+MeshAssociativity::addGeometryGroup(const GeometryGroup &geometry_group)
 {
     return geometry_group_manager_.addGroup(geometry_group);
 }
 
+bool
+MeshAssociativity::addGeometryGroup(GeometryGroup &&geometry_group)
+{
+    return geometry_group_manager_.addGroup(std::move(geometry_group));
+}
+
 
 // Get geometry group by name - returns NULL if not found
 GeometryGroup *
 MeshAssociativity::getGeometryGroupByName(const char* name)
+{
+    if (NULL == name) { return NULL; }
+    return geometry_group_manager_.getByName(name);
+}
+
+GeometryGroup *
+MeshAssociativity::getGeometryGroupByName(const std::string &name)
 {
     return geometry_group_manager_.getByName(name);
 }
@@ -729,6 +790,662 @@ MeshAssociativity::getMeshModelCount() const
     return meshModelNameMap_.size();
 }
 
+
+bool
+MeshAssociativity::getPointIndexRange(MLINT *minIndex, MLINT *maxIndex) const
+{
+    bool found = false;
+    MeshModelNameMap::const_iterator iter;
+    for (iter = meshModelNameMap_.begin(); iter != meshModelNameMap_.end(); ++iter) {
+        MLINT modelMin, modelMax;
+        if (iter->second->getPointIndexRange(&modelMin, &modelMax)) {
+            if (!found || modelMin < *minIndex) { *minIndex = modelMin; }
+            if (!found || modelMax > *maxIndex) { *maxIndex = modelMax; }
+            found = true;
+        }
+    }
+    return found;
+}
+
+
+void
+MeshAssociativity::reorderEntities(MeshTopoOrderKeyFunc keyFunc, void *userData)
+{
+    MeshModelNameMap::iterator modelIter;
+    for (modelIter = meshModelNameMap_.begin(); modelIter != meshModelNameMap_.end(); ++modelIter) {
+        modelIter->second->reorderEntities(keyFunc, userData);
+    }
+}
+
+
+// Split whitespace-separated ID list into tokens
+static std::vector<std::string>
+splitIDList(const std::string &idList)
+{
+    std::stringstream strstr(idList);
+    std::istream_iterator<std::string> it(strstr);
+    std::istream_iterator<std::string> end;
+    return std::vector<std::string>(it, end);
+}
+
+// Apply ID remap to an integer reference string (e.g. MeshFile aref)
+static std::string
+remapIDString(const std::string &idString, const MeshTopoIDRemap &remap)
+{
+    char *end = NULL;
+    MLINT id = (MLINT)strtoll(idString.c_str(), &end, 10);
+    if (idString.empty() || NULL == end || '\0' != *end) {
+        return idString;
+    }
+    MeshTopoIDRemap::const_iterator iter = remap.find(id);
+    if (iter == remap.end()) {
+        return idString;
+    }
+    std::ostringstream s;  s << iter->second;
+    return s.str();
+}
+
+static MLINT
+remapMergeID(MLINT id, const MeshTopoIDRemap &remap)
+{
+    MeshTopoIDRemap::const_iterator iter = remap.find(id);
+    return (iter == remap.end()) ? id : iter->second;
+}
+
+// Attribute content matched by merge - name and contents
+typedef std::pair<std::string, std::string> MergeAttributeKey;
+typedef std::map<MergeAttributeKey, MLINT> MergeAttributeMap;
+
+// Attribute group contents with the member IDs in canonical spacing
+static std::string
+normalizeIDList(const std::string &idList)
+{
+    std::vector<std::string> ids = splitIDList(idList);
+    std::string normalized;
+    size_t i;
+    for (i = 0; i < ids.size(); ++i) {
+        normalized += (0 == i ? "" : " ") + ids[i];
+    }
+    return normalized;
+}
+
+// Geometry group content matched by merge - aref, member GIDs and entity
+// names
+struct MergeGroupKey {
+    MLINT aref;
+    std::vector<MLINT> gids;
+    std::set<std::string> entityNames;
+
+    bool operator<(const MergeGroupKey &other) const
+    {
+        if (aref != other.aref) { return aref < other.aref; }
+        if (gids != other.gids) { return gids < other.gids; }
+        return entityNames < other.entityNames;
+    }
+};
+
+// IDs of the groups with each content, in ID order
+typedef std::map<MergeGroupKey, std::vector<MLINT> > MergeGroupMap;
+
+// Transform content matched by merge - name, aref and contents
+typedef std::pair<std::string, std::pair<MLINT, std::string> > MergeTransformKey;
+typedef std::map<MergeTransformKey, MLINT> MergeTransformMap;
+
+
+bool
+MeshAssociativity::merge(MeshAssociativity &other, MLINT pointIndexOffset)
+{
+    if (this == &other) { return false; }
+    bool result = true;
+
+    // Offset point indices must still fit the entity index storage
+    MLINT range[2];
+    if (0 != pointIndexOffset &&
+        other.getPointIndexRange(&range[0], &range[1])) {
+        range[0] += pointIndexOffset;
+        range[1] += pointIndexOffset;
+        if (!MeshTopo::checkIndexStorage(range, 2)) {
+            return false;
+        }
+    }
+
+    //
+    // Attributes - non-group attributes first, then attribute groups
+    // once all of their members have been remapped
+    //
+    MeshTopoIDRemap attidRemap;
+    MLINT nextAttID = 1;
+    if (!meshAttributeIDMap_.empty()) {
+        nextAttID = meshAttributeIDMap_.rbegin()->first + 1;
+    }
+    // existing attributes by content, the first of equal ones kept
+    MergeAttributeMap attKeys;
+    MergeAttributeMap groupKeys;
+    MeshAttributeIDMap::const_iterator attIter;
+    for (attIter = meshAttributeIDMap_.begin();
+        attIter != meshAttributeIDMap_.end(); ++attIter) {
+        const MeshLinkAttribute &att = attIter->second;
+        if (att.is_group_) {
+            groupKeys.insert(std::make_pair(MergeAttributeKey(att.name_,
+                normalizeIDList(att.contents_)), attIter->first));
+        }
+        else {
+            attKeys.insert(std::make_pair(MergeAttributeKey(att.name_,
+                att.contents_), attIter->first));
+        }
+    }
+
+    std::vector<const MeshLinkAttribute *> pendingGroups;
+    for (attIter = other.meshAttributeIDMap_.begin();
+        attIter != other.meshAttributeIDMap_.end(); ++attIter) {
+        const MeshLinkAttribute &att = attIter->second;
+        if (att.is_group_) {
+            pendingGroups.push_back(&att);
+            continue;
+        }
+        MergeAttributeKey key(att.name_, att.contents_);
+        MergeAttributeMap::const_iterator match = attKeys.find(key);
+        if (match != attKeys.end()) {
+            attidRemap[att.attid_] = match->second;
+            continue;
+        }
+        MeshLinkAttribute newAtt = att;
+        if (NULL != getAttributeByID(newAtt.attid_)) {
+            newAtt.attid_ = nextAttID;
+        }
+        nextAttID = std::max(nextAttID, newAtt.attid_ + 1);
+        attidRemap[att.attid_] = newAtt.attid_;
+        attKeys[key] = newAtt.attid_;
+        newAtt.buildGroupArefs(*this);
+        addAttribute(std::move(newAtt));
+    }
+
+    while (!pendingGroups.empty()) {
+        std::vector<const MeshLinkAttribute *> deferred;
+        size_t i;
+        for (i = 0; i < pendingGroups.size(); ++i) {
+            const MeshLinkAttribute &att = *pendingGroups[i];
+            std::vector<std::string> arefs = splitIDList(att.contents_);
+            std::string contents;
+            bool ready = true;
+            size_t n;
+            for (n = 0; n < arefs.size() && ready; ++n) {
+                MLINT aref = (MLINT)strtoll(arefs[n].c_str(), NULL, 10);
+                MeshTopoIDRemap::const_iterator remapIter = attidRemap.find(aref);
+                if (remapIter == attidRemap.end()) {
+                    // member is a group not yet merged
+                    const MeshLinkAttribute *member = other.getAttributeByID(aref);
+                    ready = (NULL == member || !member->is_group_);
+                    continue;
+                }
+                std::ostringstream s;  s << remapIter->second;
+                contents += (contents.empty() ? "" : " ") + s.str();
+            }
+            if (!ready) {
+                deferred.push_back(&att);
+                continue;
+            }
+            MergeAttributeKey key(att.name_, contents);
+            MergeAttributeMap::const_iterator match = groupKeys.find(key);
+            if (match != groupKeys.end()) {
+                attidRemap[att.attid_] = match->second;
+                continue;
+            }
+            MeshLinkAttribute newAtt = att;
+            newAtt.contents_ = contents;
+            if (NULL != getAttributeByID(newAtt.attid_)) {
+                newAtt.attid_ = nextAttID;
+            }
+            nextAttID = std::max(nextAttID, newAtt.attid_ + 1);
+            attidRemap[att.attid_] = newAtt.attid_;
+            groupKeys[key] = newAtt.attid_;
+            newAtt.is_valid_ = newAtt.buildGroupArefs(*this);
+            addAttribute(std::move(newAtt));
+        }
+        if (deferred.size() == pendingGroups.size()) {
+            // circular attribute group references
+            std::cout << "Merge: unresolved AttributeGroup references." << std::endl;
+            result = false;
+            break;
+        }
+        pendingGroups.swap(deferred);
+    }
+
+    //
+    // Geometry groups - references first, then groups of references
+    //
+    MeshTopoIDRemap gidRemap;
+    std::vector<MLINT> gids;
+    getGeometryGroupIDs(gids);
+    MLINT nextGID = 1;
+    if (!gids.empty()) {
+        nextGID = *std::max_element(gids.begin(), gids.end()) + 1;
+    }
+    // existing groups by content
+    MergeGroupMap groupsByKey;
+    size_t i;
+    for (i = 0; i < gids.size(); ++i) {
+        GeometryGroup *group = getGeometryGroupByID(gids[i]);
+        MergeGroupKey key;
+        key.aref = group->getAref();
+        key.gids = group->getGIDs();
+        key.entityNames = group->getEntityNameSet();
+        groupsByKey[key].push_back(gids[i]);
+    }
+    std::vector<MLINT> otherGIDs;
+    other.getGeometryGroupIDs(otherGIDs);
+    for (int pass = 0; pass < 2; ++pass) {
+        for (i = 0; i < otherGIDs.size(); ++i) {
+            GeometryGroup *group = other.getGeometryGroupByID(otherGIDs[i]);
+            bool isGroupOfRefs = !group->getGIDs().empty();
+            if ((0 == pass) == isGroupOfRefs) { continue; }
+
+            MergeGroupKey key;
+            key.aref = remapMergeID(group->getAref(), attidRemap);
+            key.entityNames = group->getEntityNameSet();
+            size_t n;
+            for (n = 0; n < group->getGIDs().size(); ++n) {
+                key.gids.push_back(remapMergeID(group->getGIDs()[n], gidRemap));
+            }
+            const MLINT aref = key.aref;
+            const std::vector<MLINT> &memberGIDs = key.gids;
+
+            // a named group only matches a group of the same name
+            GeometryGroup *match = NULL;
+            std::vector<MLINT> &candidates = groupsByKey[key];
+            for (n = 0; n < candidates.size() && NULL == match; ++n) {
+                GeometryGroup *candidate = getGeometryGroupByID(candidates[n]);
+                if (group->getName().empty() ||
+                    candidate->getName() == group->getName()) {
+                    match = candidate;
+                }
+            }
+
+            MLINT newGID;
+            if (NULL != match) {
+                newGID = match->getID();
+            }
+            else {
+                GeometryGroup newGroup;
+                newGID = group->getID();
+                if (NULL != getGeometryGroupByID(newGID)) {
+                    newGID = nextGID;
+                }
+                nextGID = std::max(nextGID, newGID + 1);
+                std::string name = group->getName();
+                if (NULL != getGeometryGroupByName(name)) {
+                    int suffix = 1;
+                    std::string baseName = name;
+                    do {
+                        std::ostringstream s;  s << baseName << "-" << suffix++;
+                        name = s.str();
+                    } while (NULL != getGeometryGroupByName(name));
+                }
+                newGroup.setName(name.c_str());
+                newGroup.setID(newGID);
+                newGroup.setAref(aref);
+                newGroup.setEntityNames(group->getEntityNameSet());
+                for (n = 0; n < memberGIDs.size(); ++n) {
+                    newGroup.addGID(memberGIDs[n]);
+                }
+                if (!addGeometryGroup(std::move(newGroup))) {
+                    result = false;
+                    continue;
+                }
+                candidates.push_back(newGID);
+            }
+            gidRemap[group->getID()] = newGID;
+
+            // member references point back to their containing group
+            for (n = 0; n < memberGIDs.size(); ++n) {
+                GeometryGroup *member = getGeometryGroupByID(memberGIDs[n]);
+                MLINT containerID;
+                if (NULL != member && !member->getGroupID(containerID)) {
+                    member->setGroupID(newGID);
+                }
+            }
+        }
+    }
+
+    //
+    // Transforms
+    //
+    MeshTopoIDRemap xidRemap;
+    MLINT nextXID = 1;
+    if (!meshTransformIDMap_.empty()) {
+        nextXID = meshTransformIDMap_.rbegin()->first + 1;
+    }
+    // existing transforms by content, the first of equal ones kept
+    MergeTransformMap xformKeys;
+    MeshTransformIDMap::const_iterator xformIter;
+    for (xformIter = meshTransformIDMap_.begin();
+        xformIter != meshTransformIDMap_.end(); ++xformIter) {
+        const MeshLinkTransform &xform = xformIter->second;
+        xformKeys.insert(std::make_pair(MergeTransformKey(xform.name_,
+            std::make_pair(xform.aref_, xform.contents_)), xformIter->first));
+    }
+    for (xformIter = other.meshTransformIDMap_.begin();
+        xformIter != other.meshTransformIDMap_.end(); ++xformIter) {
+        MeshLinkTransform xform = xformIter->second;
+        xform.aref_ = remapMergeID(xform.aref_, attidRemap);
+        MergeTransformMap::const_iterator match = xformKeys.find(
+            MergeTransformKey(xform.name_,
+                std::make_pair(xform.aref_, xform.contents_)));
+        if (match != xformKeys.end()) {
+            xidRemap[xform.xid_] = match->second;
+            continue;
+        }
+        if (NULL != getTransformByID(xform.xid_)) {
+            xform.xid_ = nextXID;
+        }
+        nextXID = std::max(nextXID, xform.xid_ + 1);
+        xidRemap[xformIter->first] = xform.xid_;
+        if (meshTransformNameToIDMap_.find(xform.name_) != meshTransformNameToIDMap_.end()) {
+            xform.name_.clear();
+        }
+        xformKeys.insert(std::make_pair(MergeTransformKey(xform.name_,
+            std::make_pair(xform.aref_, xform.contents_)), xform.xid_));
+        addTransform(std::move(xform));
+    }
+
+    //
+    // Geometry files - combined by file name
+    //
+    for (i = 0; i < other.geometryFiles_.size(); ++i) {
+        const GeometryFile &otherFile = other.geometryFiles_[i];
+        GeometryFile *file = NULL;
+        size_t n;
+        for (n = 0; n < geometryFiles_.size(); ++n) {
+            if (geometryFiles_[n].filename_ == otherFile.filename_) {
+                file = &geometryFiles_[n];
+                break;
+            }
+        }
+        if (NULL == file) {
+            std::string filename = otherFile.filename_;
+            std::string arefString = remapIDString(otherFile.arefString_, attidRemap);
+            GeometryFile newFile(filename, arefString);
+            addGeometryFile(std::move(newFile));
+            file = &geometryFiles_.back();
+        }
+        const std::vector<MLINT> &fileGIDs = otherFile.getGeometryGroupIDs();
+        for (n = 0; n < fileGIDs.size(); ++n) {
+            MLINT gid = remapMergeID(fileGIDs[n], gidRemap);
+            const std::vector<MLINT> &existingGIDs = file->getGeometryGroupIDs();
+            if (std::find(existingGIDs.begin(), existingGIDs.end(), gid) ==
+                    existingGIDs.end()) {
+                file->addGeometryGroupID(gid);
+            }
+        }
+    }
+
+    //
+    // Mesh models - moved, combined with existing model of same reference
+    //
+    MeshModelNameMap otherModels;
+    otherModels.swap(other.meshModelNameMap_);
+    MeshTopoIDToNameMap otherModelIDs;
+    otherModelIDs.swap(other.meshModelIDToNameMap_);
+    other.meshModelRefToNameMap_.clear();
+
+    MeshModelNameMap::iterator modelIter;
+    for (modelIter = otherModels.begin(); modelIter != otherModels.end(); ++modelIter) {
+        MeshModel *model = modelIter->second;
+        model->remapReferences(pointIndexOffset, gidRemap, attidRemap);
+
+        MeshModel *existing = NULL;
+        if (!model->getRef().empty()) {
+            existing = getMeshModelByRef(model->getRef().c_str());
+        }
+        else {
+            existing = getMeshModelByName(model->getName());
+        }
+        if (NULL != existing) {
+            existing->absorbModel(model);
+            delete model;
+            continue;
+        }
+
+        while (NULL != getMeshModelByName(model->name_)) {
+            model->name_ = model->getNextName();
+        }
+        MeshTopoIDToNameMap::const_iterator idIter = otherModelIDs.find(model->mid_);
+        bool mapID = (idIter != otherModelIDs.end() &&
+            idIter->second == modelIter->first &&
+            meshModelIDToNameMap_.find(model->mid_) == meshModelIDToNameMap_.end());
+        if (!addMeshModel(model, mapID)) {
+            delete model;
+            result = false;
+        }
+    }
+
+    //
+    // Mesh files - combined by file name
+    //
+    for (i = 0; i < other.meshFiles_.size(); ++i) {
+        MeshFile &otherFile = other.meshFiles_[i];
+        MeshFile *file = NULL;
+        size_t n;
+        for (n = 0; n < meshFiles_.size(); ++n) {
+            if (meshFiles_[n].filename_ == otherFile.filename_) {
+                file = &meshFiles_[n];
+                break;
+            }
+        }
+        if (NULL == file) {
+            std::string filename = otherFile.filename_;
+            std::string arefString = remapIDString(otherFile.arefString_, attidRemap);
+            MeshFile newFile(filename, arefString);
+            addMeshFile(std::move(newFile));
+            file = &meshFiles_.back();
+        }
+        const std::vector<std::string> &modelRefs = otherFile.getModelRefs();
+        for (n = 0; n < modelRefs.size(); ++n) {
+            const std::vector<std::string> &existingRefs = file->getModelRefs();
+            if (std::find(existingRefs.begin(), existingRefs.end(), modelRefs[n]) ==
+                    existingRefs.end()) {
+                file->addModelRef(modelRefs[n]);
+            }
+        }
+    }
+
+    //
+    // Element linkages - moved
+    //
+    MeshElementLinkageNameMap otherLinkages;
+    otherLinkages.swap(other.meshElementLinkageNameMap_);
+    MeshElementLinkageNameMap::iterator linkIter;
+    for (linkIter = otherLinkages.begin(); linkIter != otherLinkages.end(); ++linkIter) {
+        MeshElementLinkage *link = linkIter->second;
+        link->aref_ = remapMergeID(link->aref_, attidRemap);
+        link->xref_ = remapMergeID(link->xref_, xidRemap);
+        if (NULL != getMeshElementLinkageByName(link->name_)) {
+            // generate a unique name
+            link->name_.clear();
+        }
+        if (!addMeshElementLinkage(link)) {
+            delete link;
+            result = false;
+        }
+    }
+
+    return result;
+}
+
+
+bool
+MeshAssociativity::extractPartitions(const std::vector<MLINT> &pointPartition,
+    MLINT numPartitions, std::vector<MeshAssociativity *> &parts,
+    std::vector<std::vector<MLINT> > *localToGlobal)
+{
+    parts.clear();
+    if (NULL != localToGlobal) {
+        localToGlobal->clear();
+    }
+    if (numPartitions <= 0) { return false; }
+
+    MeshPointPartition partition(pointPartition, numPartitions);
+    MLINT part;
+    for (part = 0; part < numPartitions; ++part) {
+        parts.push_back(new MeshAssociativity());
+    }
+
+    //
+    // Mesh models - each model is visited once for all partitions
+    //
+    bool result = true;
+    std::vector<MeshModel *> modelParts;
+    MeshModelNameMap::const_iterator modelIter;
+    for (modelIter = meshModelNameMap_.begin(); modelIter != meshModelNameMap_.end(); ++modelIter) {
+        const MeshModel *model = modelIter->second;
+        model->extractPartitions(partition, modelParts);
+        bool mapID = MeshTopo::isIDMapped(meshModelIDToNameMap_, model);
+        for (part = 0; part < numPartitions; ++part) {
+            if (NULL != modelParts[part] &&
+                !parts[part]->addMeshModel(modelParts[part], mapID)) {
+                delete modelParts[part];
+                result = false;
+            }
+        }
+    }
+
+    std::vector<MLINT> gids;
+    getGeometryGroupIDs(gids);
+    for (part = 0; part < numPartitions; ++part) {
+        MeshAssociativity &dest = *parts[part];
+        std::set<MLINT> arefs = partition.getArefs(part);
+
+        //
+        // Element linkages touching the partition and their transforms
+        //
+        MeshElementLinkageNameMap::const_iterator linkIter;
+        for (linkIter = meshElementLinkageNameMap_.begin();
+            linkIter != meshElementLinkageNameMap_.end(); ++linkIter) {
+            const MeshElementLinkage *link = linkIter->second;
+            std::string entityRefs[2];
+            link->getEntityRefs(entityRefs[0], entityRefs[1]);
+            bool found = false;
+            int n;
+            for (n = 0; n < 2 && !found; ++n) {
+                MeshModel *model;
+                MeshSheet *sheet;
+                MeshString *string;
+                found = dest.getMeshSheetByName(entityRefs[n], &model, &sheet) ||
+                    dest.getMeshStringByName(entityRefs[n], &model, &string);
+            }
+            if (!found) { continue; }
+            if (link->hasAref()) {
+                arefs.insert(link->aref_);
+            }
+            const MeshLinkTransform *xform = link->getTransform(*this);
+            if (NULL != xform && NULL == dest.getTransformByID(xform->xid_)) {
+                dest.addTransform(*xform);
+                if (xform->hasAref()) {
+                    arefs.insert(xform->aref_);
+                }
+            }
+            dest.addMeshElementLinkage(new MeshElementLinkage(*link));
+        }
+
+        //
+        // Geometry groups - referenced groups and their members
+        //
+        std::set<MLINT> groupIDs;
+        std::vector<MLINT> pending(partition.getGrefs(part).begin(),
+            partition.getGrefs(part).end());
+        while (!pending.empty()) {
+            MLINT gid = pending.back();
+            pending.pop_back();
+            GeometryGroup *group = getGeometryGroupByID(gid);
+            if (NULL == group || !groupIDs.insert(gid).second) { continue; }
+            pending.insert(pending.end(), group->getGIDs().begin(), group->getGIDs().end());
+        }
+        size_t i;
+        for (i = 0; i < gids.size(); ++i) {
+            if (groupIDs.find(gids[i]) == groupIDs.end()) { continue; }
+            const GeometryGroup *group = getGeometryGroupByID(gids[i]);
+            if (group->hasAref()) {
+                arefs.insert(group->getAref());
+            }
+            if (!dest.addGeometryGroup(*group)) {
+                result = false;
+            }
+        }
+
+        //
+        // Geometry files of the copied groups and mesh files of the copied models
+        //
+        for (i = 0; i < geometryFiles_.size(); ++i) {
+            const GeometryFile &file = geometryFiles_[i];
+            std::string filename = file.filename_;
+            std::string arefString = file.arefString_;
+            GeometryFile newFile(filename, arefString);
+            const std::vector<MLINT> &fileGIDs = file.getGeometryGroupIDs();
+            size_t n;
+            for (n = 0; n < fileGIDs.size(); ++n) {
+                if (groupIDs.find(fileGIDs[n]) != groupIDs.end()) {
+                    newFile.addGeometryGroupID(fileGIDs[n]);
+                }
+            }
+            if (!newFile.getGeometryGroupIDs().empty()) {
+                std::vector<std::string> fileArefs = splitIDList(arefString);
+                for (n = 0; n < fileArefs.size(); ++n) {
+                    arefs.insert((MLINT)strtoll(fileArefs[n].c_str(), NULL, 10));
+                }
+                dest.addGeometryFile(std::move(newFile));
+            }
+        }
+        for (i = 0; i < meshFiles_.size(); ++i) {
+            MeshFile &file = meshFiles_[i];
+            std::string filename = file.filename_;
+            std::string arefString = file.arefString_;
+            MeshFile newFile(filename, arefString);
+            const std::vector<std::string> &modelRefs = file.getModelRefs();
+            size_t n;
+            for (n = 0; n < modelRefs.size(); ++n) {
+                if (NULL != dest.getMeshModelByRef(modelRefs[n].c_str())) {
+                    newFile.addModelRef(modelRefs[n]);
+                }
+            }
+            if (!newFile.getModelRefs().empty()) {
+                std::vector<std::string> fileArefs = splitIDList(arefString);
+                for (n = 0; n < fileArefs.size(); ++n) {
+                    arefs.insert((MLINT)strtoll(fileArefs[n].c_str(), NULL, 10));
+                }
+                dest.addMeshFile(std::move(newFile));
+            }
+        }
+
+        //
+        // Attributes - referenced attributes and attribute group members
+        //
+        std::set<MLINT> attIDs;
+        pending.assign(arefs.begin(), arefs.end());
+        while (!pending.empty()) {
+            MLINT attid = pending.back();
+            pending.pop_back();
+            const MeshLinkAttribute *att = getAttributeByID(attid);
+            if (NULL == att || !attIDs.insert(attid).second) { continue; }
+            if (att->is_group_) {
+                std::vector<std::string> members = splitIDList(att->contents_);
+                size_t n;
+                for (n = 0; n < members.size(); ++n) {
+                    pending.push_back((MLINT)strtoll(members[n].c_str(), NULL, 10));
+                }
+            }
+        }
+        std::set<MLINT>::const_iterator attIter;
+        for (attIter = attIDs.begin(); attIter != attIDs.end(); ++attIter) {
+            dest.addAttribute(*getAttributeByID(*attIter));
+        }
+
+        if (NULL != localToGlobal) {
+            localToGlobal->push_back(partition.getLocalToGlobal(part));
+        }
+    }
+    return result;
+}
+
 void
 GeometryKernelManager::addKernel(GeometryKernel *kernel)
 {
@@ -144,6 +144,60 @@ ML_parserReadMeshLinkFile(
 }
 
 
+MLSTATUS
+ML_parserReadMeshLinkBuffer(
+    MeshLinkParserObj parseObj,
+    const char *buffer,
+    MLINT length,
+    MeshAssociativityObj meshAssocObj
+)
+{
+    MeshLinkParser *parser = (MeshLinkParser *)parseObj;
+    MeshAssociativity *meshAssoc = (MeshAssociativity *)meshAssocObj;
+    if (parser && meshAssoc && buffer && length >= 0) {
+        if (!parser->parseMeshLinkBuffer(buffer, (size_t)length, meshAssoc)) {
+            printf("Error parsing geometry-mesh associativity\n");
+            return (ML_STATUS_ERROR);
+        }
+    }
+    else {
+        return ML_STATUS_ERROR;
+    }
+    return ML_STATUS_OK;
+}
+
+
+MLSTATUS
+ML_parserReadMeshLinkFiles(
+    MeshLinkParserObj parseObj,
+    const char **meshlink_fnames,
+    MLINT numFiles,
+    MeshAssociativityObj meshAssocObj
+)
+{
+    MeshLinkParser *parser = (MeshLinkParser *)parseObj;
+    MeshAssociativity *meshAssoc = (MeshAssociativity *)meshAssocObj;
+    if (parser && meshAssoc && meshlink_fnames && numFiles > 0) {
+        std::vector<std::string> fnames;
+        MLINT i;
+        for (i = 0; i < numFiles; ++i) {
+            if (NULL == meshlink_fnames[i]) {
+                return ML_STATUS_ERROR;
+            }
+            fnames.push_back(meshlink_fnames[i]);
+        }
+        if (!parser->parseMeshLinkFiles(fnames, meshAssoc)) {
+            printf("Error parsing geometry-mesh associativity\n");
+            return (ML_STATUS_ERROR);
+        }
+    }
+    else {
+        return ML_STATUS_ERROR;
+    }
+    return ML_STATUS_OK;
+}
+
+
 MLSTATUS
 ML_parserGetMeshLinkAttributes(
     MeshLinkParserObj parseObj,
@@ -1734,6 +1788,39 @@ MLSTATUS ML_projectPoint(
 }
 
 
+MLSTATUS ML_projectPoints(
+    GeometryKernelObj geomKernelObj,
+    GeometryGroupObj geomGroupObj,
+    const MLREAL *points,
+    MLINT numPoints,
+    MLREAL *xyz,
+    MLREAL *UV,
+    MLREAL *distance,
+    MLREAL *tolerance,
+    char *entityNamesBufArr, MLINT entityNameBufLen,
+    MLINT *pointStatus
+)
+{
+    GeometryKernel *geom_kernel = (GeometryKernel *)geomKernelObj;
+    GeometryGroup *geom_group = (GeometryGroup *)geomGroupObj;
+    if (geom_kernel && geom_group) {
+        ProjectionResults results;
+        results.xyz = xyz;
+        results.UV = UV;
+        results.distance = distance;
+        results.tolerance = tolerance;
+        results.entityNames = entityNamesBufArr;
+        results.entityNameBufLen = entityNameBufLen;
+        results.status = pointStatus;
+        if (!geom_kernel->projectPoints(geom_group, points, numPoints, results)) {
+            return ML_STATUS_ERROR;
+        }
+        return ML_STATUS_OK;
+    }
+    return ML_STATUS_ERROR;
+}
+
+
 MLSTATUS ML_getProjectionInfo(
     GeometryKernelObj geomKernelObj,
     ProjectionDataObj projectionDataObj,
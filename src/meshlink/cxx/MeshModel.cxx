@@ -244,6 +244,472 @@ MeshModel::getMeshSheetCount() const
 }
 
 
+bool
+MeshModel::getPointIndexRange(MLINT *minIndex, MLINT *maxIndex) const
+{
+    bool found = false;
+    MLINT inds[4];
+    MLINT numInds;
+    auto update = [&](const MLINT *ind, MLINT count) {
+        for (MLINT n = 0; n < count; ++n) {
+            if (MESH_TOPO_INDEX_UNUSED == ind[n]) { continue; }
+            if (!found || ind[n] < *minIndex) { *minIndex = ind[n]; }
+            if (!found || ind[n] > *maxIndex) { *maxIndex = ind[n]; }
+            found = true;
+        }
+    };
+
+    MeshPointNameMap::const_iterator piter;
+    for (piter = meshPointNameMap_.begin(); piter != meshPointNameMap_.end(); ++piter) {
+        inds[0] = piter->second->i1_;
+        update(inds, 1);
+    }
+    std::map<pwiFnvHash::FNVHash, MeshPoint*>::const_iterator epiter;
+    for (epiter = edgePointMap_.begin(); epiter != edgePointMap_.end(); ++epiter) {
+        inds[0] = epiter->second->i1_;
+        update(inds, 1);
+    }
+    for (epiter = faceEdgePointMap_.begin(); epiter != faceEdgePointMap_.end(); ++epiter) {
+        inds[0] = epiter->second->i1_;
+        update(inds, 1);
+    }
+    MeshEdgeNameMap::const_iterator eiter;
+    for (eiter = meshEdgeNameMap_.begin(); eiter != meshEdgeNameMap_.end(); ++eiter) {
+        eiter->second->getInds(inds, &numInds);
+        update(inds, 2);
+    }
+    std::map<pwiFnvHash::FNVHash, MeshEdge*>::const_iterator feiter;
+    for (feiter = faceEdgeMap_.begin(); feiter != faceEdgeMap_.end(); ++feiter) {
+        feiter->second->getInds(inds, &numInds);
+        update(inds, 2);
+    }
+    MeshFaceNameMap::const_iterator fiter;
+    for (fiter = meshFaceNameMap_.begin(); fiter != meshFaceNameMap_.end(); ++fiter) {
+        fiter->second->getInds(inds, &numInds);
+        update(inds, 4);
+    }
+
+    // sheet and string entities are normally duplicated in the model,
+    // but need not be
+    MeshSheetNameMap::const_iterator msIter;
+    for (msIter = meshSheetNameMap_.begin(); msIter != meshSheetNameMap_.end(); ++msIter) {
+        const MeshSheet *sheet = msIter->second;
+        for (fiter = sheet->meshFaceNameMap_.begin();
+            fiter != sheet->meshFaceNameMap_.end(); ++fiter) {
+            fiter->second->getInds(inds, &numInds);
+            update(inds, 4);
+        }
+    }
+    MeshStringNameMap::const_iterator mstrIter;
+    for (mstrIter = meshStringNameMap_.begin(); mstrIter != meshStringNameMap_.end(); ++mstrIter) {
+        const MeshString *string = mstrIter->second;
+        for (eiter = string->meshEdgeNameMap_.begin();
+            eiter != string->meshEdgeNameMap_.end(); ++eiter) {
+            eiter->second->getInds(inds, &numInds);
+            update(inds, 2);
+        }
+    }
+    return found;
+}
+
+
+void
+MeshModel::reorderEntities(MeshTopoOrderKeyFunc keyFunc, void *userData)
+{
+    MeshStringNameMap::iterator mstrIter;
+    for (mstrIter = meshStringNameMap_.begin(); mstrIter != meshStringNameMap_.end(); ++mstrIter) {
+        mstrIter->second->reorderEntities(keyFunc, userData);
+    }
+    MeshSheetNameMap::iterator msIter;
+    for (msIter = meshSheetNameMap_.begin(); msIter != meshSheetNameMap_.end(); ++msIter) {
+        msIter->second->reorderEntities(keyFunc, userData);
+    }
+}
+
+
+void
+MeshModel::remapReferences(MLINT indexOffset,
+    const MeshTopoIDRemap &gidRemap, const MeshTopoIDRemap &attidRemap)
+{
+    MeshTopo::remapReferences(indexOffset, gidRemap, attidRemap);
+
+    // Entities are remapped in place, hash maps are rebuilt
+    // from the new point indices
+    MeshPointNameMap::iterator piter;
+    for (piter = meshPointNameMap_.begin(); piter != meshPointNameMap_.end(); ++piter) {
+        piter->second->remapReferences(indexOffset, gidRemap, attidRemap);
+    }
+    std::map<pwiFnvHash::FNVHash, MeshPoint*> pointMap;
+    std::map<pwiFnvHash::FNVHash, MeshPoint*>::iterator hpiter;
+    for (hpiter = pointMap_.begin(); hpiter != pointMap_.end(); ++hpiter) {
+        pointMap[hpiter->second->getHash()] = hpiter->second;
+    }
+    pointMap_.swap(pointMap);
+
+    // owned edge-points and face-edge-points
+    std::map<pwiFnvHash::FNVHash, MeshPoint*> *ownedPointMaps[2] =
+        { &edgePointMap_, &faceEdgePointMap_ };
+    for (int n = 0; n < 2; ++n) {
+        pointMap.clear();
+        for (hpiter = ownedPointMaps[n]->begin(); hpiter != ownedPointMaps[n]->end(); ++hpiter) {
+            MeshPoint *point = hpiter->second;
+            point->remapReferences(indexOffset, gidRemap, attidRemap);
+            pointMap[point->getHash()] = point;
+        }
+        ownedPointMaps[n]->swap(pointMap);
+    }
+
+    MeshEdgeNameMap::iterator eiter;
+    for (eiter = meshEdgeNameMap_.begin(); eiter != meshEdgeNameMap_.end(); ++eiter) {
+        eiter->second->remapReferences(indexOffset, gidRemap, attidRemap);
+    }
+    std::map<pwiFnvHash::FNVHash, MeshEdge*> edgeMap;
+    std::map<pwiFnvHash::FNVHash, MeshEdge*>::iterator heiter;
+    for (heiter = edgeMap_.begin(); heiter != edgeMap_.end(); ++heiter) {
+        edgeMap[heiter->second->getHash()] = heiter->second;
+    }
+    edgeMap_.swap(edgeMap);
+
+    // owned face-edges
+    edgeMap.clear();
+    for (heiter = faceEdgeMap_.begin(); heiter != faceEdgeMap_.end(); ++heiter) {
+        MeshEdge *edge = heiter->second;
+        edge->remapReferences(indexOffset, gidRemap, attidRemap);
+        edgeMap[edge->getHash()] = edge;
+    }
+    faceEdgeMap_.swap(edgeMap);
+
+    MeshFaceNameMap::iterator fiter;
+    for (fiter = meshFaceNameMap_.begin(); fiter != meshFaceNameMap_.end(); ++fiter) {
+        fiter->second->remapReferences(indexOffset, gidRemap, attidRemap);
+    }
+    std::map<pwiFnvHash::FNVHash, MeshFace*> faceMap;
+    std::map<pwiFnvHash::FNVHash, MeshFace*>::iterator hfiter;
+    for (hfiter = faceMap_.begin(); hfiter != faceMap_.end(); ++hfiter) {
+        faceMap[hfiter->second->getHash()] = hfiter->second;
+    }
+    faceMap_.swap(faceMap);
+
+    MeshStringNameMap::iterator mstrIter;
+    for (mstrIter = meshStringNameMap_.begin(); mstrIter != meshStringNameMap_.end(); ++mstrIter) {
+        mstrIter->second->remapReferences(indexOffset, gidRemap, attidRemap);
+    }
+    MeshSheetNameMap::iterator msIter;
+    for (msIter = meshSheetNameMap_.begin(); msIter != meshSheetNameMap_.end(); ++msIter) {
+        msIter->second->remapReferences(indexOffset, gidRemap, attidRemap);
+    }
+}
+
+
+// Move entities from one owning hash map to another, discarding duplicates
+template<class T>
+static void
+absorbHashedEntities(std::map<pwiFnvHash::FNVHash, T *> &hashMap,
+    std::map<pwiFnvHash::FNVHash, T *> &otherHashMap)
+{
+    typename std::map<pwiFnvHash::FNVHash, T *>::iterator iter;
+    for (iter = otherHashMap.begin(); iter != otherHashMap.end(); ++iter) {
+        if (hashMap.find(iter->first) != hashMap.end()) {
+            delete iter->second;
+        }
+        else {
+            hashMap[iter->first] = iter->second;
+        }
+    }
+    otherHashMap.clear();
+}
+
+
+template<class T>
+void
+MeshModel::absorbEntities(std::map<std::string, T *> &nameMap,
+    std::map<pwiFnvHash::FNVHash, T *> &hashMap,
+    MeshTopoIDToNameMap &idMap, MeshTopoRefToNameMap &refMap,
+    std::map<std::string, T *> &otherNameMap,
+    MeshTopoIDToNameMap &otherIDMap)
+{
+    // entity names may change on collision
+    std::map<std::string, std::string> newNames;
+    typename std::map<std::string, T *>::iterator iter;
+    for (iter = otherNameMap.begin(); iter != otherNameMap.end(); ++iter) {
+        T *entity = iter->second;
+        bool hasInds = (MESH_TOPO_INDEX_UNUSED != entity->i1_);
+        if (hasInds && hashMap.find(entity->getHash()) != hashMap.end()) {
+            // duplicate of existing entity
+            delete entity;
+            continue;
+        }
+        while (nameMap.find(entity->name_) != nameMap.end()) {
+            entity->name_ = entity->getNextName();
+        }
+        newNames[iter->first] = entity->name_;
+        nameMap[entity->name_] = entity;
+        if (hasInds) {
+            hashMap[entity->getHash()] = entity;
+        }
+        if (!entity->getRef().empty() &&
+            refMap.find(entity->getRef()) == refMap.end()) {
+            refMap[entity->getRef()] = entity->name_;
+        }
+    }
+
+    MeshTopoIDToNameMap::iterator idIter;
+    for (idIter = otherIDMap.begin(); idIter != otherIDMap.end(); ++idIter) {
+        std::map<std::string, std::string>::iterator nameIter =
+            newNames.find(idIter->second);
+        if (nameIter != newNames.end() &&
+            idMap.find(idIter->first) == idMap.end()) {
+            idMap[idIter->first] = nameIter->second;
+        }
+    }
+    otherNameMap.clear();
+    otherIDMap.clear();
+}
+
+
+void
+MeshModel::absorbModel(MeshModel *other)
+{
+    if (NULL == other || this == other) { return; }
+
+    // Entities hold their own copies of ParamVertex data, so
+    // duplicate model vertices are simply discarded
+    ParamVertVrefMap::iterator pviter;
+    for (pviter = other->paramVertVrefMap_.begin();
+        pviter != other->paramVertVrefMap_.end(); ++pviter) {
+        if (NULL == getParamVertByVref(pviter->first)) {
+            paramVertVrefMap_[pviter->first] = pviter->second;
+        }
+        else {
+            delete pviter->second;
+        }
+    }
+    ParamVertIDToVrefMap::iterator pvIDIter;
+    for (pvIDIter = other->paramVertIDToVrefMap_.begin();
+        pvIDIter != other->paramVertIDToVrefMap_.end(); ++pvIDIter) {
+        if (paramVertIDToVrefMap_.find(pvIDIter->first) == paramVertIDToVrefMap_.end()) {
+            paramVertIDToVrefMap_[pvIDIter->first] = pvIDIter->second;
+        }
+    }
+    other->paramVertVrefMap_.clear();
+    other->paramVertIDToVrefMap_.clear();
+
+    absorbEntities(meshPointNameMap_, pointMap_, meshPointIDToNameMap_,
+        meshPointRefToNameMap_, other->meshPointNameMap_, other->meshPointIDToNameMap_);
+    other->pointMap_.clear();
+    other->meshPointRefToNameMap_.clear();
+
+    absorbEntities(meshEdgeNameMap_, edgeMap_, meshEdgeIDToNameMap_,
+        meshEdgeRefToNameMap_, other->meshEdgeNameMap_, other->meshEdgeIDToNameMap_);
+    other->edgeMap_.clear();
+    other->meshEdgeRefToNameMap_.clear();
+
+    absorbEntities(meshFaceNameMap_, faceMap_, meshFaceIDToNameMap_,
+        meshFaceRefToNameMap_, other->meshFaceNameMap_, other->meshFaceIDToNameMap_);
+    other->faceMap_.clear();
+    other->meshFaceRefToNameMap_.clear();
+
+    absorbHashedEntities(edgePointMap_, other->edgePointMap_);
+    absorbHashedEntities(faceEdgePointMap_, other->faceEdgePointMap_);
+    absorbHashedEntities(faceEdgeMap_, other->faceEdgeMap_);
+
+    MeshStringNameMap::iterator mstrIter;
+    for (mstrIter = other->meshStringNameMap_.begin();
+        mstrIter != other->meshStringNameMap_.end(); ++mstrIter) {
+        MeshString *meshString = mstrIter->second;
+        MLINT mid = meshString->mid_;
+        bool mapID = (other->getMeshStringByID(mid) == meshString &&
+            NULL == getMeshStringByID(mid));
+        while (NULL != getMeshStringByName(meshString->name_)) {
+            meshString->name_ = meshString->getNextName();
+        }
+        addMeshString(meshString, mapID);
+    }
+    other->meshStringNameMap_.clear();
+    other->meshStringIDToNameMap_.clear();
+    other->meshStringRefToNameMap_.clear();
+
+    MeshSheetNameMap::iterator msIter;
+    for (msIter = other->meshSheetNameMap_.begin();
+        msIter != other->meshSheetNameMap_.end(); ++msIter) {
+        MeshSheet *meshSheet = msIter->second;
+        MLINT mid = meshSheet->mid_;
+        bool mapID = (other->getMeshSheetByID(mid) == meshSheet &&
+            NULL == getMeshSheetByID(mid));
+        while (NULL != getMeshSheetByName(meshSheet->name_)) {
+            meshSheet->name_ = meshSheet->getNextName();
+        }
+        addMeshSheet(meshSheet, mapID);
+    }
+    other->meshSheetNameMap_.clear();
+    other->meshSheetIDToNameMap_.clear();
+    other->meshSheetRefToNameMap_.clear();
+}
+
+
+void
+MeshModel::extractPartitions(MeshPointPartition &partition,
+    std::vector<MeshModel *> &parts) const
+{
+    parts.assign((size_t)partition.getNumPartitions(), NULL);
+    auto getPart = [&](MLINT part) {
+        if (NULL == parts[part]) {
+            std::string ref = ref_;
+            std::string name = name_;
+            parts[part] = new MeshModel(ref, mid_, aref_, gref_, name);
+        }
+        return parts[part];
+    };
+
+    // Entities belong to every partition owning one of their points.
+    // Entities defined only by reference are not copied.
+    MLINT inds[4];
+    MLINT numInds;
+    MLINT owners[4];
+    int numOwners;
+    int n;
+    MeshFaceNameMap::const_iterator fiter;
+    for (fiter = meshFaceNameMap_.begin(); fiter != meshFaceNameMap_.end(); ++fiter) {
+        const MeshFace *face = fiter->second;
+        face->getInds(inds, &numInds);
+        if (numInds < 3) { continue; }
+        numOwners = partition.getPartitions(inds, (int)numInds, owners);
+        for (n = 0; n < numOwners; ++n) {
+            MLINT part = owners[n];
+            MeshModel *model = getPart(part);
+            MLINT local[4];
+            ParamVertex localPVs[4];
+            ParamVertex *pvs[4];
+            int j;
+            for (j = 0; j < 4; ++j) {
+                local[j] = (j < numInds) ?
+                    partition.getLocalIndex(part, inds[j]) : MESH_TOPO_INDEX_UNUSED;
+                pvs[j] = partition.getLocalParamVertex(part, face->paramVerts_[j],
+                    localPVs[j]);
+            }
+            partition.addReferences(part, face->gref_, face->aref_);
+            std::string name = face->name_;
+            bool mapID = isIDMapped(meshFaceIDToNameMap_, face);
+            if (3 == numInds) {
+                model->addFace(local[0], local[1], local[2],
+                    face->mid_, face->aref_, face->gref_, name,
+                    pvs[0], pvs[1], pvs[2], mapID);
+            }
+            else {
+                model->addFace(local[0], local[1], local[2], local[3],
+                    face->mid_, face->aref_, face->gref_, name,
+                    pvs[0], pvs[1], pvs[2], pvs[3], mapID);
+            }
+        }
+    }
+
+    // edges and face-edges
+    std::vector<const MeshEdge *> edges;
+    std::vector<bool> isFaceEdge;
+    MeshEdgeNameMap::const_iterator eiter;
+    for (eiter = meshEdgeNameMap_.begin(); eiter != meshEdgeNameMap_.end(); ++eiter) {
+        edges.push_back(eiter->second);
+        isFaceEdge.push_back(false);
+    }
+    std::map<pwiFnvHash::FNVHash, MeshEdge*>::const_iterator feiter;
+    for (feiter = faceEdgeMap_.begin(); feiter != faceEdgeMap_.end(); ++feiter) {
+        edges.push_back(feiter->second);
+        isFaceEdge.push_back(true);
+    }
+    size_t i;
+    for (i = 0; i < edges.size(); ++i) {
+        const MeshEdge *edge = edges[i];
+        edge->getInds(inds, &numInds);
+        if (numInds < 2) { continue; }
+        numOwners = partition.getPartitions(inds, 2, owners);
+        for (n = 0; n < numOwners; ++n) {
+            MLINT part = owners[n];
+            MeshModel *model = getPart(part);
+            ParamVertex localPVs[2];
+            ParamVertex *pv1 = partition.getLocalParamVertex(part,
+                edge->paramVerts_[0], localPVs[0]);
+            ParamVertex *pv2 = partition.getLocalParamVertex(part,
+                edge->paramVerts_[1], localPVs[1]);
+            MLINT i1 = partition.getLocalIndex(part, inds[0]);
+            MLINT i2 = partition.getLocalIndex(part, inds[1]);
+            partition.addReferences(part, edge->gref_, edge->aref_);
+            if (isFaceEdge[i]) {
+                model->addFaceEdge(i1, i2, edge->mid_, edge->aref_, edge->gref_,
+                    pv1, pv2);
+            }
+            else {
+                std::string name = edge->name_;
+                model->addEdge(i1, i2, edge->mid_, edge->aref_, edge->gref_, name,
+                    pv1, pv2, isIDMapped(meshEdgeIDToNameMap_, edge));
+            }
+        }
+    }
+
+    // points, edge-points and face-edge-points belong to their owner
+    const std::map<pwiFnvHash::FNVHash, MeshPoint*> *pointMaps[3] =
+        { &pointMap_, &edgePointMap_, &faceEdgePointMap_ };
+    for (n = 0; n < 3; ++n) {
+        std::map<pwiFnvHash::FNVHash, MeshPoint*>::const_iterator piter;
+        for (piter = pointMaps[n]->begin(); piter != pointMaps[n]->end(); ++piter) {
+            const MeshPoint *point = piter->second;
+            MLINT part = partition.getPartition(point->i1_);
+            if (part < 0) { continue; }
+            MeshModel *model = getPart(part);
+            ParamVertex localPV;
+            ParamVertex *pv = partition.getLocalParamVertex(part,
+                point->paramVert_, localPV);
+            MLINT i1 = partition.getLocalIndex(part, point->i1_);
+            partition.addReferences(part, point->gref_, point->aref_);
+            if (0 == n) {
+                std::string name = point->name_;
+                model->addPoint(i1, point->mid_, point->aref_, point->gref_, name,
+                    pv, isIDMapped(meshPointIDToNameMap_, point));
+            }
+            else if (1 == n) {
+                model->addEdgePoint(i1, point->mid_, point->aref_, point->gref_, pv);
+            }
+            else {
+                model->addFaceEdgePoint(i1, point->mid_, point->aref_, point->gref_, pv);
+            }
+        }
+    }
+
+    // strings and sheets
+    std::vector<MeshString *> stringParts;
+    MeshStringNameMap::const_iterator mstrIter;
+    for (mstrIter = meshStringNameMap_.begin(); mstrIter != meshStringNameMap_.end(); ++mstrIter) {
+        const MeshString *meshString = mstrIter->second;
+        meshString->extractPartitions(partition, stringParts);
+        bool mapID = isIDMapped(meshStringIDToNameMap_, meshString);
+        for (i = 0; i < stringParts.size(); ++i) {
+            if (NULL != stringParts[i]) {
+                getPart((MLINT)i)->addMeshString(stringParts[i], mapID);
+            }
+        }
+    }
+    std::vector<MeshSheet *> sheetParts;
+    MeshSheetNameMap::const_iterator msIter;
+    for (msIter = meshSheetNameMap_.begin(); msIter != meshSheetNameMap_.end(); ++msIter) {
+        const MeshSheet *meshSheet = msIter->second;
+        meshSheet->extractPartitions(partition, sheetParts);
+        bool mapID = isIDMapped(meshSheetIDToNameMap_, meshSheet);
+        for (i = 0; i < sheetParts.size(); ++i) {
+            if (NULL != sheetParts[i]) {
+                getPart((MLINT)i)->addMeshSheet(sheetParts[i], mapID);
+            }
+        }
+    }
+
+    MLINT part;
+    for (part = 0; part < partition.getNumPartitions(); ++part) {
+        if (NULL != parts[part]) {
+            partition.addReferences(part, gref_, aref_);
+            extractParamVertices(partition, part, parts[part]);
+        }
+    }
+}
+
+
 /// \brief Find a MeshEdge by name
 MeshEdge *
 MeshModel::getMeshEdgeByName(const std::string &name) const
@@ -320,6 +786,10 @@ MeshModel::addPoint(MLINT i1,
     std::string &name,
     ParamVertex *pv1, bool mapID)
 {
+    MLINT values[] = { i1, mid, aref, gref };
+    if (!MeshTopo::checkIndexStorage(values, 4)) {
+        return false;
+    }
     if (NULL != findPointByInd(i1)) {
         // point already stored
         return true;
@@ -351,6 +821,10 @@ MeshModel::addPoint(
     std::string &name,
     ParamVertex *pv1, bool mapID)
 {
+    MLINT values[] = { mid, aref, gref };
+    if (!MeshTopo::checkIndexStorage(values, 3)) {
+        return false;
+    }
     MeshPoint *point = new MeshPoint(ref, mid, aref, gref, name, pv1);
     MeshTopo *existing = getMeshPointByName(point->name_);
     if (existing) {
@@ -423,6 +897,10 @@ MeshModel::addEdge(MLINT i1, MLINT i2,
     std::string &name,
     ParamVertex *pv1, ParamVertex *pv2, bool mapID)
 {
+    MLINT values[] = { i1, i2, mid, aref, gref };
+    if (!MeshTopo::checkIndexStorage(values, 5)) {
+        return false;
+    }
     if (NULL != findEdgeByInds(i1, i2)) {
         // edge already stored
         return true;
@@ -454,6 +932,10 @@ MeshModel::addEdge(
     std::string &name,
     ParamVertex *pv1, ParamVertex *pv2, bool mapID)
 {
+    MLINT values[] = { mid, aref, gref };
+    if (!MeshTopo::checkIndexStorage(values, 3)) {
+        return false;
+    }
     MeshEdge *edge = new MeshEdge(ref, mid, aref, gref, name, pv1, pv2);
     MeshTopo *existing = getMeshEdgeByName(edge->name_);
     if (existing) {
@@ -470,6 +952,35 @@ MeshModel::addEdge(
     return true;
 }
 
+bool
+MeshModel::addEdges(const MLINT *indices, size_t count,
+    MLINT mid,
+    MLINT aref,
+    MLINT gref,
+    std::string &name,
+    ParamVertex *const *paramVerts, bool mapID)
+{
+    MLINT values[] = { mid, aref, gref };
+    if (!MeshTopo::checkIndexStorage(values, 3)) {
+        return false;
+    }
+    bool result = true;
+    ParamVertex *const noParamVerts[2] = { NULL, NULL };
+    size_t e;
+    for (e = 0; e < count; ++e) {
+        const MLINT *inds = indices + 2 * e;
+        ParamVertex *const *pvs = (NULL == paramVerts) ? noParamVerts :
+            paramVerts + 2 * e;
+        addEdgePoint(inds[0], mid, aref, gref, pvs[0]);
+        addEdgePoint(inds[1], mid, aref, gref, pvs[1]);
+        if (!addEdge(inds[0], inds[1], mid, aref, gref, name,
+                pvs[0], pvs[1], mapID)) {
+            result = false;
+        }
+    }
+    return result;
+}
+
 void
 MeshModel::getMeshEdges(std::vector<const MeshEdge *> &edges) const
 {
@@ -491,6 +1002,10 @@ MeshModel::addEdgePoint(MLINT i1,
     MLINT gref,
     ParamVertex *pv1)
 {
+    MLINT values[] = { i1, mid, aref, gref };
+    if (!MeshTopo::checkIndexStorage(values, 4)) {
+        return;
+    }
     if (NULL != findEdgePointByInd(i1)) {
         // edge-point already stored
         return;
@@ -508,6 +1023,10 @@ MeshModel::addFaceEdgePoint(MLINT i1,
     MLINT gref,
     ParamVertex *pv1)
 {
+    MLINT values[] = { i1, mid, aref, gref };
+    if (!MeshTopo::checkIndexStorage(values, 4)) {
+        return;
+    }
     if (NULL != findFaceEdgePointByInd(i1)) {
         // face-edge-point already stored
         return;
@@ -736,6 +1255,10 @@ MeshModel::addFaceEdge(MLINT i1, MLINT i2,
     MLINT gref,
     ParamVertex *pv1, ParamVertex *pv2)
 {
+    MLINT values[] = { i1, i2, mid, aref, gref };
+    if (!MeshTopo::checkIndexStorage(values, 5)) {
+        return;
+    }
     if (NULL != findFaceEdgeByInds(i1, i2)) {
         // face-edge already stored
         return;
@@ -899,6 +1422,10 @@ MeshModel::addFace(MLINT i1, MLINT i2, MLINT i3,
     std::string &name,
     ParamVertex *pv1, ParamVertex *pv2, ParamVertex *pv3, bool mapID)
 {
+    MLINT values[] = { i1, i2, i3, mid, aref, gref };
+    if (!MeshTopo::checkIndexStorage(values, 6)) {
+        return false;
+    }
     if (NULL != findFaceByInds(i1, i2, i3)) {
         // face already exists
         return true;
@@ -929,6 +1456,10 @@ MeshModel::addFace(
     std::string &name,
     ParamVertex *pv1, ParamVertex *pv2, ParamVertex *pv3, bool mapID)
 {
+    MLINT values[] = { mid, aref, gref };
+    if (!MeshTopo::checkIndexStorage(values, 3)) {
+        return false;
+    }
     MeshFace *face = new MeshFace(ref, mid, aref,
         gref, name, pv1, pv2, pv3);
 
@@ -960,6 +1491,10 @@ MeshModel::addFace(MLINT i1, MLINT i2, MLINT i3, MLINT i4,
     ParamVertex *pv1, ParamVertex *pv2, ParamVertex *pv3, ParamVertex *pv4,
     bool mapID)
 {
+    MLINT values[] = { i1, i2, i3, i4, mid, aref, gref };
+    if (!MeshTopo::checkIndexStorage(values, 7)) {
+        return false;
+    }
     if (NULL != findFaceByInds(i1, i2, i3, i4)) {
         // face already exists
         return true;
@@ -991,6 +1526,10 @@ MeshModel::addFace(
     ParamVertex *pv1, ParamVertex *pv2, ParamVertex *pv3, ParamVertex *pv4,
     bool mapID)
 {
+    MLINT values[] = { mid, aref, gref };
+    if (!MeshTopo::checkIndexStorage(values, 3)) {
+        return false;
+    }
     MeshFace *face = new MeshFace(ref, mid, aref,
         gref, name, pv1, pv2, pv3, pv4);
     MeshTopo *existing = getMeshFaceByName(face->name_);
@@ -1011,6 +1550,49 @@ MeshModel::addFace(
     return true;
 }
 
+bool
+MeshModel::addFaces(const MLINT *indices, size_t count, int pointsPerFace,
+    MLINT mid,
+    MLINT aref,
+    MLINT gref,
+    std::string &name,
+    ParamVertex *const *paramVerts, bool mapID)
+{
+    if (3 != pointsPerFace && 4 != pointsPerFace) {
+        return false;
+    }
+    MLINT values[] = { mid, aref, gref };
+    if (!MeshTopo::checkIndexStorage(values, 3)) {
+        return false;
+    }
+    bool result = true;
+    ParamVertex *const noParamVerts[4] = { NULL, NULL, NULL, NULL };
+    size_t f;
+    for (f = 0; f < count; ++f) {
+        const MLINT *inds = indices + f * pointsPerFace;
+        ParamVertex *const *pvs = (NULL == paramVerts) ? noParamVerts :
+            paramVerts + f * pointsPerFace;
+        int n;
+        for (n = 0; n < pointsPerFace; ++n) {
+            int next = (n + 1) % pointsPerFace;
+            addFaceEdge(inds[n], inds[next], mid, aref, gref,
+                pvs[n], pvs[next]);
+        }
+        for (n = 0; n < pointsPerFace; ++n) {
+            addFaceEdgePoint(inds[n], mid, aref, gref, pvs[n]);
+        }
+        bool added = (3 == pointsPerFace) ?
+            addFace(inds[0], inds[1], inds[2], mid, aref, gref, name,
+                pvs[0], pvs[1], pvs[2], mapID) :
+            addFace(inds[0], inds[1], inds[2], inds[3], mid, aref, gref, name,
+                pvs[0], pvs[1], pvs[2], pvs[3], mapID);
+        if (!added) {
+            result = false;
+        }
+    }
+    return result;
+}
+
 void
 MeshModel::getMeshFaces(std::vector<const MeshFace *> &faces) const
 {
@@ -84,6 +84,133 @@ MeshSheet::~MeshSheet()
 }
 
 
+void
+MeshSheet::remapReferences(MLINT indexOffset,
+    const MeshTopoIDRemap &gidRemap, const MeshTopoIDRemap &attidRemap)
+{
+    MeshTopo::remapReferences(indexOffset, gidRemap, attidRemap);
+
+    // Entities are remapped in place, hash maps are rebuilt
+    // from the new point indices
+    std::map<pwiFnvHash::FNVHash, MeshPoint*> pointMap;
+    std::map<pwiFnvHash::FNVHash, MeshPoint*>::iterator piter;
+    for (piter = pointMap_.begin(); piter != pointMap_.end(); ++piter) {
+        MeshPoint *point = piter->second;
+        point->remapReferences(indexOffset, gidRemap, attidRemap);
+        pointMap[point->getHash()] = point;
+    }
+    pointMap_.swap(pointMap);
+
+    std::map<pwiFnvHash::FNVHash, MeshEdge*> faceEdgeMap;
+    std::map<pwiFnvHash::FNVHash, MeshEdge*>::iterator eiter;
+    for (eiter = faceEdgeMap_.begin(); eiter != faceEdgeMap_.end(); ++eiter) {
+        MeshEdge *edge = eiter->second;
+        edge->remapReferences(indexOffset, gidRemap, attidRemap);
+        faceEdgeMap[edge->getHash()] = edge;
+    }
+    faceEdgeMap_.swap(faceEdgeMap);
+
+    // face name map includes faces without point indices
+    MeshFaceNameMap::iterator nameIter;
+    for (nameIter = meshFaceNameMap_.begin(); nameIter != meshFaceNameMap_.end(); ++nameIter) {
+        nameIter->second->remapReferences(indexOffset, gidRemap, attidRemap);
+    }
+    std::map<pwiFnvHash::FNVHash, MeshFace*> faceMap;
+    std::map<pwiFnvHash::FNVHash, MeshFace*>::iterator fiter;
+    for (fiter = faceMap_.begin(); fiter != faceMap_.end(); ++fiter) {
+        faceMap[fiter->second->getHash()] = fiter->second;
+    }
+    faceMap_.swap(faceMap);
+}
+
+
+void
+MeshSheet::extractPartitions(MeshPointPartition &partition,
+    std::vector<MeshSheet *> &parts) const
+{
+    parts.assign((size_t)partition.getNumPartitions(), NULL);
+
+    // Faces in creation order; a face belongs to every partition owning
+    // one of its points. Faces defined only by reference are not copied.
+    std::vector<const MeshFace *> faces;
+    getMeshFaces(faces);
+    size_t i;
+    for (i = 0; i < faces.size(); ++i) {
+        const MeshFace *face = faces[i];
+        MLINT inds[4];
+        MLINT numInds;
+        face->getInds(inds, &numInds);
+        if (numInds < 3) { continue; }
+        MLINT owners[4];
+        int numOwners = partition.getPartitions(inds, (int)numInds, owners);
+        int n;
+        for (n = 0; n < numOwners; ++n) {
+            MLINT part = owners[n];
+            if (NULL == parts[part]) {
+                parts[part] = new MeshSheet(ref_, mid_, aref_, gref_, name_);
+            }
+            MLINT local[4];
+            ParamVertex localPVs[4];
+            ParamVertex *pvs[4];
+            int j;
+            for (j = 0; j < 4; ++j) {
+                local[j] = (j < numInds) ?
+                    partition.getLocalIndex(part, inds[j]) : MESH_TOPO_INDEX_UNUSED;
+                pvs[j] = partition.getLocalParamVertex(part, face->paramVerts_[j],
+                    localPVs[j]);
+            }
+            partition.addReferences(part, face->gref_, face->aref_);
+            bool mapID = isIDMapped(meshFaceIDToNameMap_, face);
+            if (3 == numInds) {
+                parts[part]->addFace(local[0], local[1], local[2],
+                    face->mid_, face->aref_, face->gref_, face->name_,
+                    pvs[0], pvs[1], pvs[2], mapID);
+            }
+            else {
+                parts[part]->addFace(local[0], local[1], local[2], local[3],
+                    face->mid_, face->aref_, face->gref_, face->name_,
+                    pvs[0], pvs[1], pvs[2], pvs[3], mapID);
+            }
+        }
+    }
+
+    // Face-edges of the faces copied above
+    std::vector<const MeshEdge *> edges;
+    getFaceEdges(edges);
+    for (i = 0; i < edges.size(); ++i) {
+        const MeshEdge *edge = edges[i];
+        MLINT inds[2];
+        MLINT numInds;
+        edge->getInds(inds, &numInds);
+        if (numInds < 2) { continue; }
+        MLINT owners[2];
+        int numOwners = partition.getPartitions(inds, 2, owners);
+        int n;
+        for (n = 0; n < numOwners; ++n) {
+            MLINT part = owners[n];
+            if (NULL == parts[part]) { continue; }
+            ParamVertex localPVs[2];
+            ParamVertex *pv1 = partition.getLocalParamVertex(part,
+                edge->paramVerts_[0], localPVs[0]);
+            ParamVertex *pv2 = partition.getLocalParamVertex(part,
+                edge->paramVerts_[1], localPVs[1]);
+            partition.addReferences(part, edge->gref_, edge->aref_);
+            parts[part]->addFaceEdge(partition.getLocalIndex(part, inds[0]),
+                partition.getLocalIndex(part, inds[1]),
+                edge->mid_, edge->aref_, edge->gref_, pv1, pv2);
+        }
+    }
+
+    MLINT part;
+    for (part = 0; part < partition.getNumPartitions(); ++part) {
+        if (NULL != parts[part]) {
+            partition.addReferences(part, gref_, aref_);
+            extractParamVertices(partition, part, parts[part]);
+        }
+    }
+}
+
+
 // Find a face-edge in the associativity data
 MeshEdge *
 MeshSheet::findFaceEdgeByInds(MLINT i1, MLINT i2) const
@@ -127,6 +254,10 @@ MeshSheet::addFaceEdge(MLINT i1, MLINT i2,
     MLINT gref,
     ParamVertex *pv1, ParamVertex *pv2)
 {
+    MLINT values[] = { i1, i2, mid, aref, gref };
+    if (!MeshTopo::checkIndexStorage(values, 5)) {
+        return;
+    }
     if (NULL != findFaceEdgeByInds(i1, i2)) {
         // face-edge already exists
         return;
@@ -153,6 +284,10 @@ MeshSheet::addFace(MLINT i1, MLINT i2, MLINT i3,
     const std::string &name,
     ParamVertex *pv1, ParamVertex *pv2, ParamVertex *pv3, bool mapID)
 {
+    MLINT values[] = { i1, i2, i3, mid, aref, gref };
+    if (!MeshTopo::checkIndexStorage(values, 6)) {
+        return false;
+    }
     if (NULL != findFaceByInds(i1, i2, i3)) {
         // face already exists
         return true;
@@ -185,6 +320,10 @@ MeshSheet::addFace(
     const std::string &name,
     ParamVertex *pv1, ParamVertex *pv2, ParamVertex *pv3, bool mapID)
 {
+    MLINT values[] = { mid, aref, gref };
+    if (!MeshTopo::checkIndexStorage(values, 3)) {
+        return false;
+    }
     MeshFace *face = new MeshFace(ref, mid, aref,
         gref, name, pv1, pv2, pv3);
     MeshTopo *existing = getMeshFaceByName(face->name_);
@@ -219,6 +358,10 @@ MeshSheet::addFace(MLINT i1, MLINT i2, MLINT i3, MLINT i4,
     ParamVertex *pv1, ParamVertex *pv2, ParamVertex *pv3, ParamVertex *pv4,
     bool mapID)
 {
+    MLINT values[] = { i1, i2, i3, i4, mid, aref, gref };
+    if (!MeshTopo::checkIndexStorage(values, 7)) {
+        return false;
+    }
     if (NULL != findFaceByInds(i1, i2, i3, i4)) {
         // face already exists
         return true;
@@ -252,6 +395,10 @@ MeshSheet::addFace(
     ParamVertex *pv1, ParamVertex *pv2, ParamVertex *pv3, ParamVertex *pv4,
     bool mapID)
 {
+    MLINT values[] = { mid, aref, gref };
+    if (!MeshTopo::checkIndexStorage(values, 3)) {
+        return false;
+    }
     MeshFace *face = new MeshFace(ref, mid, aref,
         gref, name, pv1, pv2, pv3, pv4);
     MeshTopo *existing = getMeshFaceByName(face->name_);
@@ -276,6 +423,46 @@ MeshSheet::addFace(
     return true;
 }
 
+bool
+MeshSheet::addFaces(const MLINT *indices, size_t count, int pointsPerFace,
+    MLINT mid,
+    MLINT aref,
+    MLINT gref,
+    const std::string &name,
+    ParamVertex *const *paramVerts, bool mapID)
+{
+    if (3 != pointsPerFace && 4 != pointsPerFace) {
+        return false;
+    }
+    MLINT values[] = { mid, aref, gref };
+    if (!MeshTopo::checkIndexStorage(values, 3)) {
+        return false;
+    }
+    bool result = true;
+    ParamVertex *const noParamVerts[4] = { NULL, NULL, NULL, NULL };
+    size_t f;
+    for (f = 0; f < count; ++f) {
+        const MLINT *inds = indices + f * pointsPerFace;
+        ParamVertex *const *pvs = (NULL == paramVerts) ? noParamVerts :
+            paramVerts + f * pointsPerFace;
+        int n;
+        for (n = 0; n < pointsPerFace; ++n) {
+            int next = (n + 1) % pointsPerFace;
+            addFaceEdge(inds[n], inds[next], mid, aref, gref,
+                pvs[n], pvs[next]);
+        }
+        bool added = (3 == pointsPerFace) ?
+            addFace(inds[0], inds[1], inds[2], mid, aref, gref, name,
+                pvs[0], pvs[1], pvs[2], mapID) :
+            addFace(inds[0], inds[1], inds[2], inds[3], mid, aref, gref, name,
+                pvs[0], pvs[1], pvs[2], pvs[3], mapID);
+        if (!added) {
+            result = false;
+        }
+    }
+    return result;
+}
+
 
 // Find a face in the associativity data
 MeshFace *
@@ -389,6 +576,25 @@ MeshSheet::getMeshFaces(std::vector<const MeshFace *> &faces) const
     return;
 }
 
+
+void
+MeshSheet::reorderEntities(MeshTopoOrderKeyFunc keyFunc, void *userData)
+{
+    std::vector<MeshTopo *> entities;
+    MeshFaceNameMap::iterator fiter;
+    for (fiter = meshFaceNameMap_.begin(); fiter != meshFaceNameMap_.end(); ++fiter) {
+        entities.push_back(fiter->second);
+    }
+    faceCounter_ = reorderByKey(entities, keyFunc, userData);
+
+    entities.clear();
+    std::map<pwiFnvHash::FNVHash, MeshEdge*>::iterator eiter;
+    for (eiter = faceEdgeMap_.begin(); eiter != faceEdgeMap_.end(); ++eiter) {
+        entities.push_back(eiter->second);
+    }
+    faceEdgeCounter_ = reorderByKey(entities, keyFunc, userData);
+}
+
 /****************************************************************************
  *
  * This file is licensed under the Cadence Public License Version 1.0 (the
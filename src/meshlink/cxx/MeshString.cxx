@@ -75,6 +75,85 @@ MeshString::~MeshString()
     }
 }
 
+
+void
+MeshString::remapReferences(MLINT indexOffset,
+    const MeshTopoIDRemap &gidRemap, const MeshTopoIDRemap &attidRemap)
+{
+    MeshTopo::remapReferences(indexOffset, gidRemap, attidRemap);
+
+    // Entities are remapped in place, hash maps are rebuilt
+    // from the new point indices
+    std::map<pwiFnvHash::FNVHash, MeshPoint*> pointMap;
+    std::map<pwiFnvHash::FNVHash, MeshPoint*>::iterator piter;
+    for (piter = pointMap_.begin(); piter != pointMap_.end(); ++piter) {
+        MeshPoint *point = piter->second;
+        point->remapReferences(indexOffset, gidRemap, attidRemap);
+        pointMap[point->getHash()] = point;
+    }
+    pointMap_.swap(pointMap);
+
+    // edge name map includes edges without point indices
+    MeshEdgeNameMap::iterator nameIter;
+    for (nameIter = meshEdgeNameMap_.begin(); nameIter != meshEdgeNameMap_.end(); ++nameIter) {
+        nameIter->second->remapReferences(indexOffset, gidRemap, attidRemap);
+    }
+    std::map<pwiFnvHash::FNVHash, MeshEdge*> edgeMap;
+    std::map<pwiFnvHash::FNVHash, MeshEdge*>::iterator eiter;
+    for (eiter = edgeMap_.begin(); eiter != edgeMap_.end(); ++eiter) {
+        edgeMap[eiter->second->getHash()] = eiter->second;
+    }
+    edgeMap_.swap(edgeMap);
+}
+
+
+void
+MeshString::extractPartitions(MeshPointPartition &partition,
+    std::vector<MeshString *> &parts) const
+{
+    parts.assign((size_t)partition.getNumPartitions(), NULL);
+
+    // Edges in creation order; an edge belongs to every partition owning
+    // one of its points. Edges defined only by reference are not copied.
+    std::vector<const MeshEdge *> edges;
+    getMeshEdges(edges);
+    size_t i;
+    for (i = 0; i < edges.size(); ++i) {
+        const MeshEdge *edge = edges[i];
+        MLINT inds[2];
+        MLINT numInds;
+        edge->getInds(inds, &numInds);
+        if (numInds < 2) { continue; }
+        MLINT owners[2];
+        int numOwners = partition.getPartitions(inds, 2, owners);
+        int n;
+        for (n = 0; n < numOwners; ++n) {
+            MLINT part = owners[n];
+            if (NULL == parts[part]) {
+                parts[part] = new MeshString(ref_, mid_, aref_, gref_, name_);
+            }
+            ParamVertex localPVs[2];
+            ParamVertex *pv1 = partition.getLocalParamVertex(part,
+                edge->paramVerts_[0], localPVs[0]);
+            ParamVertex *pv2 = partition.getLocalParamVertex(part,
+                edge->paramVerts_[1], localPVs[1]);
+            partition.addReferences(part, edge->gref_, edge->aref_);
+            parts[part]->addEdge(partition.getLocalIndex(part, inds[0]),
+                partition.getLocalIndex(part, inds[1]),
+                edge->mid_, edge->aref_, edge->gref_, edge->name_, pv1, pv2,
+                isIDMapped(meshEdgeIDToNameMap_, edge));
+        }
+    }
+
+    MLINT part;
+    for (part = 0; part < partition.getNumPartitions(); ++part) {
+        if (NULL != parts[part]) {
+            partition.addReferences(part, gref_, aref_);
+            extractParamVertices(partition, part, parts[part]);
+        }
+    }
+}
+
 // Add an edge to the associativity data
 bool
 MeshString::addEdge(MLINT i1, MLINT i2,
@@ -84,6 +163,10 @@ MeshString::addEdge(MLINT i1, MLINT i2,
     const std::string &name,
     ParamVertex *pv1, ParamVertex *pv2, bool mapID)
 {
+    MLINT values[] = { i1, i2, mid, aref, gref };
+    if (!MeshTopo::checkIndexStorage(values, 5)) {
+        return false;
+    }
     if (NULL != findEdgeByInds(i1, i2)) {
         // edge already exists
         return true;
@@ -116,6 +199,10 @@ MeshString::addEdge(
     const std::string &name,
     ParamVertex *pv1, ParamVertex *pv2, bool mapID)
 {
+    MLINT values[] = { mid, aref, gref };
+    if (!MeshTopo::checkIndexStorage(values, 3)) {
+        return false;
+    }
     MeshEdge *edge = new MeshEdge(ref, mid, aref,
         gref, name, pv1, pv2);
     MeshTopo *existing = getMeshEdgeByName(edge->name_);
@@ -138,6 +225,32 @@ MeshString::addEdge(
     return true;
 }
 
+bool
+MeshString::addEdges(const MLINT *indices, size_t count,
+    MLINT mid,
+    MLINT aref,
+    MLINT gref,
+    const std::string &name,
+    ParamVertex *const *paramVerts, bool mapID)
+{
+    MLINT values[] = { mid, aref, gref };
+    if (!MeshTopo::checkIndexStorage(values, 3)) {
+        return false;
+    }
+    bool result = true;
+    size_t e;
+    for (e = 0; e < count; ++e) {
+        const MLINT *inds = indices + 2 * e;
+        ParamVertex *pv1 = (NULL == paramVerts) ? NULL : paramVerts[2 * e];
+        ParamVertex *pv2 = (NULL == paramVerts) ? NULL : paramVerts[2 * e + 1];
+        if (!addEdge(inds[0], inds[1], mid, aref, gref, name, pv1, pv2,
+                mapID)) {
+            result = false;
+        }
+    }
+    return result;
+}
+
 
 // Find an edge in the associativity data
 MeshEdge *
@@ -232,6 +345,18 @@ MeshString::getMeshEdges(std::vector<const MeshEdge *> &edges) const
     return;
 }
 
+
+void
+MeshString::reorderEntities(MeshTopoOrderKeyFunc keyFunc, void *userData)
+{
+    std::vector<MeshTopo *> entities;
+    MeshEdgeNameMap::iterator eiter;
+    for (eiter = meshEdgeNameMap_.begin(); eiter != meshEdgeNameMap_.end(); ++eiter) {
+        entities.push_back(eiter->second);
+    }
+    edgeCounter_ = reorderByKey(entities, keyFunc, userData);
+}
+
 /****************************************************************************
  *
  * This file is licensed under the Cadence Public License Version 1.0 (the
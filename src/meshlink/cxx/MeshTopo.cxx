@@ -12,7 +12,9 @@
 #include "MeshTopo.h"
 
 #include <iostream>
+#include <mutex>
 #include <sstream>
+#include <stdlib.h>
 
 
 /****************************************************************************
@@ -51,6 +53,19 @@ pwiFnvHash::hash(MLINT data, FNVHash hash) {
     return hash;
 }
 
+/****************************************************************************
+ * ParamVertex class
+ ***************************************************************************/
+ParamVertex::ParamVertex(const std::string & vref, MLINT gref, MLINT mid,
+    MLREAL u, MLREAL v) :
+    vref_(vref),
+    gref_(MeshTopo::checkedIndexValue(gref)),
+    mid_(MeshTopo::checkedIndexValue(mid)),
+    u_(u),
+    v_(v)
+{
+}
+
 /****************************************************************************
  * MeshTopo Base Class
  ***************************************************************************/
@@ -68,9 +83,9 @@ MeshTopo::MeshTopo(
     MLINT aref,
     MLINT gref,
     const std::string &name) :
-    mid_(mid),
-    aref_(aref),
-    gref_(gref),
+    mid_(checkedIndexValue(mid)),
+    aref_(checkedIndexValue(aref)),
+    gref_(checkedIndexValue(gref)),
     name_(name)
 {
     if (name_.empty() && !ref_.empty()) {
@@ -85,9 +100,9 @@ MeshTopo::MeshTopo(
     MLINT gref,
     const std::string &name) :
     ref_(ref),
-    mid_(mid),
-    aref_(aref),
-    gref_(gref),
+    mid_(checkedIndexValue(mid)),
+    aref_(checkedIndexValue(aref)),
+    gref_(checkedIndexValue(gref)),
     name_(name)
 {
     if (name_.empty() && !ref_.empty()) {
@@ -107,10 +122,17 @@ MeshTopo::~MeshTopo() {
 std::string 
 MeshTopo::getNextName()
 {
+    // name counters are shared by all MeshAssociativity objects, which
+    // may be populated concurrently (e.g. MeshLink files read in parallel)
+    static std::mutex counterMutex;
     std::string basename = getBaseName();
-    MLUINT &counter = getNameCounter();
-    counter++;
-    std::ostringstream s;  s << counter;
+    MLUINT count;
+    {
+        std::lock_guard<std::mutex> lock(counterMutex);
+        MLUINT &counter = getNameCounter();
+        count = ++counter;
+    }
+    std::ostringstream s;  s << count;
     std::string name = basename + s.str();
     return name;
 }
@@ -228,12 +250,24 @@ MeshTopo::getRef() const
 }
 
 
-void
-MeshTopo::setID( MLINT id ) { mid_ = id;  }
-void
-MeshTopo::setGref( MLINT gref ) { gref_ = gref;  }
-void
-MeshTopo::setAref( MLINT aref ) { aref_ = aref; }
+bool
+MeshTopo::setID( MLINT id ) {
+    if (!checkIndexStorage(&id, 1)) { return false; }
+    mid_ = id;
+    return true;
+}
+bool
+MeshTopo::setGref( MLINT gref ) {
+    if (!checkIndexStorage(&gref, 1)) { return false; }
+    gref_ = gref;
+    return true;
+}
+bool
+MeshTopo::setAref( MLINT aref ) {
+    if (!checkIndexStorage(&aref, 1)) { return false; }
+    aref_ = aref;
+    return true;
+}
 void
 MeshTopo::setName(const std::string &name) { 
     if (name.empty()) {
@@ -309,6 +343,300 @@ MeshTopo::OrderCompare(const MeshTopo *topo1, const MeshTopo *topo2)
     return (topo1->getOrderCounter() < topo2->getOrderCounter());
 }
 
+MLUINT
+MeshTopo::PointIndexOrderKey(const MeshTopo *topo, void *)
+{
+    MLINT inds[4];
+    MLINT numInds = 0;
+    const MeshFace *face;
+    const MeshEdge *edge;
+    if (NULL != (face = dynamic_cast<const MeshFace *>(topo))) {
+        face->getInds(inds, &numInds);
+    }
+    else if (NULL != (edge = dynamic_cast<const MeshEdge *>(topo))) {
+        edge->getInds(inds, &numInds);
+    }
+    if (0 == numInds) {
+        return (MLUINT)-1;
+    }
+    return (MLUINT)*std::min_element(inds, inds + numInds);
+}
+
+MLUINT
+MeshTopo::reorderByKey(std::vector<MeshTopo *> &entities,
+    MeshTopoOrderKeyFunc keyFunc, void *userData)
+{
+    std::sort(entities.begin(), entities.end(), OrderCompare);
+    if (NULL != keyFunc) {
+        // compute each key once
+        std::vector<std::pair<MLUINT, MeshTopo *> > keyed(entities.size());
+        size_t i;
+        for (i = 0; i < entities.size(); ++i) {
+            keyed[i] = std::make_pair(keyFunc(entities[i], userData), entities[i]);
+        }
+        std::stable_sort(keyed.begin(), keyed.end(),
+            [](const std::pair<MLUINT, MeshTopo *> &a,
+               const std::pair<MLUINT, MeshTopo *> &b) { return a.first < b.first; });
+        for (i = 0; i < keyed.size(); ++i) {
+            entities[i] = keyed[i].second;
+        }
+    }
+    MLUINT counter;
+    for (counter = 0; counter < entities.size(); ++counter) {
+        entities[counter]->setOrderCounter(counter);
+    }
+    return counter;
+}
+
+MLINT
+MeshTopo::remapID(MLINT id, const MeshTopoIDRemap &remap)
+{
+    MeshTopoIDRemap::const_iterator iter = remap.find(id);
+    if (iter != remap.end()) {
+        return iter->second;
+    }
+    return id;
+}
+
+std::string
+MeshTopo::offsetVref(const std::string &vref, MLINT indexOffset)
+{
+    if (0 == indexOffset || vref.empty()) {
+        return vref;
+    }
+    // only integer vrefs (point indices) are offset
+    char *end = NULL;
+    MLINT ind = (MLINT)strtoll(vref.c_str(), &end, 10);
+    if (NULL == end || '\0' != *end) {
+        return vref;
+    }
+    std::ostringstream s;  s << (ind + indexOffset);
+    return s.str();
+}
+
+void
+MeshTopo::remapParamVertex(ParamVertex *pv, MLINT indexOffset,
+    const MeshTopoIDRemap &gidRemap)
+{
+    if (NULL == pv) { return; }
+    pv->vref_ = offsetVref(pv->vref_, indexOffset);
+    pv->gref_ = remapID(pv->gref_, gidRemap);
+}
+
+void
+MeshTopo::remapReferences(MLINT indexOffset,
+    const MeshTopoIDRemap &gidRemap, const MeshTopoIDRemap &attidRemap)
+{
+    gref_ = remapID(gref_, gidRemap);
+    aref_ = remapID(aref_, attidRemap);
+
+    // ParamVertex objects are keyed by vref, rebuild the maps
+    ParamVertVrefMap vrefMap;
+    ParamVertVrefMap::iterator pviter;
+    for (pviter = paramVertVrefMap_.begin(); pviter != paramVertVrefMap_.end(); ++pviter) {
+        ParamVertex *pv = pviter->second;
+        remapParamVertex(pv, indexOffset, gidRemap);
+        vrefMap[pv->getVref()] = pv;
+    }
+    paramVertVrefMap_.swap(vrefMap);
+
+    ParamVertIDToVrefMap::iterator iditer;
+    for (iditer = paramVertIDToVrefMap_.begin(); iditer != paramVertIDToVrefMap_.end(); ++iditer) {
+        iditer->second = offsetVref(iditer->second, indexOffset);
+    }
+}
+
+void
+MeshTopo::extractParamVertices(MeshPointPartition &partition, MLINT part,
+    MeshTopo *partTopo) const
+{
+    ParamVertVrefMap::const_iterator pviter;
+    for (pviter = paramVertVrefMap_.begin(); pviter != paramVertVrefMap_.end(); ++pviter) {
+        const ParamVertex *pv = pviter->second;
+        char *end = NULL;
+        MLINT globalIndex = (MLINT)strtoll(pv->getVref().c_str(), &end, 10);
+        MLINT localIndex;
+        if (pv->getVref().empty() || NULL == end || '\0' != *end ||
+            !partition.findLocalIndex(part, globalIndex, &localIndex)) {
+            continue;
+        }
+        ParamVertIDToVrefMap::const_iterator iditer =
+            paramVertIDToVrefMap_.find(pv->getID());
+        bool mapID = (iditer != paramVertIDToVrefMap_.end() &&
+            iditer->second == pv->getVref());
+        ParamVertex localPV;
+        partition.getLocalParamVertex(part, pv, localPV);
+        partTopo->addParamVertex(new ParamVertex(localPV), mapID);
+    }
+}
+
+bool
+MeshTopo::checkIndexStorage(const MLINT *values, int numValues)
+{
+#if defined(ML_COMPACT_INDICES)
+    for (int n = 0; n < numValues; ++n) {
+        if (values[n] != (MLINT)(MeshTopoIndex)values[n]) {
+            std::cout << "Error: value " << values[n] <<
+                " exceeds the compact index storage range" << std::endl;
+            return false;
+        }
+    }
+#else
+    (void)values;
+    (void)numValues;
+#endif
+    return true;
+}
+
+MLINT
+MeshTopo::checkedIndexValue(MLINT value)
+{
+    return checkIndexStorage(&value, 1) ? value : MESH_TOPO_INVALID_REF;
+}
+
+bool
+MeshTopo::isIDMapped(const std::map<MLINT, std::string> &idToNameMap,
+    const MeshTopo *topo)
+{
+    std::map<MLINT, std::string>::const_iterator iter = idToNameMap.find(topo->mid_);
+    return (iter != idToNameMap.end() && iter->second == topo->name_);
+}
+
+
+/***************************************************************************
+ * Mesh Point Partition Class
+ ***************************************************************************/
+MeshPointPartition::MeshPointPartition(
+    const std::vector<MLINT> &pointPartition,
+    MLINT numPartitions) :
+    pointPartition_(pointPartition),
+    numPartitions_(numPartitions > 0 ? numPartitions : 0),
+    ownedLocalIndex_(pointPartition.size(), MESH_TOPO_INDEX_UNUSED),
+    localToGlobal_(numPartitions_),
+    haloLocalIndex_(numPartitions_),
+    grefs_(numPartitions_),
+    arefs_(numPartitions_)
+{
+    // owned points are numbered first, in global index order
+    size_t i;
+    for (i = 0; i < pointPartition_.size(); ++i) {
+        MLINT partition = pointPartition_[i];
+        if (partition >= 0 && partition < numPartitions_) {
+            localToGlobal_[partition].push_back((MLINT)i);
+            ownedLocalIndex_[i] = (MLINT)localToGlobal_[partition].size();
+        }
+    }
+}
+
+MLINT
+MeshPointPartition::getPartition(MLINT globalIndex) const
+{
+    if (globalIndex < 0 || globalIndex >= (MLINT)pointPartition_.size()) {
+        return -1;
+    }
+    MLINT partition = pointPartition_[globalIndex];
+    if (partition < 0 || partition >= numPartitions_) {
+        return -1;
+    }
+    return partition;
+}
+
+int
+MeshPointPartition::getPartitions(const MLINT *inds, int numInds,
+    MLINT *partitions) const
+{
+    int count = 0;
+    int i;
+    for (i = 0; i < numInds; ++i) {
+        MLINT partition = getPartition(inds[i]);
+        if (partition < 0 ||
+            std::find(partitions, partitions + count, partition) != partitions + count) {
+            continue;
+        }
+        partitions[count++] = partition;
+    }
+    return count;
+}
+
+MLINT
+MeshPointPartition::getLocalIndex(MLINT partition, MLINT globalIndex)
+{
+    MLINT localIndex;
+    if (findLocalIndex(partition, globalIndex, &localIndex)) {
+        return localIndex;
+    }
+    // halo point, numbered after owned points in order of first use
+    localToGlobal_[partition].push_back(globalIndex);
+    localIndex = (MLINT)localToGlobal_[partition].size();
+    haloLocalIndex_[partition][globalIndex] = localIndex;
+    return localIndex;
+}
+
+bool
+MeshPointPartition::findLocalIndex(MLINT partition, MLINT globalIndex,
+    MLINT *localIndex) const
+{
+    if (getPartition(globalIndex) == partition) {
+        *localIndex = ownedLocalIndex_[globalIndex];
+        return true;
+    }
+    std::map<MLINT, MLINT>::const_iterator iter =
+        haloLocalIndex_[partition].find(globalIndex);
+    if (iter == haloLocalIndex_[partition].end()) {
+        return false;
+    }
+    *localIndex = iter->second;
+    return true;
+}
+
+ParamVertex *
+MeshPointPartition::getLocalParamVertex(MLINT partition,
+    const ParamVertex *pv, ParamVertex &localPV)
+{
+    if (NULL == pv) { return NULL; }
+    std::string vref = pv->getVref();
+    char *end = NULL;
+    MLINT globalIndex = (MLINT)strtoll(vref.c_str(), &end, 10);
+    if (!vref.empty() && NULL != end && '\0' == *end) {
+        std::ostringstream s;  s << getLocalIndex(partition, globalIndex);
+        vref = s.str();
+    }
+    MLREAL u, v;
+    pv->getUV(&u, &v);
+    localPV = ParamVertex(vref, pv->getGref(), pv->getID(), u, v);
+    addReferences(partition, pv->getGref(), MESH_TOPO_INVALID_REF);
+    return &localPV;
+}
+
+void
+MeshPointPartition::addReferences(MLINT partition, MLINT gref, MLINT aref)
+{
+    if (MESH_TOPO_INVALID_REF != gref) {
+        grefs_[partition].insert(gref);
+    }
+    if (MESH_TOPO_INVALID_REF != aref) {
+        arefs_[partition].insert(aref);
+    }
+}
+
+const std::set<MLINT> &
+MeshPointPartition::getGrefs(MLINT partition) const
+{
+    return grefs_[partition];
+}
+
+const std::set<MLINT> &
+MeshPointPartition::getArefs(MLINT partition) const
+{
+    return arefs_[partition];
+}
+
+const std::vector<MLINT> &
+MeshPointPartition::getLocalToGlobal(MLINT partition) const
+{
+    return localToGlobal_[partition];
+}
+
 
 /***************************************************************************
  * Mesh Point Class
@@ -335,7 +663,7 @@ MeshPoint::MeshPoint(MLINT i1,
     ParamVertex *pv1
 ) :
     MeshTopo(mid, aref, gref, name),
-    i1_(i1)
+    i1_(checkedIndexValue(i1))
 {
     // name arg is allowed to be empty, setName ensures a unique name
     setName(name);
@@ -387,6 +715,17 @@ MeshPoint::getHash() const {
     return computeHash(i1_);
 }
 
+void
+MeshPoint::remapReferences(MLINT indexOffset,
+    const MeshTopoIDRemap &gidRemap, const MeshTopoIDRemap &attidRemap)
+{
+    MeshTopo::remapReferences(indexOffset, gidRemap, attidRemap);
+    if (i1_ != MESH_TOPO_INDEX_UNUSED) {
+        i1_ += indexOffset;
+    }
+    remapParamVertex(paramVert_, indexOffset, gidRemap);
+}
+
 
 /****************************************************************************
  * Mesh Edge Class
@@ -412,8 +751,8 @@ MeshEdge::MeshEdge(MLINT i1, MLINT i2,
     const std::string &name,
     ParamVertex *pv1, ParamVertex *pv2) :
     MeshTopo(mid, aref, gref, name),
-    i1_(i1),
-    i2_(i2)
+    i1_(checkedIndexValue(i1)),
+    i2_(checkedIndexValue(i2))
 {
     // name arg is allowed to be empty, setName ensures a unique name
     setName(name);
@@ -533,6 +872,18 @@ MeshEdge::computeHash(MLINT i1, MLINT i2) {
     return hash;
 }
 
+void
+MeshEdge::remapReferences(MLINT indexOffset,
+    const MeshTopoIDRemap &gidRemap, const MeshTopoIDRemap &attidRemap)
+{
+    MeshTopo::remapReferences(indexOffset, gidRemap, attidRemap);
+    if (i1_ != MESH_TOPO_INDEX_UNUSED) i1_ += indexOffset;
+    if (i2_ != MESH_TOPO_INDEX_UNUSED) i2_ += indexOffset;
+    for (int n = 0; n < 2; ++n) {
+        remapParamVertex(paramVerts_[n], indexOffset, gidRemap);
+    }
+}
+
 
 
 /****************************************************************************
@@ -593,9 +944,9 @@ MeshFace::MeshFace(MLINT i1, MLINT i2, MLINT i3,
     ParamVertex *pv1, ParamVertex *pv2,
     ParamVertex *pv3) :
     MeshTopo(mid, aref, gref, name),
-    i1_(i1),
-    i2_(i2),
-    i3_(i3),
+    i1_(checkedIndexValue(i1)),
+    i2_(checkedIndexValue(i2)),
+    i3_(checkedIndexValue(i3)),
     i4_(MESH_TOPO_INDEX_UNUSED)
 {
     // name arg is allowed to be empty, setName ensures a unique name
@@ -625,10 +976,10 @@ MeshFace::MeshFace(MLINT i1, MLINT i2, MLINT i3, MLINT i4,
     ParamVertex *pv1, ParamVertex *pv2,
     ParamVertex *pv3, ParamVertex *pv4) :
     MeshTopo(mid, aref, gref, name),
-    i1_(i1),
-    i2_(i2),
-    i3_(i3),
-    i4_(i4)
+    i1_(checkedIndexValue(i1)),
+    i2_(checkedIndexValue(i2)),
+    i3_(checkedIndexValue(i3)),
+    i4_(checkedIndexValue(i4))
 {
     // name arg is allowed to be empty, setName ensures a unique name
     setName(name);
@@ -735,6 +1086,20 @@ MeshFace::computeHash(MLINT i1, MLINT i2, MLINT i3, MLINT i4) {
     return hash;
 }
 
+void
+MeshFace::remapReferences(MLINT indexOffset,
+    const MeshTopoIDRemap &gidRemap, const MeshTopoIDRemap &attidRemap)
+{
+    MeshTopo::remapReferences(indexOffset, gidRemap, attidRemap);
+    if (i1_ != MESH_TOPO_INDEX_UNUSED) i1_ += indexOffset;
+    if (i2_ != MESH_TOPO_INDEX_UNUSED) i2_ += indexOffset;
+    if (i3_ != MESH_TOPO_INDEX_UNUSED) i3_ += indexOffset;
+    if (i4_ != MESH_TOPO_INDEX_UNUSED) i4_ += indexOffset;
+    for (int n = 0; n < 4; ++n) {
+        remapParamVertex(paramVerts_[n], indexOffset, gidRemap);
+    }
+}
+
 /****************************************************************************
  *
  * This file is licensed under the Cadence Public License Version 1.0 (the
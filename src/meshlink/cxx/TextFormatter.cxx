@@ -0,0 +1,440 @@
+/****************************************************************************
+ *
+ * (C) 2021 Cadence Design Systems, Inc. All rights reserved worldwide.
+ *
+ * This sample source code is not supported by Cadence Design Systems, Inc.
+ * It is provided freely for demonstration purposes only.
+ * SEE THE WARRANTY DISCLAIMER AT THE BOTTOM OF THIS FILE.
+ *
+ ***************************************************************************/
+
+#include "TextFormatter.h"
+#include "ThreadPool.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+// Grisu2 shortest round-trip digit generation, after Loitsch, "Printing
+// Floating-Point Numbers Quickly and Accurately with Integers" (PLDI 2010).
+// The digits always read back as the original value and are the shortest
+// possible for all but a small fraction of values.
+
+// Double precision layout
+static const int SignificandBits = 52;
+static const int ExponentBias = 0x3FF + SignificandBits;
+static const MLUINT64 SignificandMask = 0x000FFFFFFFFFFFFFULL;
+static const MLUINT64 ExponentMask = 0x7FF0000000000000ULL;
+static const MLUINT64 HiddenBit = 0x0010000000000000ULL;
+
+// Largest magnitude written as an integer without digit generation
+static const MLREAL MaxFastInteger = 1e15;
+
+// %g style notation: fixed when the decimal exponent is in
+// [MinFixedExp10, MaxFixedExp10)
+static const int MinFixedExp10 = -4;
+static const int MaxFixedExp10 = 17;
+
+
+// A floating point value f * 2^e with a 64-bit significand
+struct DiyFp {
+    DiyFp(MLUINT64 f, int e) :
+        f(f),
+        e(e)
+    {
+    }
+
+    explicit DiyFp(MLREAL value)
+    {
+        MLUINT64 bits;
+        memcpy(&bits, &value, sizeof(bits));
+        int biasedExp = (int)((bits & ExponentMask) >> SignificandBits);
+        f = bits & SignificandMask;
+        if (0 != biasedExp) {
+            f += HiddenBit;
+            e = biasedExp - ExponentBias;
+        }
+        else {
+            e = 1 - ExponentBias;
+        }
+    }
+
+    DiyFp operator-(const DiyFp &rhs) const
+    {
+        return DiyFp(f - rhs.f, e);
+    }
+
+    // Product rounded to the upper 64 bits
+    DiyFp operator*(const DiyFp &rhs) const
+    {
+        const MLUINT64 M32 = 0xFFFFFFFFULL;
+        MLUINT64 a = f >> 32;
+        MLUINT64 b = f & M32;
+        MLUINT64 c = rhs.f >> 32;
+        MLUINT64 d = rhs.f & M32;
+        MLUINT64 ac = a * c;
+        MLUINT64 bc = b * c;
+        MLUINT64 ad = a * d;
+        MLUINT64 bd = b * d;
+        MLUINT64 tmp = (bd >> 32) + (ad & M32) + (bc & M32);
+        tmp += 1ULL << 31;
+        return DiyFp(ac + (ad >> 32) + (bc >> 32) + (tmp >> 32),
+            e + rhs.e + 64);
+    }
+
+    DiyFp normalize() const
+    {
+        DiyFp res = *this;
+        while (0 == (res.f & (1ULL << 63))) {
+            res.f <<= 1;
+            --res.e;
+        }
+        return res;
+    }
+
+    // The normalized boundaries halfway to the neighboring values, with
+    // the exponent of the upper boundary
+    void boundaries(DiyFp &minus, DiyFp &plus) const
+    {
+        plus = DiyFp((f << 1) + 1, e - 1).normalize();
+        // The lower neighbor is closer when f is a power of two
+        minus = (HiddenBit == f) ? DiyFp((f << 2) - 1, e - 2) :
+            DiyFp((f << 1) - 1, e - 1);
+        minus.f <<= minus.e - plus.e;
+        minus.e = plus.e;
+    }
+
+    MLUINT64 f;
+    int e;
+};
+
+
+// Normalized 10^k for k = -348, -340, ..., 340
+static const MLUINT64 CachedPowersF[] = {
+    0xfa8fd5a0081c0288ULL, 0xbaaee17fa23ebf76ULL, 0x8b16fb203055ac76ULL,
+    0xcf42894a5dce35eaULL, 0x9a6bb0aa55653b2dULL, 0xe61acf033d1a45dfULL,
+    0xab70fe17c79ac6caULL, 0xff77b1fcbebcdc4fULL, 0xbe5691ef416bd60cULL,
+    0x8dd01fad907ffc3cULL, 0xd3515c2831559a83ULL, 0x9d71ac8fada6c9b5ULL,
+    0xea9c227723ee8bcbULL, 0xaecc49914078536dULL, 0x823c12795db6ce57ULL,
+    0xc21094364dfb5637ULL, 0x9096ea6f3848984fULL, 0xd77485cb25823ac7ULL,
+    0xa086cfcd97bf97f4ULL, 0xef340a98172aace5ULL, 0xb23867fb2a35b28eULL,
+    0x84c8d4dfd2c63f3bULL, 0xc5dd44271ad3cdbaULL, 0x936b9fcebb25c996ULL,
+    0xdbac6c247d62a584ULL, 0xa3ab66580d5fdaf6ULL, 0xf3e2f893dec3f126ULL,
+    0xb5b5ada8aaff80b8ULL, 0x87625f056c7c4a8bULL, 0xc9bcff6034c13053ULL,
+    0x964e858c91ba2655ULL, 0xdff9772470297ebdULL, 0xa6dfbd9fb8e5b88fULL,
+    0xf8a95fcf88747d94ULL, 0xb94470938fa89bcfULL, 0x8a08f0f8bf0f156bULL,
+    0xcdb02555653131b6ULL, 0x993fe2c6d07b7facULL, 0xe45c10c42a2b3b06ULL,
+    0xaa242499697392d3ULL, 0xfd87b5f28300ca0eULL, 0xbce5086492111aebULL,
+    0x8cbccc096f5088ccULL, 0xd1b71758e219652cULL, 0x9c40000000000000ULL,
+    0xe8d4a51000000000ULL, 0xad78ebc5ac620000ULL, 0x813f3978f8940984ULL,
+    0xc097ce7bc90715b3ULL, 0x8f7e32ce7bea5c70ULL, 0xd5d238a4abe98068ULL,
+    0x9f4f2726179a2245ULL, 0xed63a231d4c4fb27ULL, 0xb0de65388cc8ada8ULL,
+    0x83c7088e1aab65dbULL, 0xc45d1df942711d9aULL, 0x924d692ca61be758ULL,
+    0xda01ee641a708deaULL, 0xa26da3999aef774aULL, 0xf209787bb47d6b85ULL,
+    0xb454e4a179dd1877ULL, 0x865b86925b9bc5c2ULL, 0xc83553c5c8965d3dULL,
+    0x952ab45cfa97a0b3ULL, 0xde469fbd99a05fe3ULL, 0xa59bc234db398c25ULL,
+    0xf6c69a72a3989f5cULL, 0xb7dcbf5354e9beceULL, 0x88fcf317f22241e2ULL,
+    0xcc20ce9bd35c78a5ULL, 0x98165af37b2153dfULL, 0xe2a0b5dc971f303aULL,
+    0xa8d9d1535ce3b396ULL, 0xfb9b7cd9a4a7443cULL, 0xbb764c4ca7a44410ULL,
+    0x8bab8eefb6409c1aULL, 0xd01fef10a657842cULL, 0x9b10a4e5e9913129ULL,
+    0xe7109bfba19c0c9dULL, 0xac2820d9623bf429ULL, 0x80444b5e7aa7cf85ULL,
+    0xbf21e44003acdd2dULL, 0x8e679c2f5e44ff8fULL, 0xd433179d9c8cb841ULL,
+    0x9e19db92b4e31ba9ULL, 0xeb96bf6ebadf77d9ULL, 0xaf87023b9bf0ee6bULL,
+};
+static const short CachedPowersE[] = {
+    -1220, -1193, -1166, -1140, -1113, -1087, -1060, -1034, -1007,  -980,
+     -954,  -927,  -901,  -874,  -847,  -821,  -794,  -768,  -741,  -715,
+     -688,  -661,  -635,  -608,  -582,  -555,  -529,  -502,  -475,  -449,
+     -422,  -396,  -369,  -343,  -316,  -289,  -263,  -236,  -210,  -183,
+     -157,  -130,  -103,   -77,   -50,   -24,     3,    30,    56,    83,
+      109,   136,   162,   189,   216,   242,   269,   295,   322,   348,
+      375,   402,   428,   455,   481,   508,   534,   561,   588,   614,
+      641,   667,   694,   720,   747,   774,   800,   827,   853,   880,
+      907,   933,   960,   986,  1013,  1039,  1066,
+};
+
+
+// The cached power c = 10^-k with binary exponent bringing w * c into
+// [2^-60, 2^-32) for w of binary exponent e
+static DiyFp
+getCachedPower(int e, int &k)
+{
+    double dk = (-61 - e) * 0.30102999566398114 + 347;
+    int ik = (int)dk;
+    if (dk - ik > 0.0) {
+        ++ik;
+    }
+    unsigned index = (unsigned)((ik >> 3) + 1);
+    k = -(-348 + (int)(index << 3));
+    return DiyFp(CachedPowersF[index], CachedPowersE[index]);
+}
+
+
+static const MLUINT32 Pow10U32[] = {
+    1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000,
+    1000000000
+};
+
+
+static int
+countDigits(MLUINT32 n)
+{
+    int count = 1;
+    while (count < 9 && n >= Pow10U32[count]) {
+        ++count;
+    }
+    return count;
+}
+
+
+// Move the last digit towards w while remaining within the boundaries
+static void
+roundWeed(char *buffer, int len, MLUINT64 delta, MLUINT64 rest,
+    MLUINT64 tenKappa, MLUINT64 wpw)
+{
+    while (rest < wpw && delta - rest >= tenKappa &&
+            (rest + tenKappa < wpw || wpw - rest > rest + tenKappa - wpw)) {
+        --buffer[len - 1];
+        rest += tenKappa;
+    }
+}
+
+
+// Generate the digits of Mp down to the precision delta, adding the
+// decimal exponent of the last digit to k
+static void
+generateDigits(const DiyFp &W, const DiyFp &Mp, MLUINT64 delta, char *buffer,
+    int &len, int &k)
+{
+    const DiyFp one(1ULL << -Mp.e, Mp.e);
+    const DiyFp wpw = Mp - W;
+    MLUINT32 p1 = (MLUINT32)(Mp.f >> -one.e);
+    MLUINT64 p2 = Mp.f & (one.f - 1);
+    int kappa = countDigits(p1);
+    len = 0;
+
+    // Integral part
+    while (kappa > 0) {
+        MLUINT32 pow10 = Pow10U32[kappa - 1];
+        MLUINT32 d = p1 / pow10;
+        p1 %= pow10;
+        if (0 != d || 0 != len) {
+            buffer[len++] = (char)('0' + d);
+        }
+        --kappa;
+        MLUINT64 rest = ((MLUINT64)p1 << -one.e) + p2;
+        if (rest <= delta) {
+            k += kappa;
+            roundWeed(buffer, len, delta, rest,
+                (MLUINT64)Pow10U32[kappa] << -one.e, wpw.f);
+            return;
+        }
+    }
+
+    // Fractional part
+    for (;;) {
+        p2 *= 10;
+        delta *= 10;
+        char d = (char)(p2 >> -one.e);
+        if (0 != d || 0 != len) {
+            buffer[len++] = (char)('0' + d);
+        }
+        p2 &= one.f - 1;
+        --kappa;
+        if (p2 < delta) {
+            k += kappa;
+            int index = -kappa;
+            roundWeed(buffer, len, delta, p2, one.f,
+                wpw.f * (index < 9 ? Pow10U32[index] : 0));
+            return;
+        }
+    }
+}
+
+
+// The shortest digits of positive value, value = digits * 10^k
+static void
+grisu2(MLREAL value, char *buffer, int &len, int &k)
+{
+    const DiyFp v(value);
+    DiyFp minus(0, 0);
+    DiyFp plus(0, 0);
+    v.boundaries(minus, plus);
+
+    const DiyFp cached = getCachedPower(plus.e, k);
+    const DiyFp W = v.normalize() * cached;
+    DiyFp Wp = plus * cached;
+    DiyFp Wm = minus * cached;
+    // Stay strictly inside the boundaries despite the product rounding
+    ++Wm.f;
+    --Wp.f;
+    generateDigits(W, Wp, Wp.f - Wm.f, buffer, len, k);
+}
+
+
+// Write digits * 10^k in %g style notation
+static size_t
+writeDigits(const char *digits, int len, int k, char *buf)
+{
+    char *p = buf;
+    int exp10 = len + k - 1;
+    if (exp10 >= MinFixedExp10 && exp10 < MaxFixedExp10) {
+        if (k >= 0) {
+            // Integer, padded with zeros
+            memcpy(p, digits, len);
+            p += len;
+            memset(p, '0', k);
+            p += k;
+        }
+        else if (exp10 >= 0) {
+            // Decimal point within the digits
+            memcpy(p, digits, exp10 + 1);
+            p += exp10 + 1;
+            *p++ = '.';
+            memcpy(p, digits + exp10 + 1, len - exp10 - 1);
+            p += len - exp10 - 1;
+        }
+        else {
+            // Leading zeros after the decimal point
+            *p++ = '0';
+            *p++ = '.';
+            memset(p, '0', -exp10 - 1);
+            p += -exp10 - 1;
+            memcpy(p, digits, len);
+            p += len;
+        }
+    }
+    else {
+        *p++ = digits[0];
+        if (len > 1) {
+            *p++ = '.';
+            memcpy(p, digits + 1, len - 1);
+            p += len - 1;
+        }
+        *p++ = 'e';
+        *p++ = exp10 < 0 ? '-' : '+';
+        int e = exp10 < 0 ? -exp10 : exp10;
+        if (e >= 100) {
+            *p++ = (char)('0' + e / 100);
+            e %= 100;
+        }
+        *p++ = (char)('0' + e / 10);
+        *p++ = (char)('0' + e % 10);
+    }
+    *p = '\0';
+    return p - buf;
+}
+
+
+size_t
+TextFormatter::formatReal(MLREAL value, char *buf)
+{
+    char *p = buf;
+    if (std::isnan(value)) {
+        strcpy(p, "nan");
+        return 3;
+    }
+    if (std::signbit(value)) {
+        *p++ = '-';
+        value = -value;
+    }
+    if (std::isinf(value)) {
+        strcpy(p, "inf");
+        return p + 3 - buf;
+    }
+    if (0.0 == value) {
+        strcpy(p, "0");
+        return p + 1 - buf;
+    }
+
+    // Small integers are exact, write their digits directly
+    if (value < MaxFastInteger && value == std::floor(value)) {
+        MLUINT64 n = (MLUINT64)value;
+        char digits[20];
+        int len = 0;
+        do {
+            digits[len++] = (char)('0' + n % 10);
+            n /= 10;
+        } while (0 != n);
+        for (int i = len - 1; i >= 0; --i) {
+            *p++ = digits[i];
+        }
+        *p = '\0';
+        return p - buf;
+    }
+
+    char digits[20];
+    int len = 0;
+    int k = 0;
+    grisu2(value, digits, len, k);
+    return (p - buf) + writeDigits(digits, len, k, p);
+}
+
+
+void
+TextFormatter::formatRealTuples(const MLREAL *values, size_t count,
+    size_t tupleSize, std::vector<char> &text, std::vector<size_t> &offsets,
+    size_t numThreads)
+{
+    text.clear();
+    offsets.resize(count);
+    if (0 == count || 0 == tupleSize) {
+        return;
+    }
+    size_t tuplesPerChunk = std::max((size_t)1, DefaultChunkValues / tupleSize);
+    size_t numChunks = (count + tuplesPerChunk - 1) / tuplesPerChunk;
+    // Values separated by a space, each tuple terminated
+    const size_t maxTupleLength = tupleSize * (MaxRealLength + 1);
+
+    // Format each chunk into its own buffer, with offsets local to it
+    std::vector<std::vector<char> > chunks(numChunks);
+    auto job = [&](size_t c) {
+        size_t first = c * tuplesPerChunk;
+        size_t last = std::min(count, first + tuplesPerChunk);
+        std::vector<char> &chunk = chunks[c];
+        chunk.resize((last - first) * maxTupleLength);
+        char *p = chunk.data();
+        for (size_t i = first; i < last; ++i) {
+            offsets[i] = p - chunk.data();
+            const MLREAL *tuple = values + i * tupleSize;
+            for (size_t j = 0; j < tupleSize; ++j) {
+                if (0 != j) {
+                    *p++ = ' ';
+                }
+                p += formatReal(tuple[j], p);
+            }
+            ++p;
+        }
+        chunk.resize(p - chunk.data());
+    };
+
+    ThreadPool::parallelFor(numChunks, job, numThreads);
+
+    // Concatenate the chunks in order
+    size_t total = 0;
+    for (size_t c = 0; c < numChunks; ++c) {
+        total += chunks[c].size();
+    }
+    text.reserve(total);
+    for (size_t c = 0; c < numChunks; ++c) {
+        size_t base = text.size();
+        size_t first = c * tuplesPerChunk;
+        size_t last = std::min(count, first + tuplesPerChunk);
+        for (size_t i = first; i < last; ++i) {
+            offsets[i] += base;
+        }
+        text.insert(text.end(), chunks[c].begin(), chunks[c].end());
+        std::vector<char>().swap(chunks[c]);
+    }
+}
+
+/****************************************************************************
+ *
+ * This file is licensed under the Cadence Public License Version 1.0 (the
+ * "License"), a copy of which is found in the included file named "LICENSE",
+ * and is distributed "AS IS." TO THE MAXIMUM EXTENT PERMITTED BY APPLICABLE
+ * LAW, CADENCE DISCLAIMS ALL WARRANTIES AND IN NO EVENT SHALL BE LIABLE TO
+ * ANY PARTY FOR ANY DAMAGES ARISING OUT OF OR RELATING TO USE OF THIS FILE.
+ * Please see the License for the full text of applicable terms.
+ *
+ ****************************************************************************/
@@ -0,0 +1,284 @@
+/****************************************************************************
+ *
+ * (C) 2021 Cadence Design Systems, Inc. All rights reserved worldwide.
+ *
+ * This sample source code is not supported by Cadence Design Systems, Inc.
+ * It is provided freely for demonstration purposes only.
+ * SEE THE WARRANTY DISCLAIMER AT THE BOTTOM OF THIS FILE.
+ *
+ ***************************************************************************/
+
+#include "TextScanner.h"
+
+#include <limits>
+#include <locale>
+#include <sstream>
+
+// Exactly representable powers of ten
+static const MLREAL Pow10[] = {
+    1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+static const int MaxExactPow10 = 22;
+// Largest integer mantissa exactly representable in a double
+static const MLUINT64 MaxExactMantissa = (MLUINT64)1 << 53;
+
+static inline bool
+isSpace(char c)
+{
+    return ' ' == c || '\n' == c || '\t' == c || '\r' == c ||
+        '\f' == c || '\v' == c;
+}
+
+static inline bool
+isDigit(char c)
+{
+    return c >= '0' && c <= '9';
+}
+
+// Case-insensitive match of lower case word at p, within end
+static bool
+matchWord(const char *p, const char *end, const char *word)
+{
+    for (; '\0' != *word; ++p, ++word) {
+        if (p >= end || (*p | 0x20) != *word) {
+            return false;
+        }
+    }
+    return true;
+}
+
+
+TextScanner::TextScanner(const char *text, size_t length) :
+    pos_(text),
+    end_(text + length)
+{
+}
+
+TextScanner::TextScanner(const std::string &text) :
+    pos_(text.data()),
+    end_(text.data() + text.size())
+{
+}
+
+
+bool
+TextScanner::skipSpace()
+{
+    while (pos_ < end_ && isSpace(*pos_)) {
+        ++pos_;
+    }
+    return pos_ < end_;
+}
+
+
+bool
+TextScanner::atEnd()
+{
+    return !skipSpace();
+}
+
+
+bool
+TextScanner::nextInteger(MLINT64 &value, MLINT64 minVal, MLINT64 maxVal)
+{
+    if (!skipSpace()) {
+        return false;
+    }
+    const char *p = pos_;
+    bool negative = false;
+    if ('-' == *p || '+' == *p) {
+        negative = ('-' == *p);
+        ++p;
+    }
+    if (p >= end_ || !isDigit(*p)) {
+        return false;
+    }
+    MLUINT64 limit = negative ? (MLUINT64)maxVal + 1 : (MLUINT64)maxVal;
+    if (negative && minVal >= 0) {
+        limit = 0;
+    }
+    MLUINT64 mag = 0;
+    for (; p < end_ && isDigit(*p); ++p) {
+        MLUINT64 d = (MLUINT64)(*p - '0');
+        if (mag > (limit - d) / 10) {
+            return false; // out of range
+        }
+        mag = mag * 10 + d;
+    }
+    if (p < end_ && !isSpace(*p)) {
+        return false; // not a whole integer token
+    }
+    if (negative) {
+        value = (0 == mag) ? 0 : -(MLINT64)(mag - 1) - 1;
+    }
+    else {
+        value = (MLINT64)mag;
+    }
+    pos_ = p;
+    return true;
+}
+
+
+bool
+TextScanner::next(MLINT32 &value)
+{
+    MLINT64 val;
+    if (!nextInteger(val, std::numeric_limits<MLINT32>::min(),
+            std::numeric_limits<MLINT32>::max())) {
+        return false;
+    }
+    value = (MLINT32)val;
+    return true;
+}
+
+
+bool
+TextScanner::next(MLINT64 &value)
+{
+    return nextInteger(value, std::numeric_limits<MLINT64>::min(),
+        std::numeric_limits<MLINT64>::max());
+}
+
+
+bool
+TextScanner::next(MLREAL &value)
+{
+    if (!skipSpace()) {
+        return false;
+    }
+    const char *start = pos_;
+    const char *p = pos_;
+    bool negative = false;
+    if ('-' == *p || '+' == *p) {
+        negative = ('-' == *p);
+        ++p;
+    }
+
+    // Special values
+    if (matchWord(p, end_, "inf") || matchWord(p, end_, "nan")) {
+        bool isNan = matchWord(p, end_, "nan");
+        p += matchWord(p, end_, "infinity") ? 8 : 3;
+        if (p < end_ && !isSpace(*p)) {
+            return false;
+        }
+        value = isNan ? std::numeric_limits<MLREAL>::quiet_NaN() :
+            std::numeric_limits<MLREAL>::infinity();
+        if (negative) {
+            value = -value;
+        }
+        pos_ = p;
+        return true;
+    }
+
+    // Accumulate up to 19 significant digits in an integer mantissa
+    MLUINT64 mantissa = 0;
+    int numSig = 0;
+    int exp10 = 0;
+    bool anyDigits = false;
+    bool inexact = false;
+    for (; p < end_ && isDigit(*p); ++p) {
+        anyDigits = true;
+        if (numSig < 19) {
+            mantissa = mantissa * 10 + (MLUINT64)(*p - '0');
+            if (0 != mantissa) {
+                ++numSig;
+            }
+        }
+        else {
+            ++exp10;
+            inexact = inexact || '0' != *p;
+        }
+    }
+    if (p < end_ && '.' == *p) {
+        for (++p; p < end_ && isDigit(*p); ++p) {
+            anyDigits = true;
+            if (numSig < 19) {
+                mantissa = mantissa * 10 + (MLUINT64)(*p - '0');
+                if (0 != mantissa) {
+                    ++numSig;
+                }
+                --exp10;
+            }
+            else {
+                inexact = inexact || '0' != *p;
+            }
+        }
+    }
+    if (!anyDigits) {
+        return false;
+    }
+    if (p < end_ && ('e' == *p || 'E' == *p)) {
+        ++p;
+        bool expNegative = false;
+        if (p < end_ && ('-' == *p || '+' == *p)) {
+            expNegative = ('-' == *p);
+            ++p;
+        }
+        if (p >= end_ || !isDigit(*p)) {
+            return false;
+        }
+        int exp = 0;
+        for (; p < end_ && isDigit(*p); ++p) {
+            if (exp < 100000) {
+                exp = exp * 10 + (*p - '0');
+            }
+        }
+        exp10 += expNegative ? -exp : exp;
+    }
+    if (p < end_ && !isSpace(*p)) {
+        return false;
+    }
+
+    if (0 == mantissa) {
+        value = negative ? -0.0 : 0.0;
+    }
+    else if (!inexact && mantissa <= MaxExactMantissa &&
+            exp10 >= -MaxExactPow10 && exp10 <= MaxExactPow10) {
+        // Both operands are exact so the single operation rounds correctly
+        value = (MLREAL)mantissa;
+        value = exp10 < 0 ? value / Pow10[-exp10] : value * Pow10[exp10];
+        if (negative) {
+            value = -value;
+        }
+    }
+    else {
+        // Rare long or extreme values, use the classic locale conversion
+        std::istringstream is(std::string(start, p - start));
+        is.imbue(std::locale::classic());
+        is >> value;
+        if (is.fail()) {
+            return false;
+        }
+    }
+    pos_ = p;
+    return true;
+}
+
+
+bool
+TextScanner::nextToken(std::string &token)
+{
+    if (!skipSpace()) {
+        return false;
+    }
+    const char *p = pos_;
+    while (p < end_ && !isSpace(*p)) {
+        ++p;
+    }
+    token.assign(pos_, p - pos_);
+    pos_ = p;
+    return true;
+}
+
+
+/****************************************************************************
+ *
+ * This file is licensed under the Cadence Public License Version 1.0 (the
+ * "License"), a copy of which is found in the included file named "LICENSE",
+ * and is distributed "AS IS." TO THE MAXIMUM EXTENT PERMITTED BY APPLICABLE
+ * LAW, CADENCE DISCLAIMS ALL WARRANTIES AND IN NO EVENT SHALL BE LIABLE TO
+ * ANY PARTY FOR ANY DAMAGES ARISING OUT OF OR RELATING TO USE OF THIS FILE.
+ * Please see the License for the full text of applicable terms.
+ *
+ ****************************************************************************/
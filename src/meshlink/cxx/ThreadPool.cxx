@@ -0,0 +1,174 @@
+/****************************************************************************
+ *
+ * (C) 2021 Cadence Design Systems, Inc. All rights reserved worldwide.
+ *
+ * This sample source code is not supported by Cadence Design Systems, Inc.
+ * It is provided freely for demonstration purposes only.
+ * SEE THE WARRANTY DISCLAIMER AT THE BOTTOM OF THIS FILE.
+ *
+ ***************************************************************************/
+
+#include "ThreadPool.h"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Whether the thread is running a parallelFor job
+static thread_local bool inJob = false;
+
+
+// Threads used by parallelFor, the pool workers and the caller
+static size_t
+hardwareConcurrency()
+{
+    static const size_t concurrency =
+        std::max(1u, std::thread::hardware_concurrency());
+    return concurrency;
+}
+
+
+// Worker threads running queued tasks in submission order
+class PoolWorkers {
+public:
+    PoolWorkers() :
+        stop_(false)
+    {
+        for (size_t i = 1; i < hardwareConcurrency(); ++i) {
+            threads_.push_back(std::thread(&PoolWorkers::run, this));
+        }
+    }
+
+    ~PoolWorkers()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        wake_.notify_all();
+        for (size_t t = 0; t < threads_.size(); ++t) {
+            threads_[t].join();
+        }
+    }
+
+    void submit(const std::function<void()> &task)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            tasks_.push_back(task);
+        }
+        wake_.notify_one();
+    }
+
+private:
+    void run()
+    {
+        for (;;) {
+            std::function<void()> task;
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                wake_.wait(lock, [this]() {
+                    return stop_ || !tasks_.empty();
+                });
+                if (tasks_.empty()) {
+                    return;
+                }
+                task = tasks_.front();
+                tasks_.pop_front();
+            }
+            task();
+        }
+    }
+
+    std::vector<std::thread> threads_;
+    std::deque<std::function<void()> > tasks_;
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    bool stop_;
+};
+
+
+// The pool, started on first use
+static PoolWorkers &
+getPoolWorkers()
+{
+    static PoolWorkers workers;
+    return workers;
+}
+
+
+void
+ThreadPool::parallelFor(size_t count,
+    const std::function<void(size_t)> &job, size_t maxThreads)
+{
+    size_t numThreads = getConcurrency();
+    if (0 != maxThreads && maxThreads < numThreads) {
+        numThreads = maxThreads;
+    }
+    if (numThreads > count) { numThreads = count; }
+    if (numThreads <= 1) {
+        for (size_t i = 0; i < count; ++i) {
+            job(i);
+        }
+        return;
+    }
+
+    std::atomic<size_t> next(0);
+    auto work = [&]() {
+        bool wasInJob = inJob;
+        inJob = true;
+        size_t i;
+        while ((i = next++) < count) {
+            job(i);
+        }
+        inJob = wasInJob;
+    };
+
+    // Helpers signal while holding the lock, so the locals they use
+    // outlive the signal
+    std::mutex doneMutex;
+    std::condition_variable done;
+    size_t pending = numThreads - 1;
+    PoolWorkers &workers = getPoolWorkers();
+    for (size_t t = 1; t < numThreads; ++t) {
+        workers.submit([&]() {
+            work();
+            std::lock_guard<std::mutex> lock(doneMutex);
+            if (0 == --pending) {
+                done.notify_one();
+            }
+        });
+    }
+    work();
+    std::unique_lock<std::mutex> lock(doneMutex);
+    done.wait(lock, [&]() { return 0 == pending; });
+}
+
+
+size_t
+ThreadPool::getConcurrency()
+{
+    return inJob ? 1 : hardwareConcurrency();
+}
+
+
+bool
+ThreadPool::inParallelJob()
+{
+    return inJob;
+}
+
+/****************************************************************************
+ *
+ * This file is licensed under the Cadence Public License Version 1.0 (the
+ * "License"), a copy of which is found in the included file named "LICENSE",
+ * and is distributed "AS IS." TO THE MAXIMUM EXTENT PERMITTED BY APPLICABLE
+ * LAW, CADENCE DISCLAIMS ALL WARRANTIES AND IN NO EVENT SHALL BE LIABLE TO
+ * ANY PARTY FOR ANY DAMAGES ARISING OUT OF OR RELATING TO USE OF THIS FILE.
+ * Please see the License for the full text of applicable terms.
+ *
+ ****************************************************************************/
@@ -14,9 +14,11 @@
 
 #include "Types.h"
 
+#include <map>
 #include <set>
 #include <vector>
 #include <string>
+#include <unordered_map>
 
 class projectionData;
 class MeshAssociativity;
@@ -41,6 +43,15 @@ public:
     /// \brief Destructor
     ~GeometryGroup() {};
 
+    /// \brief Copy constructor
+    GeometryGroup(const GeometryGroup &other) = default;
+    /// \brief Move constructor
+    GeometryGroup(GeometryGroup &&other) = default;
+    /// \brief Copy assignment
+    GeometryGroup &operator=(const GeometryGroup &other) = default;
+    /// \brief Move assignment
+    GeometryGroup &operator=(GeometryGroup &&other) = default;
+
     /// \brief Set the name of the %GeometryGroup
     ///
     /// \param[in] name the new name of this group
@@ -92,6 +103,12 @@ public:
     /// \param[in] names the list of names to add to this group
     void setEntityNames(const std::set<std::string> &names);
 
+    /// \brief Set the %GeometryGroup's geometry entity list, taking
+    /// ownership of the names
+    ///
+    /// \param[in] names the list of names to move into this group
+    void setEntityNames(std::set<std::string> &&names);
+
     /// \brief Get a set of geometry entity names referenced by the %GeometryGroup
     const std::set<std::string> &getEntityNameSet() const;
 
@@ -145,14 +162,20 @@ private:
  *
  * \brief Storage for geometry groups.
  *
- * Supports lookup by group name and ID.
+ * Supports lookup by group name and ID. Groups are indexed by name and
+ * ID when added; changing the name or ID of a stored group is not
+ * supported.
  *
  */
 class GeometryGroupManager {
 public:
-    bool addGroup(GeometryGroup &group);
+    /// Add a copy of a GeometryGroup
+    bool addGroup(const GeometryGroup &group);
 
-    GeometryGroup * getByName(std::string name);
+    /// Add a GeometryGroup, moving its contents into the manager
+    bool addGroup(GeometryGroup &&group);
+
+    GeometryGroup * getByName(const std::string &name);
 
     GeometryGroup * getByID(MLINT id);
 
@@ -163,7 +186,17 @@ public:
     MLINT           getCount() const;
 
 private:
+    /// Whether group can be added without a name or ID collision
+    bool canAdd(const GeometryGroup &group);
+
+    /// Index the most recently added group by name and ID
+    void indexLastGroup();
+
     std::vector<GeometryGroup> geometry_groups_;
+    /// Index into geometry_groups_ by group ID
+    std::map<MLINT, size_t> idIndex_;
+    /// Index into geometry_groups_ by group name
+    std::unordered_map<std::string, size_t> nameIndex_;
 };
 
 #endif
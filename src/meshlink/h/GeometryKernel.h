@@ -74,6 +74,50 @@ public:
 };
 
 
+/****************************************************************************
+* ProjectionResults class
+***************************************************************************/
+/**
+ * \class ProjectionResults
+ *
+ * \brief Destination arrays for a batched point projection
+ *
+ * Results are stored as a structure of arrays indexed by point. Each
+ * array is caller-owned and must hold the documented number of values
+ * per point; a NULL array is skipped and its value is never extracted
+ * from the kernel.
+ *
+ */
+class ML_STORAGE_CLASS ProjectionResults {
+public:
+    /// \brief Default constructor with all arrays unset
+    ProjectionResults() :
+        xyz(NULL),
+        UV(NULL),
+        distance(NULL),
+        tolerance(NULL),
+        entityNames(NULL),
+        entityNameBufLen(0),
+        status(NULL)
+    {}
+
+    /// Projected Cartesian coordinates (3 per point)
+    MLREAL *xyz;
+    /// Projected entity parametric coordinates (2 per point)
+    MLREAL *UV;
+    /// Distance between original and projected point (1 per point)
+    MLREAL *distance;
+    /// Projection error tolerance (1 per point)
+    MLREAL *tolerance;
+    /// Hit entity name buffers (entityNameBufLen chars per point)
+    char *entityNames;
+    /// Length of each entity name buffer, including the terminator
+    MLINT entityNameBufLen;
+    /// Point projection status, ML_STATUS_OK or ML_STATUS_ERROR (1 per point)
+    MLINT *status;
+};
+
+
 /****************************************************************************
  * GeometryKernel class
  ***************************************************************************/
@@ -86,6 +130,13 @@ public:
  * wrapped geometry kernels. The geometry kernel is application-defined,
  * and performs all geometric operations as provided by this interface.
  *
+ * Concurrency: unless isReentrant returns true, a kernel must only be
+ * called from one thread at a time. A reentrant kernel allows concurrent
+ * projection (projectPoint, projectPoints, getProjection*) and evaluation
+ * (eval*, entityType, entityExists) calls, provided each thread uses its
+ * own ProjectionData. Loading and configuration (read, setModelSize) must
+ * not overlap any other call.
+ *
  */
 class ML_STORAGE_CLASS GeometryKernel {
 public:
@@ -117,6 +168,60 @@ public:
         const MLVector3D point, 
         ProjectionData &projectionData);
 
+    /**
+     * \brief Project an array of Cartesian points onto the Geometry group
+     *
+     * Closest point projection of each point onto the geometric
+     * entities in the GeometryGroup, with the requested results
+     * written to the ProjectionResults arrays.
+     *
+     * The default implementation calls projectPoint and the
+     * getProjection methods for each point. Kernels may override it
+     * to amortize per-point overhead across the batch.
+     *
+     * \param group the GeometryGroup to project upon
+     * \param points the points to project (3 coordinates per point)
+     * \param numPoints the number of points to project
+     * \param[out] results the projection result arrays
+     *
+     * \return true if every point was projected successfully. Results
+     * for a failed point are undefined; see ProjectionResults::status.
+     */
+    virtual bool projectPoints(const GeometryGroup *group,
+        const MLREAL *points,
+        MLINT numPoints,
+        ProjectionResults &results);
+
+    /**
+     * \brief Project an array of Cartesian points onto the Geometry group
+     * using multiple threads
+     *
+     * The batch is split into chunks which are projected with
+     * projectPoints on the shared ThreadPool. Kernels that are not
+     * reentrant, and batches too small to benefit, are projected
+     * on the calling thread.
+     *
+     * \param group the GeometryGroup to project upon
+     * \param points the points to project (3 coordinates per point)
+     * \param numPoints the number of points to project
+     * \param[out] results the projection result arrays
+     * \param numThreads the maximum number of threads to use
+     * (0 for ThreadPool::getConcurrency())
+     *
+     * \return true if every point was projected successfully
+     */
+    bool projectPointsParallel(const GeometryGroup *group,
+        const MLREAL *points,
+        MLINT numPoints,
+        ProjectionResults &results,
+        MLINT numThreads = 0);
+
+    /// \brief Return whether projection and evaluation are reentrant
+    ///
+    /// Defined by kernel implementation. See the class description for
+    /// the concurrency contract a reentrant kernel must honor.
+    virtual bool isReentrant() const;
+
     /// \brief Return the projection hit Cartesian coordinates
     ///
     /// \param[in] projectionData the projection data from which to extract
@@ -375,6 +375,15 @@ public:
     /// Destructor
     ~MeshLinkFile() {};
 
+    /// Copy constructor
+    MeshLinkFile(const MeshLinkFile &other) = default;
+    /// Move constructor
+    MeshLinkFile(MeshLinkFile &&other) = default;
+    /// Copy assignment
+    MeshLinkFile &operator=(const MeshLinkFile &other) = default;
+    /// Move assignment
+    MeshLinkFile &operator=(MeshLinkFile &&other) = default;
+
     /// Return the filename specified by the %MeshLinkFile
     virtual const char *getFilename() const { return filename_.c_str(); }
 
@@ -432,6 +441,15 @@ public:
     /// \brief Destructor
     ~GeometryFile() {};
 
+    /// \brief Copy constructor
+    GeometryFile(const GeometryFile &other) = default;
+    /// \brief Move constructor
+    GeometryFile(GeometryFile &&other) = default;
+    /// \brief Copy assignment
+    GeometryFile &operator=(const GeometryFile &other) = default;
+    /// \brief Move assignment
+    GeometryFile &operator=(GeometryFile &&other) = default;
+
     /// \brief Add a geometry group ID to the geometry file. Typically used by
     /// the %MeshLinkParser when a new "GeometryGroup" element is encountered.
     void addGeometryGroupID(MLINT gid) {
@@ -480,6 +498,15 @@ public:
     /// \brief Destructor
     ~MeshFile() {};
 
+    /// \brief Copy constructor
+    MeshFile(const MeshFile &other) = default;
+    /// \brief Move constructor
+    MeshFile(MeshFile &&other) = default;
+    /// \brief Copy assignment
+    MeshFile &operator=(const MeshFile &other) = default;
+    /// \brief Move assignment
+    MeshFile &operator=(MeshFile &&other) = default;
+
     /// \brief Add a MeshModel reference to this mesh file. Typically used by
     /// a MeshLinkParser when a new "MeshModelReference" element is encountered.
     ///
@@ -489,7 +516,7 @@ public:
     }
 
     // \brief Return the list of mesh model references associated with this mesh file
-    const std::vector<std::string> &getModelRefs() {
+    const std::vector<std::string> &getModelRefs() const {
         return modelRefs_;
     }
 
@@ -531,7 +558,13 @@ public:
     ///
     /// \param[in] geometry_group the group to add
     /// \return true if group was added
-    bool addGeometryGroup(GeometryGroup &geometry_group);
+    bool addGeometryGroup(const GeometryGroup &geometry_group);
+
+    /// \brief Add a GeometryGroup to the database, moving its contents
+    ///
+    /// \param[in] geometry_group the group to move into the database
+    /// \return true if group was added
+    bool addGeometryGroup(GeometryGroup &&geometry_group);
 
     /// \brief Get count of GeometryGroups in the database
     ///
@@ -549,6 +582,12 @@ public:
     /// \return group or NULL if not found
     GeometryGroup * getGeometryGroupByName(const char *name);
 
+    /// \brief Get GeometryGroup by name
+    ///
+    /// \param[in] name the name of the desired geometry group
+    /// \return group or NULL if not found
+    GeometryGroup * getGeometryGroupByName(const std::string &name);
+
     /// \brief Get GeometryGroup by ID
     ///
     /// \param[in] id the ID of the desired geometry group
@@ -648,7 +687,13 @@ public:
     ///
     /// \param[in] att the attribute to add
     /// \return true if the attribute was added
-    bool addAttribute(MeshLinkAttribute &att);
+    bool addAttribute(const MeshLinkAttribute &att);
+
+    /// \brief Add a MeshLinkAttribute to the database, moving its contents
+    ///
+    /// \param[in] att the attribute to move into the database
+    /// \return true if the attribute was added
+    bool addAttribute(MeshLinkAttribute &&att);
 
     /// \brief Return list of MeshLinkAttributes in the MeshAssociativity database
     std::vector<const MeshLinkAttribute *> getAttributes() const;
@@ -667,7 +712,13 @@ public:
     ///
     /// \param[in] trans the transform to add
     /// \return true if the transform was added
-    bool addTransform(MeshLinkTransform &att);
+    bool addTransform(const MeshLinkTransform &xform);
+
+    /// \brief Add a MeshLinkTransform to the database, moving its contents
+    ///
+    /// \param[in] xform the transform to move into the database
+    /// \return true if the transform was added
+    bool addTransform(MeshLinkTransform &&xform);
 
     /// \brief Return list of MeshLinkTransforms in the MeshAssociativity database
     void getTransforms(std::vector<const MeshLinkTransform *> &xforms) const;
@@ -706,7 +757,12 @@ public:
     /// \brief Add a GeometryFile to the database
     ///
     /// \param[in] file the geometry file to add
-    void addGeometryFile(GeometryFile &file);
+    void addGeometryFile(const GeometryFile &file);
+
+    /// \brief Add a GeometryFile to the database, moving its contents
+    ///
+    /// \param[in] file the geometry file to move into the database
+    void addGeometryFile(GeometryFile &&file);
 
     /// \brief Return the number of MeshFile objects in the database
     MLINT getNumMeshFiles() const;
@@ -714,7 +770,12 @@ public:
     /// \brief Add a MeshFile to the database
     ///
     /// \param[in] file the mesh file to add
-    void addMeshFile(MeshFile &file);
+    void addMeshFile(const MeshFile &file);
+
+    /// \brief Add a MeshFile to the database, moving its contents
+    ///
+    /// \param[in] file the mesh file to move into the database
+    void addMeshFile(MeshFile &&file);
 
     /// \brief Get the name and value of a MeshLinkAttribute by ID
     ///
@@ -736,6 +797,77 @@ public:
     /// \brief Return count of MeshModels in the MeshModel
     size_t getMeshModelCount() const;
 
+    /// \brief Sort the stored entities of all MeshSheets and MeshStrings
+    ///     by a locality key
+    ///
+    /// Entities stored directly in a MeshModel are not reordered.
+    ///
+    /// \param keyFunc the sort key; by default, point index order
+    /// \param userData application data passed to keyFunc
+    /// \see MeshModel::reorderEntities
+    void reorderEntities(
+        MeshTopoOrderKeyFunc keyFunc = MeshTopo::PointIndexOrderKey,
+        void *userData = NULL);
+
+    /// \brief Return the range of point indices used by all MeshModels
+    ///
+    /// \param[out] minIndex the smallest point index in use
+    /// \param[out] maxIndex the largest point index in use
+    /// \return false if no point indices are in use
+    bool getPointIndexRange(MLINT *minIndex, MLINT *maxIndex) const;
+
+    /// \brief Merge the contents of another MeshAssociativity into this one
+    ///
+    /// Typically used to combine MeshLink files exported per block or zone
+    /// into a single database.
+    ///
+    /// MeshLinkAttribute, MeshLinkTransform and GeometryGroup objects are
+    /// compared by content and reused when a match exists; otherwise they
+    /// are copied, receiving a new ID if their ID is already in use. All
+    /// AREF, XREF and GREF values of the merged data are renumbered to match.
+    ///
+    /// MeshModel and MeshElementLinkage objects are moved from other
+    /// into this database, and all point indices (and integer ParamVertex
+    /// vrefs) are offset by pointIndexOffset. A MeshModel with the same
+    /// reference (or name, if it has no reference) as an existing model is
+    /// combined with the existing model.
+    ///
+    /// GeometryFile and MeshFile objects are combined by file name.
+    ///
+    /// \param[in,out] other the database to merge; it has no MeshModel or
+    ///     MeshElementLinkage objects on return
+    /// \param[in] pointIndexOffset the offset added to the point indices of other
+    /// \return true if all data was merged
+    bool merge(MeshAssociativity &other, MLINT pointIndexOffset);
+
+    /// \brief Extract the associativity data of each partition of the mesh points
+    ///
+    /// Typically used to write per-rank MeshLink data for a distributed
+    /// solver, so that each rank loads only its own partition.
+    ///
+    /// Each partition receives copies of the MeshModel, MeshSheet and
+    /// MeshString entities that use at least one point owned by the partition.
+    /// Point indices and integer ParamVertex vrefs are renumbered to
+    /// partition-local indices (see MeshPointPartition). Entities defined only
+    /// by reference are not copied.
+    ///
+    /// The GeometryGroup, MeshLinkAttribute, MeshLinkTransform, GeometryFile
+    /// and MeshFile data referenced by a partition's entities is copied with
+    /// IDs unchanged. A MeshElementLinkage is copied if its source or target
+    /// entity is in the partition.
+    ///
+    /// \param[in] pointPartition the owning partition of each point, indexed
+    ///     by global point index
+    /// \param[in] numPartitions the number of partitions
+    /// \param[out] parts the new MeshAssociativity of each partition; the
+    ///     caller is responsible for deleting them
+    /// \param[out] localToGlobal (optional) the global point index of each
+    ///     local point, per partition. Local index i is at element (i - 1).
+    /// \return true if the partitions were extracted
+    bool extractPartitions(const std::vector<MLINT> &pointPartition,
+        MLINT numPartitions, std::vector<MeshAssociativity *> &parts,
+        std::vector<std::vector<MLINT> > *localToGlobal = NULL);
+
 private:
     /// Geometry files
     std::vector<GeometryFile> geometryFiles_;
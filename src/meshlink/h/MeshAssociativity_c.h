@@ -75,6 +75,41 @@ MLSTATUS    ML_parserReadMeshLinkFile(
         const char *meshlinkFilename,
         MeshAssociativityObj meshAssocObj);
 
+/**
+ * \brief Read a MeshLink XML document held in memory into a
+ * MeshAssociativity object.
+ * @param[in] parseObj MeshLinkParser object
+ * @param[in] buffer meshlink XML document
+ * @param[in] length length of the document in bytes
+ * @param[in,out] meshAssocObj MeshAssociativity object
+ * \returns ML_STATUS_OK / ML_STATUS_ERROR
+ */
+/** @cond */ ML_EXTERN ML_STORAGE_CLASS /** @endcond */
+MLSTATUS    ML_parserReadMeshLinkBuffer(
+        MeshLinkParserObj parseObj,
+        const char *buffer,
+        MLINT length,
+        MeshAssociativityObj meshAssocObj);
+
+/**
+ * \brief Read several MeshLink XML files concurrently and merge them
+ * into a MeshAssociativity object.
+ *
+ * Point indices of each file are offset to follow those of the
+ * previously merged files.
+ * @param[in] parseObj MeshLinkParser object
+ * @param[in] meshlinkFilenames array of meshlink filenames
+ * @param[in] numFiles number of filenames in the array
+ * @param[in,out] meshAssocObj MeshAssociativity object
+ * \returns ML_STATUS_OK / ML_STATUS_ERROR
+ */
+/** @cond */ ML_EXTERN ML_STORAGE_CLASS /** @endcond */
+MLSTATUS    ML_parserReadMeshLinkFiles(
+        MeshLinkParserObj parseObj,
+        const char **meshlinkFilenames,
+        MLINT numFiles,
+        MeshAssociativityObj meshAssocObj);
+
 /**
  * \brief Get MeshLink schema attributes.
  * @param[in] parseObj MeshLinkParser object
@@ -1111,6 +1146,36 @@ MLSTATUS ML_projectPoint(
     ProjectionDataObj projectionDataObj
 );
 
+/**
+ * \brief Closest point projection of an array of points onto a GeometryGroup.
+ * Any output array may be NULL, in which case that value is not computed.
+ * @param[in] geomKernelObj GeometryKernel object
+ * @param[in] geomGroupObj GeometryGroup object
+ * @param[in] points XYZ locations (3 * numPoints values)
+ * @param[in] numPoints number of points to project
+ * @param[out] xyz projected locations (3 * numPoints values, can be NULL)
+ * @param[out] UV parametric coordinates (2 * numPoints values, can be NULL)
+ * @param[out] distance the distances between the original points and projected points (numPoints values, can be NULL)
+ * @param[out] tolerance the error tolerances of the projection results (numPoints values, can be NULL)
+ * @param[in,out] entityNamesBufArr array of geometry entity name buffers (numPoints * entityNameBufLen chars, can be NULL)
+ * @param[in] entityNameBufLen buffer length of each entity name
+ * @param[out] pointStatus ML_STATUS_OK / ML_STATUS_ERROR for each point (numPoints values, can be NULL)
+ * \returns ML_STATUS_OK if all points were projected / ML_STATUS_ERROR
+ */
+/** @cond */ ML_EXTERN ML_STORAGE_CLASS /** @endcond */
+MLSTATUS ML_projectPoints(
+    GeometryKernelObj geomKernelObj,
+    GeometryGroupObj geomGroupObj,
+    const MLREAL *points,
+    MLINT numPoints,
+    MLREAL *xyz,
+    MLREAL *UV,
+    MLREAL *distance,
+    MLREAL *tolerance,
+    char *entityNamesBufArr, MLINT entityNameBufLen,
+    MLINT *pointStatus
+);
+
 /**
  * \brief Get info from closest point projection onto a GeometryGroup
  * stored in a ProjectionData object specific to the GeometryKernel.
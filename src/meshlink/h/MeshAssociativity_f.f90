@@ -314,6 +314,38 @@
         !char *entityName, MLINT entityNameBufLen
         !));
 
+        ! int ML_projectPoints(
+        !    GeometryKernelObj geomKernelObj,
+        !    GeometryGroupObj geomGroupObj,
+        !    const MLREAL *points,
+        !    MLINT numPoints,
+        !    MLREAL *xyz,
+        !    MLREAL *UV,
+        !    MLREAL *distance,
+        !    MLREAL *tolerance,
+        !    char *entityNamesBufArr, MLINT entityNameBufLen,
+        !    MLINT *pointStatus));
+        ! The outputs are passed as C_LOC(array), or C_NULL_PTR when the
+        ! value is not wanted.
+        FUNCTION ML_projectPoints(geomKernelObj, geomGroupObj, points, numPoints, &
+                xyz, UV, distance, tolerance, entityNamesBufArr, entityNameBufLen, &
+                pointStatus) bind(C, name="ML_projectPoints")
+          use, intrinsic :: iso_c_binding
+          implicit none
+          ML_STATUS :: ML_projectPoints
+          ML_OBJECT, VALUE :: geomKernelObj
+          ML_OBJECT, VALUE :: geomGroupObj
+          MLREAL_F, INTENT(IN) :: points(*)
+          MLINT_F, VALUE :: numPoints
+          type(c_ptr), VALUE :: xyz
+          type(c_ptr), VALUE :: UV
+          type(c_ptr), VALUE :: distance
+          type(c_ptr), VALUE :: tolerance
+          type(c_ptr), VALUE :: entityNamesBufArr
+          MLINT_F, VALUE :: entityNameBufLen
+          type(c_ptr), VALUE :: pointStatus
+        ENDFUNCTION ML_projectPoints
+
         
         
         
@@ -12,6 +12,7 @@
 #define MESH_LINK_PARSER
 
 #include <string>
+#include <vector>
 
 class MeshAssociativity;
 
@@ -56,6 +57,34 @@ public:
     virtual bool parseMeshLinkFile(std::string fname,
             MeshAssociativity *meshAssociativity) { return false; }
 
+    /// \brief Parse a MeshLink xml document held in memory into
+    ///     MeshAssociativity
+    ///
+    /// \param buffer the %MeshLink XML document
+    /// \param length the length of the document in bytes
+    /// \param meshAssociativity the MeshAssociativity object to populate
+    //
+    /// \return true if the document was successfully read into the
+    ///         MeshAssociativity
+    virtual bool parseMeshLinkBuffer(const char *buffer, size_t length,
+            MeshAssociativity *meshAssociativity) { return false; }
+
+    /// \brief Parse several MeshLink xml files into one MeshAssociativity
+    ///
+    /// Each file is parsed into a private MeshAssociativity, concurrently
+    /// where supported, and the results are merged in file order using
+    /// MeshAssociativity::merge.
+    ///
+    /// \param fnames the names (paths) of the %MeshLink XML files to parse
+    /// \param meshAssociativity the MeshAssociativity object to populate
+    /// \param offsetPointIndices whether the point indices of each file are
+    ///     offset to follow those of the previously merged files
+    //
+    /// \return true if all files were successfully read and merged
+    virtual bool parseMeshLinkFiles(const std::vector<std::string> &fnames,
+            MeshAssociativity *meshAssociativity,
+            bool offsetPointIndices = true) { return false; }
+
     /// \brief Return schema-related attributes
     ///
     /// These attributes are typically used when exporting MeshAssociativity
@@ -11,10 +11,18 @@
 #ifndef MESH_LINK_WRITER
 #define MESH_LINK_WRITER
 
+#include <cstddef>
 #include <string>
 
 class MeshAssociativity;
 
+/// \brief Output sink receiving a serialized MeshLink document
+///
+/// Called with consecutive pieces of the document, in order.
+/// \return false to abandon the write
+typedef bool (*MeshLinkSinkFunc)(const void *data, size_t len,
+    void *userData);
+
 /****************************************************************************
 * MeshLinkWriter class
 ***************************************************************************/
@@ -37,6 +45,12 @@ public:
         MeshAssociativity *meshAssociativity, bool compress=true,
         bool terminatePlatform=true) { return false; }
 
+    // Write MeshAssociativity data to an output sink such as a pipe or
+    // socket. The document is passed to the sink as it is serialized
+    virtual bool writeMeshLinkSink(MeshAssociativity *meshAssociativity,
+        MeshLinkSinkFunc sink, void *userData, bool compress=true,
+        bool terminatePlatform=true) { return false; }
+
     // Need to provide these if using the default constructor (C API
     // call), otherwise XML file will not validate
     virtual bool setMeshLinkAttributes(const std::string &xmlns,
@@ -180,6 +180,29 @@ public:
         std::string &name,
         ParamVertex *pv1, ParamVertex *pv2, bool mapID);
 
+    /// \brief Add MeshEdges to the MeshModel using packed point indices
+    ///
+    /// Adds the edge-points and MeshEdge of each edge in turn, as
+    /// addEdgePoint and addEdge would. Edges which could not be stored
+    /// are skipped.
+    ///
+    /// \param indices 2 point indices per edge
+    /// \param count the number of edges
+    /// \param mid unique ID of the edges
+    /// \param aref the attribute reference ID (AttID)
+    /// \param gref the geometry reference ID
+    /// \param name the name of the edges (unique names are generated if empty)
+    /// \param paramVerts (optional) the ParamVertex of each point, parallel
+    ///     to indices; NULL entries for points without one
+    /// \param mapID whether to record the mapping of unique ID to name
+    /// \return false if any edge could not be stored
+    bool addEdges(const MLINT *indices, size_t count,
+        MLINT mid,
+        MLINT aref,
+        MLINT gref,
+        std::string &name,
+        ParamVertex *const *paramVerts, bool mapID);
+
     /// \brief Add a edge-point to the MeshModel
     ///
     /// Edge-points are created when a MeshEdge is added
@@ -385,6 +408,31 @@ public:
         ParamVertex *pv1, ParamVertex *pv2,
         ParamVertex *pv3, ParamVertex *pv4, bool mapID);
 
+    /// \brief Add triangular or quadrilateral MeshFaces to the MeshModel
+    ///     using packed point indices
+    ///
+    /// Adds the face-edges, face-edge-points and MeshFace of each face in
+    /// turn, as addFaceEdge, addFaceEdgePoint and addFace would. Faces
+    /// which could not be stored are skipped.
+    ///
+    /// \param indices pointsPerFace point indices per face
+    /// \param count the number of faces
+    /// \param pointsPerFace 3 for triangular or 4 for quadrilateral faces
+    /// \param mid unique ID of the faces
+    /// \param aref the attribute reference ID (AttID)
+    /// \param gref the geometry reference ID
+    /// \param name the name of the faces (unique names are generated if empty)
+    /// \param paramVerts (optional) the ParamVertex of each point, parallel
+    ///     to indices; NULL entries for points without one
+    /// \param mapID whether to record the mapping of unique ID to name
+    /// \return false if any face could not be stored
+    bool addFaces(const MLINT *indices, size_t count, int pointsPerFace,
+        MLINT mid,
+        MLINT aref,
+        MLINT gref,
+        std::string &name,
+        ParamVertex *const *paramVerts, bool mapID);
+
     /// \brief Find a (triangular or quadrilateral) face in the MeshSheet associativity data
     ///
     /// \param i1,i2,i3 the point indices of the desired triangular or quadrilateral face
@@ -502,6 +550,37 @@ public:
     /// \brief Return count of MeshSheets in the MeshModel
     size_t getMeshSheetCount() const;
 
+    /// \brief Sort the stored entities of all MeshSheets and MeshStrings
+    ///     in the MeshModel by a locality key
+    ///
+    /// The faces, edges and points stored directly in the MeshModel are
+    /// not reordered; getMeshFaces and getMeshEdges of the MeshModel keep
+    /// returning them in name order.
+    ///
+    /// \param keyFunc the sort key; by default, point index order
+    /// \param userData application data passed to keyFunc
+    /// \see MeshSheet::reorderEntities, MeshString::reorderEntities
+    void reorderEntities(
+        MeshTopoOrderKeyFunc keyFunc = MeshTopo::PointIndexOrderKey,
+        void *userData = NULL);
+
+    /// \brief Return the range of point indices used by the MeshModel
+    ///
+    /// All point, edge and face entities of the model, its MeshSheets
+    /// and its MeshStrings are considered.
+    ///
+    /// \param[out] minIndex the smallest point index in use
+    /// \param[out] maxIndex the largest point index in use
+    /// \return false if no point indices are in use
+    bool getPointIndexRange(MLINT *minIndex, MLINT *maxIndex) const;
+
+    /// \brief Move all entities, sheets and strings of other into this model
+    ///
+    /// Entities whose point indices duplicate an existing entity are
+    /// discarded. Name collisions are resolved by generating unique names.
+    /// On return, other is empty and may be deleted.
+    void absorbModel(MeshModel *other);
+
     /// Destructor
     ~MeshModel();
 
@@ -517,6 +596,28 @@ private:
     /// Hidden default constructor
     MeshModel() {};
 
+    /// Offset point indices and renumber GREF and AREF values of the
+    /// model and all of its entities, sheets and strings
+    virtual void remapReferences(MLINT indexOffset,
+        const MeshTopoIDRemap &gidRemap, const MeshTopoIDRemap &attidRemap);
+
+    /// Move the entities of otherNameMap into nameMap (see absorbModel)
+    template<class T>
+    void absorbEntities(std::map<std::string, T *> &nameMap,
+        std::map<pwiFnvHash::FNVHash, T *> &hashMap,
+        MeshTopoIDToNameMap &idMap, MeshTopoRefToNameMap &refMap,
+        std::map<std::string, T *> &otherNameMap,
+        MeshTopoIDToNameMap &otherIDMap);
+
+    /// \brief Copy the entities, sheets and strings of this model using the
+    ///     points of each partition into per-partition MeshModel objects
+    ///
+    /// \param partition the point partitioning
+    /// \param[out] parts the new MeshModel of each partition, or NULL if no
+    ///     entity uses the partition's points
+    void extractPartitions(MeshPointPartition &partition,
+        std::vector<MeshModel *> &parts) const;
+
     /// Map point index hash to MeshPoint
     std::map<pwiFnvHash::FNVHash, MeshPoint*> pointMap_; // not the owner
     /// Map MeshPoint name to unique ID
@@ -146,6 +146,32 @@ public:
         ParamVertex *pv1, ParamVertex *pv2,
         ParamVertex *pv3, ParamVertex *pv4, bool mapID);
 
+    /// \brief Add triangular or quadrilateral MeshFaces to the MeshSheet
+    ///     using packed point indices
+    ///
+    /// Adds the face-edges and MeshFace of each face in turn, as
+    /// addFaceEdge and addFace would. Faces which could not be stored
+    /// are skipped.
+    ///
+    /// \param indices pointsPerFace point indices per face
+    /// \param count the number of faces
+    /// \param pointsPerFace 3 for triangular or 4 for quadrilateral faces
+    /// \param mid unique ID of the mesh entities
+    /// \param aref the attribute reference ID (AttID) (optional)
+    /// \param gref the geometry reference ID
+    /// \param name the name of the mesh entities
+    /// \param paramVerts (optional) the ParamVertex of each point, parallel
+    ///     to indices; NULL entries for points without one
+    /// \param mapID whether to map the unique ID to the entity name
+    /// \return false if any face could not be stored
+    virtual bool addFaces(const MLINT *indices, size_t count,
+        int pointsPerFace,
+        MLINT mid,
+        MLINT aref,
+        MLINT gref,
+        const std::string &name,
+        ParamVertex *const *paramVerts, bool mapID);
+
 
     /// \brief Find a MeshFace by name
     ///
@@ -192,14 +218,28 @@ public:
 
     /// \brief Return array of face-edges in the MeshSheet
     ///
-    /// Face-edges are returned in creation order.
+    /// Face-edges are returned in creation order, or in the order
+    /// set by reorderEntities.
     virtual void getFaceEdges(std::vector<const MeshEdge *> &faceEdges) const;
 
     /// \brief Return array of MeshFaces in the MeshSheet
     ///
-    /// Faces are returned in creation order.
+    /// Faces are returned in creation order, or in the order
+    /// set by reorderEntities.
     virtual void getMeshFaces(std::vector<const MeshFace *> &faces) const;
 
+    /// \brief Sort the stored faces and face-edges by a locality key
+    ///
+    /// Sets the order in which getMeshFaces and getFaceEdges return
+    /// entities, so that per-face loops visit mesh data coherently.
+    /// Entities with equal keys keep their current relative order.
+    ///
+    /// \param keyFunc the sort key; by default, point index order
+    /// \param userData application data passed to keyFunc
+    void reorderEntities(
+        MeshTopoOrderKeyFunc keyFunc = MeshTopo::PointIndexOrderKey,
+        void *userData = NULL);
+
     /// Default constructor
     MeshSheet();
     /// Destructor
@@ -214,6 +254,20 @@ private:
     /// The unique name counter for sheets
     static MLUINT nameCounter_;
 
+    /// Offset point indices and renumber GREF and AREF values of the
+    /// sheet and all of its entities
+    virtual void remapReferences(MLINT indexOffset,
+        const MeshTopoIDRemap &gidRemap, const MeshTopoIDRemap &attidRemap);
+
+    /// \brief Copy the faces and face-edges of this sheet using the points
+    ///     of each partition into per-partition MeshSheet objects
+    ///
+    /// \param partition the point partitioning
+    /// \param[out] parts the new MeshSheet of each partition, or NULL if no
+    ///     entity uses the partition's points
+    void extractPartitions(MeshPointPartition &partition,
+        std::vector<MeshSheet *> &parts) const;
+
     /// Map point hash values to points
     std::map<pwiFnvHash::FNVHash, MeshPoint*> pointMap_; // not the owner
     /// Map point names to points
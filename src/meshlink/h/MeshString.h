@@ -93,6 +93,28 @@ public:
         const std::string &name,
         ParamVertex *pv1, ParamVertex *pv2, bool mapID);
 
+    /// \brief Add MeshEdges to the MeshString using packed point indices
+    ///
+    /// Adds each edge in turn, as addEdge would. Edges which could not be
+    /// stored are skipped.
+    ///
+    /// \param indices 2 point indices per edge
+    /// \param count the number of edges
+    /// \param mid unique ID of the mesh entities
+    /// \param aref the attribute reference ID (AttID) (optional)
+    /// \param gref the geometry reference ID
+    /// \param name the name of the mesh entities
+    /// \param paramVerts (optional) the ParamVertex of each point, parallel
+    ///     to indices; NULL entries for points without one
+    /// \param mapID whether to map the unique ID to the entity name
+    /// \return false if any edge could not be stored
+    virtual bool addEdges(const MLINT *indices, size_t count,
+        MLINT mid,
+        MLINT aref,
+        MLINT gref,
+        const std::string &name,
+        ParamVertex *const *paramVerts, bool mapID);
+
     /// \brief Find a MeshEdge in the MeshString associativity data
     ///
     /// \param i1,i2 the point indices of the desired string edge
@@ -118,9 +140,22 @@ public:
 
     /// \brief Return array of MeshEdges in the MeshString
     ///
-    /// Edges are returned in creation order.
+    /// Edges are returned in creation order, or in the order
+    /// set by reorderEntities.
     virtual void getMeshEdges(std::vector<const MeshEdge *> &edges) const;
 
+    /// \brief Sort the stored edges by a locality key
+    ///
+    /// Sets the order in which getMeshEdges returns edges, so that
+    /// per-edge loops visit mesh data coherently. Edges with equal
+    /// keys keep their current relative order.
+    ///
+    /// \param keyFunc the sort key; by default, point index order
+    /// \param userData application data passed to keyFunc
+    void reorderEntities(
+        MeshTopoOrderKeyFunc keyFunc = MeshTopo::PointIndexOrderKey,
+        void *userData = NULL);
+
     /// Default constructor
     MeshString();
     /// Destructor
@@ -135,6 +170,20 @@ private:
     /// The unique name counter for strings
     static MLUINT nameCounter_;
 
+    /// Offset point indices and renumber GREF and AREF values of the
+    /// string and all of its entities
+    virtual void remapReferences(MLINT indexOffset,
+        const MeshTopoIDRemap &gidRemap, const MeshTopoIDRemap &attidRemap);
+
+    /// \brief Copy the edges of this string using the points of each
+    ///     partition into per-partition MeshString objects
+    ///
+    /// \param partition the point partitioning
+    /// \param[out] parts the new MeshString of each partition, or NULL if no
+    ///     entity uses the partition's points
+    void extractPartitions(MeshPointPartition &partition,
+        std::vector<MeshString *> &parts) const;
+
     /// Map point index hash to point
     std::map<pwiFnvHash::FNVHash, MeshPoint*> pointMap_;  // not the owner
     /// Map point name to point
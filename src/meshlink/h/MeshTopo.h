@@ -15,12 +15,27 @@
 
 #include <algorithm>
 #include <map>
+#include <set>
 #include <string>
 #include <vector>
 
 #define MESH_TOPO_INVALID_REF -101
 #define MESH_TOPO_INDEX_UNUSED -101
 
+/// \brief Storage type of point indices and unique ID, AREF and GREF values
+///     held by mesh topology entities
+///
+/// Building with ML_COMPACT_INDICES defined stores these values as 32-bit
+/// integers to reduce the memory used by large associativity databases.
+/// All API functions still accept and return MLINT values; values which
+/// do not fit the storage type are rejected when entities are added.
+/// All modules sharing MeshTopo objects must use the same setting.
+#if defined(ML_COMPACT_INDICES)
+typedef MLINT32 MeshTopoIndex;
+#else
+typedef MLINT MeshTopoIndex;
+#endif
+
 /****************************************************************************
  *
  * pwiFnvHash class
@@ -67,6 +82,8 @@ private:
  */
 class ParamVertex {
 public:
+    friend class MeshTopo;
+
     /// Default constructor
     ParamVertex() :
         gref_(MESH_TOPO_INVALID_REF),
@@ -81,12 +98,9 @@ public:
     /// \param mid the unique ID (optional)
     /// \param u the parametric U value in the space of the referenced geometry
     /// \param v the parametric V value in the space of the referenced geometry
-    ParamVertex(const std::string & vref, MLINT gref, MLINT mid, MLREAL u, MLREAL v) :
-        vref_(vref),
-        gref_(gref),
-        mid_(mid),
-        u_(u),
-        v_(v) {}
+    /// The gref and mid values are checked as by
+    /// MeshTopo::checkedIndexValue.
+    ParamVertex(const std::string & vref, MLINT gref, MLINT mid, MLREAL u, MLREAL v);
 
     /// \brief Return the MeshPoint vertex reference
     const std::string &getVref() const { return vref_; }
@@ -114,7 +128,115 @@ private:
 typedef std::map<std::string /*vref*/, ParamVertex *> ParamVertVrefMap;
 typedef std::map<MLINT /*mid*/, std::string /*vref*/> ParamVertIDToVrefMap;
 
+/// Map of old to new GeometryGroup GID or MeshLinkAttribute AttID,
+/// used when merging MeshAssociativity data
+typedef std::map<MLINT /*old id*/, MLINT /*new id*/> MeshTopoIDRemap;
+
+
+/****************************************************************************
+ * MeshPointPartition class
+ ***************************************************************************/
+/**
+ * \class MeshPointPartition
+ *
+ * \brief Point partitioning used to extract per-partition associativity data
+ *
+ * Maps global point indices to partition-local point indices. In each
+ * partition, the points it owns are numbered first in global index order.
+ * Points owned by other partitions but used by the partition's elements
+ * (halo points) follow in order of first use. Local indices are one-based.
+ *
+ * The GeometryGroup GIDs and MeshLinkAttribute AttIDs referenced by the
+ * entities extracted for each partition are also recorded.
+ */
+class ML_STORAGE_CLASS MeshPointPartition {
+public:
+    /// \brief Constructor
+    ///
+    /// \param pointPartition the owning partition of each point, indexed by
+    ///     global point index. Points with a negative partition, or an index
+    ///     outside of the array, are not owned by any partition.
+    /// \param numPartitions the number of partitions
+    MeshPointPartition(const std::vector<MLINT> &pointPartition,
+        MLINT numPartitions);
+
+    /// \brief Return the number of partitions
+    MLINT getNumPartitions() const { return numPartitions_; }
+
+    /// \brief Return the partition owning a global point index, or -1
+    MLINT getPartition(MLINT globalIndex) const;
+
+    /// \brief Return the distinct partitions owning a set of points
+    ///
+    /// \param inds the global point indices
+    /// \param numInds the number of point indices
+    /// \param[out] partitions the owning partitions (array of size numInds)
+    /// \return the number of distinct partitions
+    int getPartitions(const MLINT *inds, int numInds, MLINT *partitions) const;
+
+    /// \brief Return the local index of a global point index in a partition
+    ///
+    /// The point is added to the partition as a halo point if needed.
+    MLINT getLocalIndex(MLINT partition, MLINT globalIndex);
+
+    /// \brief Find the local index of a global point index in a partition
+    ///
+    /// \return false if the point is not used by the partition
+    bool findLocalIndex(MLINT partition, MLINT globalIndex,
+        MLINT *localIndex) const;
+
+    /// \brief Return a copy of a ParamVertex using the local point index
+    ///
+    /// Integer vrefs are treated as global point indices and translated,
+    /// other vrefs are copied as-is. The ParamVertex GREF is recorded.
+    ///
+    /// \param partition the partition
+    /// \param pv the ParamVertex to copy (may be NULL)
+    /// \param[out] localPV storage for the copy
+    /// \return pointer to localPV, or NULL if pv is NULL
+    ParamVertex *getLocalParamVertex(MLINT partition, const ParamVertex *pv,
+        ParamVertex &localPV);
+
+    /// \brief Record GREF and AREF values referenced in a partition
+    void addReferences(MLINT partition, MLINT gref, MLINT aref);
+
+    /// \brief Return the GeometryGroup GIDs referenced in a partition
+    const std::set<MLINT> &getGrefs(MLINT partition) const;
+
+    /// \brief Return the MeshLinkAttribute AttIDs referenced in a partition
+    const std::set<MLINT> &getArefs(MLINT partition) const;
+
+    /// \brief Return the global point index of each local point of a partition
+    ///
+    /// Local point index i corresponds to element (i - 1).
+    const std::vector<MLINT> &getLocalToGlobal(MLINT partition) const;
+
+private:
+    /// The owning partition of each global point index
+    const std::vector<MLINT> &pointPartition_;
+    /// The number of partitions
+    MLINT numPartitions_;
+    /// The local index of each global point index in its owning partition
+    std::vector<MLINT> ownedLocalIndex_;
+    /// The global point index of each local point, per partition
+    std::vector<std::vector<MLINT> > localToGlobal_;
+    /// Map of global to local index of halo points, per partition
+    std::vector<std::map<MLINT, MLINT> > haloLocalIndex_;
+    /// The GREF values referenced, per partition
+    std::vector<std::set<MLINT> > grefs_;
+    /// The AREF values referenced, per partition
+    std::vector<std::set<MLINT> > arefs_;
+};
+
 class MeshAssociativity;
+class MeshTopo;
+
+/// \brief Caller-supplied sort key used to order the stored entities of a
+///     MeshSheet or MeshString
+///
+/// \param topo the entity
+/// \param userData the application data given to the reorder function
+typedef MLUINT (*MeshTopoOrderKeyFunc)(const MeshTopo *topo, void *userData);
 
 /****************************************************************************
  * MeshTopo class
@@ -209,17 +331,23 @@ public:
     /// \brief Set the ID of this MeshTopo
     ///
     /// \param id the unique ID of this mesh entity
-    virtual void setID( MLINT id );
+    /// \return false, leaving the ID unchanged, if id does not fit the
+    ///     MeshTopoIndex storage type
+    virtual bool setID( MLINT id );
 
     /// \brief Set the GeometryGroup GID referenced by this MeshTopo
     ///
     /// \param gref the geometry reference ID for this mesh entity
-    virtual void setGref( MLINT gref );
+    /// \return false, leaving the GREF unchanged, if gref does not fit the
+    ///     MeshTopoIndex storage type
+    virtual bool setGref( MLINT gref );
 
     /// \brief Set the MeshLinkAttribute AttID referenced by this MeshTopo
     ///
     /// \param aref the attribute reference ID (AttID) for this mesh entity
-    virtual void setAref( MLINT aref );
+    /// \return false, leaving the AREF unchanged, if aref does not fit the
+    ///     MeshTopoIndex storage type
+    virtual bool setAref( MLINT aref );
 
     /// \brief Set the reference of this MeshTopo
     //
@@ -270,21 +398,88 @@ public:
 
     static bool OrderCompare(const MeshTopo *topo1, const MeshTopo *topo2);
 
+    /// \brief Default locality sort key: the smallest point index of a
+    ///     MeshEdge or MeshFace
+    ///
+    /// Entities sorted by this key are visited in point index order,
+    /// which follows the point storage order of the application mesh.
+    /// Entities without point indices sort last.
+    static MLUINT PointIndexOrderKey(const MeshTopo *topo, void *userData);
+
+    /// \brief Whether all values fit the MeshTopoIndex storage type
+    ///
+    /// Always true unless built with ML_COMPACT_INDICES. An error message
+    /// is printed for the first value out of range.
+    ///
+    /// \param values the point index, ID, AREF or GREF values to check
+    /// \param numValues the number of values
+    static bool checkIndexStorage(const MLINT *values, int numValues);
+
+    /// \brief Return value if it fits the MeshTopoIndex storage type,
+    ///     otherwise MESH_TOPO_INVALID_REF
+    ///
+    /// Used for the values given to constructors, which cannot report
+    /// failure. An error message is printed for a value out of range.
+    ///
+    /// \param value the point index, ID, AREF or GREF value to check
+    static MLINT checkedIndexValue(MLINT value);
+
     /// Default constructor
     MeshTopo();
     /// Destructor
     ~MeshTopo();
 protected:
+    /// \brief Offset point indices and renumber GREF and AREF values
+    ///
+    /// Used when merging MeshAssociativity data. Applies to this entity,
+    /// the ParamVertex objects it owns and, for container entities,
+    /// all contained entities.
+    ///
+    /// \param indexOffset the offset added to all point indices
+    /// \param gidRemap map of old to new GeometryGroup GIDs
+    /// \param attidRemap map of old to new MeshLinkAttribute AttIDs
+    virtual void remapReferences(MLINT indexOffset,
+        const MeshTopoIDRemap &gidRemap, const MeshTopoIDRemap &attidRemap);
+
+    /// Return the remapped value of id, or id if it is not remapped
+    static MLINT remapID(MLINT id, const MeshTopoIDRemap &remap);
+
+    /// Return vref with indexOffset applied if vref is an integer point index
+    static std::string offsetVref(const std::string &vref, MLINT indexOffset);
+
+    /// Apply indexOffset and gidRemap to a ParamVertex
+    static void remapParamVertex(ParamVertex *pv, MLINT indexOffset,
+        const MeshTopoIDRemap &gidRemap);
+
+    /// \brief Copy the ParamVertex objects used by a partition to partTopo
+    ///
+    /// Only ParamVertex objects with an integer vref naming a point
+    /// already used by the partition are copied.
+    void extractParamVertices(MeshPointPartition &partition, MLINT part,
+        MeshTopo *partTopo) const;
+
+    /// \brief Sort entities by key and renumber their order counters
+    ///
+    /// Entities with equal keys keep their current relative order.
+    ///
+    /// \return the number of entities
+    static MLUINT reorderByKey(std::vector<MeshTopo *> &entities,
+        MeshTopoOrderKeyFunc keyFunc, void *userData);
+
+    /// Whether the unique ID of topo is mapped in idToNameMap
+    static bool isIDMapped(const std::map<MLINT, std::string> &idToNameMap,
+        const MeshTopo *topo);
+
     /// The application-defined reference string
     std::string ref_;
 
     // MeshLink schema: MeshElementAttributes
     /// The unique entity ID
-    MLINT mid_;
+    MeshTopoIndex mid_;
     /// The attribute reference ID (AttID)
-    MLINT aref_;
+    MeshTopoIndex aref_;
     /// The geometry reference ID
-    MLINT gref_;
+    MeshTopoIndex gref_;
     /// The name of the mesh entity
     std::string name_;
     /// creation order counter in parent entity
@@ -398,8 +593,12 @@ private:
     /// Return the hash value for this point
     pwiFnvHash::FNVHash getHash() const;
 
+    /// Offset the point index and renumber GREF and AREF values
+    virtual void remapReferences(MLINT indexOffset,
+        const MeshTopoIDRemap &gidRemap, const MeshTopoIDRemap &attidRemap);
+
     /// The index of this point
-    MLINT i1_;
+    MeshTopoIndex i1_;
     /// The ParamVertex associated with this point
     ParamVertex * paramVert_;
 };
@@ -523,10 +722,14 @@ private:
     /// Return a hash value for the given point indices
     static pwiFnvHash::FNVHash computeHash(MLINT i1, MLINT i2);
 
+    /// Offset the edge point indices and renumber GREF and AREF values
+    virtual void remapReferences(MLINT indexOffset,
+        const MeshTopoIDRemap &gidRemap, const MeshTopoIDRemap &attidRemap);
+
     /// The index of the starting point in the edge
-    MLINT i1_;
+    MeshTopoIndex i1_;
     /// The index of the ending point in the edge
-    MLINT i2_;
+    MeshTopoIndex i2_;
     /// The ParamVertex objects associated with the points in the edge
     ParamVertex * paramVerts_[2];
 };
@@ -680,14 +883,18 @@ private:
     static pwiFnvHash::FNVHash computeHash(MLINT i1, MLINT i2, MLINT i3,
         MLINT i4 = MESH_TOPO_INDEX_UNUSED);
 
+    /// Offset the face point indices and renumber GREF and AREF values
+    virtual void remapReferences(MLINT indexOffset,
+        const MeshTopoIDRemap &gidRemap, const MeshTopoIDRemap &attidRemap);
+
     /// The index of the first point
-    MLINT i1_;
+    MeshTopoIndex i1_;
     /// The index of the second point
-    MLINT i2_;
+    MeshTopoIndex i2_;
     /// The index of the third point
-    MLINT i3_;
+    MeshTopoIndex i3_;
     /// The index of the fourth point
-    MLINT i4_;
+    MeshTopoIndex i4_;
     /// The array of ParamVertex objects associated with the face points
     ParamVertex * paramVerts_[4];
 };
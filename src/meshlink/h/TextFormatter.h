@@ -0,0 +1,73 @@
+/****************************************************************************
+ *
+ * (C) 2021 Cadence Design Systems, Inc. All rights reserved worldwide.
+ *
+ * This sample source code is not supported by Cadence Design Systems, Inc.
+ * It is provided freely for demonstration purposes only.
+ * SEE THE WARRANTY DISCLAIMER AT THE BOTTOM OF THIS FILE.
+ *
+ ***************************************************************************/
+
+#ifndef TEXT_FORMATTER_CLASS
+#define TEXT_FORMATTER_CLASS
+
+#include "Types.h"
+
+#include <cstddef>
+#include <vector>
+
+/****************************************************************************
+ * TextFormatter class
+ ***************************************************************************/
+/**
+ * \class TextFormatter
+ *
+ * \brief Locale-free formatter of numeric text.
+ *
+ * The counterpart of TextScanner. Real values are written with the
+ * fewest significant digits that read back to the identical value
+ * (Grisu2), in printf %g style notation with a '.' decimal point.
+ */
+class TextFormatter {
+public:
+    /// Longest text written by formatReal, excluding the terminator
+    static const size_t MaxRealLength = 24;
+
+    /// Values per chunk formatted by one thread in formatRealTuples
+    static const size_t DefaultChunkValues = 1 << 16;
+
+    /// \brief Write the shortest text reading back as \p value
+    ///
+    /// \param value the value to format
+    /// \param[out] buf receives the text and a terminator, at least
+    ///                 MaxRealLength + 1 characters
+    /// \return the length of the text
+    static size_t formatReal(MLREAL value, char *buf);
+
+    /// \brief Format tuples of reals as space-separated text
+    ///
+    /// Chunks of tuples are formatted in parallel and concatenated in
+    /// order. Each tuple's text is terminated by a '\\0'.
+    ///
+    /// \param values,count the values, count tuples of \p tupleSize
+    /// \param tupleSize the number of values in each tuple
+    /// \param[out] text the terminated tuple texts
+    /// \param[out] offsets the offset in \p text of each tuple's text
+    /// \param numThreads threads to use, or 0 for ThreadPool::getConcurrency()
+    static void formatRealTuples(const MLREAL *values, size_t count,
+        size_t tupleSize, std::vector<char> &text,
+        std::vector<size_t> &offsets, size_t numThreads = 0);
+};
+
+#endif
+
+/****************************************************************************
+ *
+ * This file is licensed under the Cadence Public License Version 1.0 (the
+ * "License"), a copy of which is found in the included file named "LICENSE",
+ * and is distributed "AS IS." TO THE MAXIMUM EXTENT PERMITTED BY APPLICABLE
+ * LAW, CADENCE DISCLAIMS ALL WARRANTIES AND IN NO EVENT SHALL BE LIABLE TO
+ * ANY PARTY FOR ANY DAMAGES ARISING OUT OF OR RELATING TO USE OF THIS FILE.
+ * Please see the License for the full text of applicable terms.
+ *
+ ****************************************************************************/
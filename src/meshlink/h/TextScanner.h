@@ -0,0 +1,108 @@
+/****************************************************************************
+ *
+ * (C) 2021 Cadence Design Systems, Inc. All rights reserved worldwide.
+ *
+ * This sample source code is not supported by Cadence Design Systems, Inc.
+ * It is provided freely for demonstration purposes only.
+ * SEE THE WARRANTY DISCLAIMER AT THE BOTTOM OF THIS FILE.
+ *
+ ***************************************************************************/
+
+#ifndef TEXT_SCANNER_CLASS
+#define TEXT_SCANNER_CLASS
+
+#include "Types.h"
+
+#include <string>
+#include <vector>
+
+/****************************************************************************
+ * TextScanner class
+ ***************************************************************************/
+/**
+ * \class TextScanner
+ *
+ * \brief Locale-free scanner of whitespace-separated numeric text.
+ *
+ * Scans values in place from a character buffer without allocating or
+ * consulting the C/C++ locale. Used for the text-format content of
+ * MeshLink elements (face and edge indices, point references, ParamVertex
+ * coordinates and transforms). The buffer must outlive the scanner.
+ */
+class TextScanner {
+public:
+    /// \brief Scan \p length characters starting at \p text
+    TextScanner(const char *text, size_t length);
+    /// \brief Scan the contents of \p text
+    explicit TextScanner(const std::string &text);
+
+    /// \brief Whether only whitespace remains
+    bool atEnd();
+
+    /// \brief Scan the next value as a signed decimal integer
+    ///
+    /// Fails, without consuming input, if the next token is not an integer
+    /// that fits in the value type.
+    bool next(MLINT32 &value);
+    bool next(MLINT64 &value);
+
+    /// \brief Scan the next value as a decimal floating point number
+    ///
+    /// Accepts the forms written by printf %g as well as inf and nan.
+    /// Fails, without consuming input, if the next token is not a number.
+    bool next(MLREAL &value);
+
+    /// \brief Scan the next whitespace-separated token
+    bool nextToken(std::string &token);
+
+    /// \brief Scan up to \p count values into \p values
+    ///
+    /// \return the number of values scanned; scanning stops at the end
+    /// of the text or at the first token that is not a value of type T
+    template<typename T>
+    size_t scanArray(T *values, size_t count)
+    {
+        size_t n = 0;
+        while (n < count && next(values[n])) {
+            ++n;
+        }
+        return n;
+    }
+
+    /// \brief Append up to \p maxCount values to \p values
+    ///
+    /// \return the number of values appended
+    template<typename T>
+    size_t scanArray(std::vector<T> &values, size_t maxCount)
+    {
+        size_t n = 0;
+        T value;
+        while (n < maxCount && next(value)) {
+            values.push_back(value);
+            ++n;
+        }
+        return n;
+    }
+
+private:
+    /// Skip whitespace, returning false at the end of the text
+    bool skipSpace();
+    /// Scan a token as a signed integer within [minVal, maxVal]
+    bool nextInteger(MLINT64 &value, MLINT64 minVal, MLINT64 maxVal);
+
+    const char *pos_;
+    const char *end_;
+};
+
+#endif
+
+/****************************************************************************
+ *
+ * This file is licensed under the Cadence Public License Version 1.0 (the
+ * "License"), a copy of which is found in the included file named "LICENSE",
+ * and is distributed "AS IS." TO THE MAXIMUM EXTENT PERMITTED BY APPLICABLE
+ * LAW, CADENCE DISCLAIMS ALL WARRANTIES AND IN NO EVENT SHALL BE LIABLE TO
+ * ANY PARTY FOR ANY DAMAGES ARISING OUT OF OR RELATING TO USE OF THIS FILE.
+ * Please see the License for the full text of applicable terms.
+ *
+ ****************************************************************************/
@@ -0,0 +1,65 @@
+/****************************************************************************
+ *
+ * (C) 2021 Cadence Design Systems, Inc. All rights reserved worldwide.
+ *
+ * This sample source code is not supported by Cadence Design Systems, Inc.
+ * It is provided freely for demonstration purposes only.
+ * SEE THE WARRANTY DISCLAIMER AT THE BOTTOM OF THIS FILE.
+ *
+ ***************************************************************************/
+
+#ifndef THREAD_POOL_CLASS
+#define THREAD_POOL_CLASS
+
+#include <cstddef>
+#include <functional>
+
+/****************************************************************************
+ * ThreadPool class
+ ***************************************************************************/
+/**
+ * \class ThreadPool
+ *
+ * \brief Process-wide pool of worker threads shared by the MeshLink
+ * libraries.
+ *
+ * The pool is started on first use with one worker less than the hardware
+ * concurrency; the thread calling parallelFor makes up the difference.
+ * Nested parallelFor calls, made from a job of another parallelFor, run
+ * on the calling thread, so the number of threads never exceeds the
+ * hardware concurrency.
+ */
+class ThreadPool {
+public:
+    /// \brief Run job(i) for each i in [0, count)
+    ///
+    /// The calling thread and up to maxThreads - 1 pool workers each pull
+    /// the next unprocessed index until none remain. Returns when all the
+    /// jobs have completed.
+    ///
+    /// \param count the number of jobs
+    /// \param job the job, called concurrently with distinct indices
+    /// \param maxThreads threads to use, or 0 for getConcurrency()
+    static void parallelFor(size_t count,
+        const std::function<void(size_t)> &job, size_t maxThreads = 0);
+
+    /// \brief The number of threads parallelFor uses by default, the pool
+    ///     workers and the calling thread; 1 within a parallelFor job
+    static size_t getConcurrency();
+
+    /// \brief Whether the calling thread is running a parallelFor job
+    static bool inParallelJob();
+};
+
+#endif
+
+/****************************************************************************
+ *
+ * This file is licensed under the Cadence Public License Version 1.0 (the
+ * "License"), a copy of which is found in the included file named "LICENSE",
+ * and is distributed "AS IS." TO THE MAXIMUM EXTENT PERMITTED BY APPLICABLE
+ * LAW, CADENCE DISCLAIMS ALL WARRANTIES AND IN NO EVENT SHALL BE LIABLE TO
+ * ANY PARTY FOR ANY DAMAGES ARISING OUT OF OR RELATING TO USE OF THIS FILE.
+ * Please see the License for the full text of applicable terms.
+ *
+ ****************************************************************************/
@@ -31,6 +31,7 @@
 #include <nmb/TopologyProjectionBSPTreeWrapper.h>
 
 #include <algorithm>
+#include <cstring>
 #include <iostream>
 #include <sstream>
 #include <stdio.h>
@@ -101,6 +102,84 @@ GeometryKernelGeode::projectPoint(
     return true;
 }
 
+bool
+GeometryKernelGeode::projectPoints(
+    const GeometryGroup *group,
+    const MLREAL *points,
+    MLINT numPoints,
+    ProjectionResults &results
+)
+{
+    if (NULL == group || numPoints < 0 || (numPoints > 0 && NULL == points)) {
+        return false;
+    }
+    if (NULL != results.entityNames && results.entityNameBufLen < 1) {
+        return false;
+    }
+    // Look up the group BSPTree once for the whole batch
+    GE::ProjectionBSPTree *projectionBSPTree = getBSPTree(group);
+    if (!projectionBSPTree) return false;
+
+    ProjectionData projectionData(this);
+    GE::IsectProjPoint *projection = (GE::IsectProjPoint *)projectionData.getData();
+    if (NULL == projection) {
+        return false;
+    }
+
+    // Hit entity names are cached since many points land on the same entity
+    std::map<const GE::Entity *, std::string> hitNames;
+    bool allProjected = true;
+    MLINT i;
+    for (i = 0; i < numPoints; ++i) {
+        const MLREAL *vpoint = &points[3 * i];
+        const GE::Vector3D point(vpoint[0], vpoint[1], vpoint[2]);
+        bool ok = (GE::Error::No_errors ==
+            projectionBSPTree->Compute_CoordMinimumDistance(point,
+                NULL, NULL, projection));
+        if (ok && NULL != results.xyz) {
+            const GE::Vector3D &xyz = projection->End1.P;
+            results.xyz[3 * i + 0] = xyz.X();
+            results.xyz[3 * i + 1] = xyz.Y();
+            results.xyz[3 * i + 2] = xyz.Z();
+        }
+        if (ok && NULL != results.UV) {
+            const GE::Vector2D &uv = projection->End1.s;
+            results.UV[2 * i + 0] = uv.U();
+            results.UV[2 * i + 1] = uv.V();
+        }
+        if (ok && NULL != results.distance) {
+            results.distance[i] = projection->Distance;
+        }
+        if (ok && NULL != results.tolerance) {
+            ok = getProjectionTolerance(projectionData, results.tolerance[i]);
+        }
+        if (NULL != results.entityNames) {
+            const char *name = "";
+            if (ok) {
+                const GE::Entity *hit_entity = projection->End1.entity;
+                std::map<const GE::Entity *, std::string>::iterator nameIter =
+                    hitNames.find(hit_entity);
+                if (nameIter == hitNames.end()) {
+                    nameIter = hitNames.insert(std::make_pair(hit_entity,
+                        getFirstValue(hit_entity, "PW::Common", "name"))).first;
+                }
+                name = nameIter->second.c_str();
+                ok = ('\0' != name[0]);
+            }
+            char *nameBuf = &results.entityNames[i * results.entityNameBufLen];
+            strncpy(nameBuf, name, results.entityNameBufLen);
+            nameBuf[results.entityNameBufLen - 1] = '\0';
+        }
+        if (NULL != results.status) {
+            results.status[i] = ok ? ML_STATUS_OK : ML_STATUS_ERROR;
+        }
+        if (!ok) {
+            allProjected = false;
+        }
+    }
+    return allProjected;
+}
+
 // Map entity name to Geode entity
 void
 GeometryKernelGeode::buildEntityMap()
@@ -142,6 +221,7 @@ GeometryKernelGeode::getEntity(const std::string &name) const
 GE::ProjectionBSPTree *
 GeometryKernelGeode::getBSPTree(const GeometryGroup *group) 
 {
+    std::lock_guard<std::mutex> lock(BSPTreeMapMutex_);
     std::map<const GeometryGroup *, GE::ProjectionBSPTree *>::iterator treeIter;
     treeIter = BSPTreeMap_.find(group);
     if (treeIter != BSPTreeMap_.end()) {
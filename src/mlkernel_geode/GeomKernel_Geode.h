@@ -17,6 +17,7 @@
 #include <geom/Curve.h>
 
 #include <map>
+#include <mutex>
 #include <set> 
 #include <string> 
 
@@ -81,11 +82,27 @@ public:
         return "Geode";
     }
 
+    // Not reentrant: concurrent projection and evaluation would rely on
+    // Geode calls whose thread safety is unverified, namely
+    // ProjectionBSPTree::Compute_CoordMinimumDistance, Inquire_Tolerance
+    // and DictionaryAttribute reads. Return true only once those are
+    // confirmed safe to call concurrently on a shared model.
+    bool isReentrant() const
+    {
+        return false;
+    }
+
     // Project a point onto the Geometry group
     bool projectPoint(const GeometryGroup *group,
         const MLVector3D point,
         ProjectionData &projectionData);
 
+    // Project an array of points onto the Geometry group
+    bool projectPoints(const GeometryGroup *group,
+        const MLREAL *points,
+        MLINT numPoints,
+        ProjectionResults &results);
+
     bool getProjectionXYZ(ProjectionData &projectionData, MLVector3D point);
 
     bool getProjectionUV(ProjectionData &projectionData, MLVector2D UV);
@@ -190,7 +207,8 @@ private:
     /**
     * Get a projection BSPTree for the geometry group
     *
-    * Create if necessary and add to map.
+    * Create if necessary and add to map. Safe to call concurrently;
+    * the first caller for a group builds its tree while others wait.
     */
     GE::ProjectionBSPTree *getBSPTree(const GeometryGroup *group);
 
@@ -199,6 +217,8 @@ private:
     GE::EntityList<GE::Entity>  usable_entities_;
     std::map<std::string, GE::Entity*> usable_entity_map_;
     std::map<const GeometryGroup *, GE::ProjectionBSPTree *> BSPTreeMap_; 
+    /// Guards lazy construction of BSPTreeMap_ entries
+    std::mutex BSPTreeMapMutex_;
 };
 #endif
 
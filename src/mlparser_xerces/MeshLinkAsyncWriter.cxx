@@ -0,0 +1,104 @@
+/****************************************************************************
+ *
+ * (C) 2021 Cadence Design Systems, Inc. All rights reserved worldwide.
+ *
+ * This sample source code is not supported by Cadence Design Systems, Inc.
+ * It is provided freely for demonstration purposes only.
+ * SEE THE WARRANTY DISCLAIMER AT THE BOTTOM OF THIS FILE.
+ *
+ ***************************************************************************/
+
+#include "MeshAssociativity.h"
+#include "MeshLinkWriter.h"
+
+#include "MeshLinkAsyncWriter.h"
+#include "MeshLinkBinary.h"
+#include "MeshLinkParser_xerces.h"
+
+#include <iostream>
+#include <memory>
+#include <vector>
+
+
+// Load a snapshot container and write the associativity it holds
+static bool
+writeSnapshot(MeshLinkWriter *writer, const std::string &fname,
+    std::shared_ptr<std::vector<char> > snapshot, bool compress)
+{
+    MeshAssociativity meshAssoc;
+    {
+        MeshLinkParserXerces parser;
+        if (!parser.parseMeshLinkBuffer(snapshot->data(), snapshot->size(),
+                &meshAssoc)) {
+            std::cout << "Failed to load snapshot for " << fname << std::endl;
+            return false;
+        }
+    }
+    // Release the snapshot before the write
+    snapshot.reset();
+    return writer->writeMeshLinkFile(fname, &meshAssoc, compress);
+}
+
+
+// Write the associativity in place
+static bool
+writeInPlace(MeshLinkWriter *writer, const std::string &fname,
+    MeshAssociativity *meshAssociativity, bool compress)
+{
+    return writer->writeMeshLinkFile(fname, meshAssociativity, compress);
+}
+
+
+// Start writing MeshAssociativity data on a background thread
+bool
+MeshLinkAsyncWriter::start(const std::string &fname,
+    MeshAssociativity *meshAssociativity, bool compress, bool snapshot)
+{
+    wait();
+    status_ = false;
+    if (nullptr == meshAssociativity) {
+        std::cout << "Meshassociativity can't be null.\n";
+        return false;
+    }
+
+    if (snapshot) {
+        std::shared_ptr<std::vector<char> > container =
+            std::make_shared<std::vector<char> >();
+        MeshLinkBinaryWriter snapshotWriter;
+        if (!snapshotWriter.writeMeshLinkBuffer(meshAssociativity,
+                *container)) {
+            std::cout << "Failed to snapshot MeshAssociativity for " <<
+                fname << std::endl;
+            return false;
+        }
+        result_ = std::async(std::launch::async, writeSnapshot, &writer_,
+            fname, container, compress);
+    }
+    else {
+        result_ = std::async(std::launch::async, writeInPlace, &writer_,
+            fname, meshAssociativity, compress);
+    }
+    return true;
+}
+
+
+// Wait for the last write started to complete
+bool
+MeshLinkAsyncWriter::wait()
+{
+    if (result_.valid()) {
+        status_ = result_.get();
+    }
+    return status_;
+}
+
+/****************************************************************************
+ *
+ * This file is licensed under the Cadence Public License Version 1.0 (the
+ * "License"), a copy of which is found in the included file named "LICENSE",
+ * and is distributed "AS IS." TO THE MAXIMUM EXTENT PERMITTED BY APPLICABLE
+ * LAW, CADENCE DISCLAIMS ALL WARRANTIES AND IN NO EVENT SHALL BE LIABLE TO
+ * ANY PARTY FOR ANY DAMAGES ARISING OUT OF OR RELATING TO USE OF THIS FILE.
+ * Please see the License for the full text of applicable terms.
+ *
+ ****************************************************************************/
@@ -0,0 +1,111 @@
+/****************************************************************************
+ *
+ * (C) 2021 Cadence Design Systems, Inc. All rights reserved worldwide.
+ *
+ * This sample source code is not supported by Cadence Design Systems, Inc.
+ * It is provided freely for demonstration purposes only.
+ * SEE THE WARRANTY DISCLAIMER AT THE BOTTOM OF THIS FILE.
+ *
+ ***************************************************************************/
+
+#ifndef MESH_LINK_ASYNC_WRITER
+#define MESH_LINK_ASYNC_WRITER
+
+#include "Types.h"
+
+#include <chrono>
+#include <future>
+#include <string>
+
+
+class MeshAssociativity;
+class MeshLinkWriter;
+
+
+/****************************************************************************
+* MeshLinkAsyncWriter class
+***************************************************************************/
+/**
+* \class MeshLinkAsyncWriter
+*
+* \brief Writes MeshLink files on a background thread
+*
+* Runs a MeshLinkWriter on a background thread so that the calling
+* application can continue while the file is serialized. The object is
+* the handle of the write in progress: isComplete polls it and wait
+* blocks until it finishes and returns the writer's status.
+*
+* By default start takes a snapshot of the MeshAssociativity, as a
+* MeshLinkBinary container in memory, before returning; the background
+* thread loads the snapshot into a private MeshAssociativity and writes
+* that. The application may then modify or delete its MeshAssociativity
+* at once. Without a snapshot the MeshAssociativity is written in place
+* and must not be modified until the write completes.
+*
+* The MeshLinkWriter must outlive the write and must not be used by the
+* application until it completes. The destructor waits for a write in
+* progress.
+*/
+class MeshLinkAsyncWriter {
+public:
+    /// \brief Constructor
+    ///
+    /// \param writer the writer run on the background thread
+    MeshLinkAsyncWriter(MeshLinkWriter &writer) :
+        writer_(writer)
+    {
+    }
+    ~MeshLinkAsyncWriter()
+    {
+        wait();
+    }
+
+    /// \brief Start writing MeshAssociativity data to a MeshLink file
+    ///
+    /// Waits for any write in progress first.
+    /// \param fname the file to write
+    /// \param meshAssociativity the data to write
+    /// \param compress passed to MeshLinkWriter::writeMeshLinkFile
+    /// \param snapshot whether to write a snapshot of the data, taken
+    /// before returning, rather than the data in place
+    /// \return false if the snapshot could not be taken; the write
+    /// was not started
+    bool start(const std::string &fname, MeshAssociativity *meshAssociativity,
+        bool compress=true, bool snapshot=true);
+
+    /// \brief Whether the last write started has completed
+    ///
+    /// True if no write was started.
+    bool isComplete() const
+    {
+        return !result_.valid() ||
+            std::future_status::ready ==
+                result_.wait_for(std::chrono::seconds(0));
+    }
+
+    /// \brief Wait for the last write started to complete
+    ///
+    /// \return the status of the write; false if it failed or no write
+    /// was started
+    bool wait();
+
+private:
+    MeshLinkAsyncWriter(const MeshLinkAsyncWriter &);
+    MeshLinkAsyncWriter &operator=(const MeshLinkAsyncWriter &);
+
+    MeshLinkWriter &writer_;
+    std::future<bool> result_;
+    bool status_ { false };
+};
+#endif // MESH_LINK_ASYNC_WRITER
+
+/****************************************************************************
+ *
+ * This file is licensed under the Cadence Public License Version 1.0 (the
+ * "License"), a copy of which is found in the included file named "LICENSE",
+ * and is distributed "AS IS." TO THE MAXIMUM EXTENT PERMITTED BY APPLICABLE
+ * LAW, CADENCE DISCLAIMS ALL WARRANTIES AND IN NO EVENT SHALL BE LIABLE TO
+ * ANY PARTY FOR ANY DAMAGES ARISING OUT OF OR RELATING TO USE OF THIS FILE.
+ * Please see the License for the full text of applicable terms.
+ *
+ ****************************************************************************/
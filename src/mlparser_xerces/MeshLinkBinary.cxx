@@ -0,0 +1,1260 @@
+/****************************************************************************
+ *
+ * (C) 2021 Cadence Design Systems, Inc. All rights reserved worldwide.
+ *
+ * This sample source code is not supported by Cadence Design Systems, Inc.
+ * It is provided freely for demonstration purposes only.
+ * SEE THE WARRANTY DISCLAIMER AT THE BOTTOM OF THIS FILE.
+ *
+ ***************************************************************************/
+
+#include "MeshAssociativity.h"
+
+#include "MeshLinkBinary.h"
+#include "MeshLinkOutput.h"
+#include "MeshLinkParser_xerces.h"
+
+#include <climits>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <set>
+#include <type_traits>
+#include <utility>
+
+#if defined(WINDOWS)
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+typedef MeshLinkBinary MLB;
+
+const char MeshLinkBinary::Magic[8] = { 'M', 'L', 'B', 'I', 'N', 'A', 'R', 'Y' };
+
+// Sections are aligned for in-place access to their records
+static const size_t SECTION_ALIGNMENT = 8;
+
+static_assert(sizeof(MLB::FileHeader) == 32, "FileHeader layout");
+static_assert(sizeof(MLB::SectionEntry) == 24, "SectionEntry layout");
+static_assert(sizeof(MLB::ParamVertexRecord) == 40,
+    "ParamVertexRecord layout");
+
+
+// Smallest record size of each section type
+static size_t
+minRecordSize(MLUINT32 type)
+{
+    switch (type) {
+    case MLB::SectionStrings:               return 1;
+    case MLB::SectionRoot:                  return sizeof(MLB::RootRecord);
+    case MLB::SectionAttributes:            return sizeof(MLB::AttributeRecord);
+    case MLB::SectionGeometryFiles:         return sizeof(MLB::GeometryFileRecord);
+    case MLB::SectionGeometryReferences:    return sizeof(MLB::GeometryReferenceRecord);
+    case MLB::SectionGeometryGroups:        return sizeof(MLB::GeometryGroupRecord);
+    case MLB::SectionMeshFiles:             return sizeof(MLB::MeshFileRecord);
+    case MLB::SectionModels:                return sizeof(MLB::ModelRecord);
+    case MLB::SectionContainers:            return sizeof(MLB::ContainerRecord);
+    case MLB::SectionParamVertices:         return sizeof(MLB::ParamVertexRecord);
+    case MLB::SectionIntegers:              return sizeof(std::int64_t);
+    case MLB::SectionReferences:            return sizeof(std::uint64_t);
+    case MLB::SectionTransforms:            return sizeof(MLB::TransformRecord);
+    case MLB::SectionLinkages:              return sizeof(MLB::LinkageRecord);
+    default:                                return 0;
+    }
+}
+
+
+// Attribute reference string of a MeshLinkFile
+static std::string
+arefString(std::int64_t aref)
+{
+    return (MESH_TOPO_INVALID_REF == aref) ? std::string() :
+        std::to_string((long long)aref);
+}
+
+
+bool
+MeshLinkBinary::isBinary(const char *data, size_t length)
+{
+    return nullptr != data && length >= sizeof(Magic) &&
+        0 == memcmp(data, Magic, sizeof(Magic));
+}
+
+
+bool
+MeshLinkBinary::isBinaryFile(const std::string &fname)
+{
+    FILE *fp = fopen(fname.c_str(), "rb");
+    if (nullptr == fp) {
+        return false;
+    }
+    char magic[sizeof(Magic)];
+    bool result = (sizeof(magic) == fread(magic, 1, sizeof(magic), fp) &&
+        isBinary(magic, sizeof(magic)));
+    fclose(fp);
+    return result;
+}
+
+
+/****************************************************************************
+* MeshLinkMappedFile
+***************************************************************************/
+
+bool
+MeshLinkMappedFile::map(const std::string &fname, bool sequential)
+{
+    unmap();
+#if defined(WINDOWS)
+    HANDLE file = CreateFileA(fname.c_str(), GENERIC_READ, FILE_SHARE_READ,
+        NULL, OPEN_EXISTING,
+        sequential ? FILE_FLAG_SEQUENTIAL_SCAN : FILE_ATTRIBUTE_NORMAL, NULL);
+    if (INVALID_HANDLE_VALUE == file) {
+        return false;
+    }
+    LARGE_INTEGER size;
+    if (GetFileSizeEx(file, &size) && size.QuadPart > 0) {
+        HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY,
+            0, 0, NULL);
+        if (NULL != mapping) {
+            addr_ = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+            CloseHandle(mapping);
+            if (nullptr != addr_) {
+                length_ = (size_t)size.QuadPart;
+            }
+        }
+    }
+    CloseHandle(file);
+#else
+    int fd = open(fname.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+    struct stat st;
+    if (0 == fstat(fd, &st) && st.st_size > 0) {
+        void *addr = mmap(nullptr, (size_t)st.st_size, PROT_READ,
+            MAP_PRIVATE, fd, 0);
+        if (MAP_FAILED != addr) {
+            addr_ = addr;
+            length_ = (size_t)st.st_size;
+            if (sequential) {
+                madvise(addr_, length_, MADV_SEQUENTIAL);
+            }
+        }
+    }
+    close(fd);
+#endif
+    return nullptr != addr_;
+}
+
+
+void
+MeshLinkMappedFile::unmap()
+{
+    if (nullptr != addr_) {
+#if defined(WINDOWS)
+        UnmapViewOfFile(addr_);
+#else
+        munmap(addr_, length_);
+#endif
+    }
+    addr_ = nullptr;
+    length_ = 0;
+}
+
+
+/****************************************************************************
+* MeshLinkBinaryWriter
+***************************************************************************/
+
+std::uint64_t
+MeshLinkBinaryWriter::addString(const std::string &str)
+{
+    if (str.empty()) {
+        return 0;
+    }
+    std::uint64_t offset = strings_.size();
+    strings_.insert(strings_.end(), str.begin(), str.end());
+    strings_.push_back('\0');
+    return offset;
+}
+
+
+void
+MeshLinkBinaryWriter::addParamVertices(const MeshTopo *topo,
+    std::uint64_t &first, std::uint64_t &count)
+{
+    const ParamVertVrefMap &vertMap = topo->getParamVertVrefMap();
+    first = vertices_.size();
+    count = vertMap.size();
+    ParamVertVrefMap::const_iterator pvIter = vertMap.begin();
+    for (; pvIter != vertMap.end(); ++pvIter) {
+        const ParamVertex *vert = pvIter->second;
+        MLB::ParamVertexRecord rec;
+        rec.vref = addString(pvIter->first);
+        rec.gref = vert->getGref();
+        rec.mid = vert->getID();
+        MLREAL u, v;
+        vert->getUV(&u, &v);
+        rec.u = u;
+        rec.v = v;
+        vertices_.push_back(rec);
+    }
+}
+
+
+void
+MeshLinkBinaryWriter::addAttributes()
+{
+    std::vector<const MeshLinkAttribute *> atts = meshAssoc_->getAttributes();
+    for (auto att : atts) {
+        MLINT attID = att->getAttID();
+        const char *name{ nullptr };
+        const char *value{ nullptr };
+        meshAssoc_->getAttribute(attID, &name, &value);
+        if (nullptr != name && nullptr != value) {
+            MLB::AttributeRecord rec;
+            rec.attid = attID;
+            rec.isGroup = att->isGroup() ? 1 : 0;
+            rec.name = addString(name);
+            rec.contents = addString(value);
+            attributes_.push_back(rec);
+        }
+        else {
+            std::cout << "Failed to getAttribute (id: " << attID <<
+                ") name and/or value." << std::endl;
+        }
+    }
+}
+
+
+void
+MeshLinkBinaryWriter::addGeometryRefs()
+{
+    MLINT id;
+    // Stores the GeometryGroup ids of GeometryReferences that are
+    // part of GeometryGroups
+    std::set<MLINT> groupIDs;
+
+    const std::vector<GeometryFile> &geomFiles =
+        meshAssoc_->getGeometryFiles();
+    for (const auto &geomFile : geomFiles) {
+        MLB::GeometryFileRecord fileRec;
+        fileRec.filename = addString(geomFile.getFilename());
+        fileRec.aref = geomFile.getArefID(&id) ? id : MESH_TOPO_INVALID_REF;
+        fileRec.firstReference = geometryRefs_.size();
+
+        const std::vector<MLINT> &gids = geomFile.getGeometryGroupIDs();
+        for (auto gid : gids) {
+            GeometryGroup *group = meshAssoc_->getGeometryGroupByID(gid);
+            if (nullptr == group) {
+                continue;
+            }
+            MLB::GeometryReferenceRecord rec;
+            rec.gid = group->getID();
+            rec.aref = group->getArefID(&id) ? id : MESH_TOPO_INVALID_REF;
+            // Entity name - should only be one
+            const std::set<std::string> &names = group->getEntityNameSet();
+            rec.ref = names.empty() ? 0 : addString(*names.begin());
+            rec.name = addString(group->getName());
+            geometryRefs_.push_back(rec);
+
+            MLINT groupID;
+            if (group->getGroupID(groupID)) {
+                groupIDs.insert(groupID);
+            }
+        }
+        fileRec.numReferences = geometryRefs_.size() - fileRec.firstReference;
+        geometryFiles_.push_back(fileRec);
+    }
+
+    // Geometry Group - we only know about them if they're in the groupIDs set
+    for (auto gid : groupIDs) {
+        GeometryGroup *group = meshAssoc_->getGeometryGroupByID(gid);
+        if (nullptr == group) {
+            continue;
+        }
+        MLB::GeometryGroupRecord rec;
+        rec.gid = group->getID();
+        rec.aref = group->getArefID(&id) ? id : MESH_TOPO_INVALID_REF;
+        rec.name = addString(group->getName());
+        const std::vector<MLINT> &ids = group->getGIDs();
+        rec.firstGid = integers_.size();
+        rec.numGids = ids.size();
+        integers_.insert(integers_.end(), ids.begin(), ids.end());
+        geometryGroups_.push_back(rec);
+    }
+}
+
+
+bool
+MeshLinkBinaryWriter::addContainer(MeshTopo *container)
+{
+    MeshSheet *meshSheet = dynamic_cast<MeshSheet*>(container);
+    MeshString *meshString = dynamic_cast<MeshString*>(container);
+    std::vector<const MeshTopo *> elems;
+    if (nullptr != meshSheet) {
+        std::vector<const MeshFace *> faces;
+        meshSheet->getMeshFaces(faces);
+        elems.assign(faces.begin(), faces.end());
+    }
+    else if (nullptr != meshString) {
+        std::vector<const MeshEdge *> edges;
+        meshString->getMeshEdges(edges);
+        elems.assign(edges.begin(), edges.end());
+    }
+    else {
+        return false;
+    }
+
+    MLB::ContainerRecord rec;
+    rec.kind = (nullptr != meshSheet) ? MLB::KindSheet : MLB::KindString;
+    rec.name = addString(container->getName());
+    rec.ref = addString(container->getRef());
+    rec.gref = container->getGref();
+    rec.aref = container->getAref();
+    rec.mid = container->getID();
+    addParamVertices(container, rec.firstVertex, rec.numVertices);
+
+    // The elements share the identifiers of the first, as in MeshLink XML
+    rec.pointsPerElement = (nullptr != meshSheet) ? 3 : 2;
+    rec.isReference = 0;
+    rec.elementGref = MESH_TOPO_INVALID_REF;
+    rec.elementAref = MESH_TOPO_INVALID_REF;
+    rec.elementMid = MESH_TOPO_INVALID_REF;
+    rec.firstElement = 0;
+    rec.numElements = elems.size();
+    MLINT numInds = 0;
+    MLINT inds[4];
+    if (!elems.empty()) {
+        const MeshTopo *elem = elems[0];
+        rec.elementGref = elem->getGref();
+        rec.elementAref = elem->getAref();
+        rec.elementMid = elem->getID();
+        if (nullptr != meshSheet) {
+            dynamic_cast<const MeshFace *>(elem)->getInds(inds, &numInds);
+            if (4 == numInds) {
+                rec.pointsPerElement = 4;
+            }
+        }
+        else {
+            dynamic_cast<const MeshEdge *>(elem)->getInds(inds, &numInds);
+        }
+        rec.isReference = (0 == numInds) ? 1 : 0;
+    }
+
+    if (rec.isReference) {
+        rec.firstElement = references_.size();
+        for (auto elem : elems) {
+            references_.push_back(addString(elem->getRef()));
+        }
+    }
+    else {
+        rec.firstElement = integers_.size();
+        for (auto elem : elems) {
+            if (nullptr != meshSheet) {
+                dynamic_cast<const MeshFace *>(elem)->getInds(inds, &numInds);
+            }
+            else {
+                dynamic_cast<const MeshEdge *>(elem)->getInds(inds, &numInds);
+            }
+            integers_.insert(integers_.end(), inds,
+                inds + rec.pointsPerElement);
+        }
+    }
+    containers_.push_back(rec);
+    return true;
+}
+
+
+bool
+MeshLinkBinaryWriter::addMeshFiles()
+{
+    const std::vector<MeshFile> &meshFiles = meshAssoc_->getMeshFiles();
+    for (const auto &meshFile : meshFiles) {
+        MLB::MeshFileRecord fileRec;
+        MLINT aref;
+        fileRec.filename = addString(meshFile.getFilename());
+        fileRec.aref = meshFile.getArefID(&aref) ? aref : MESH_TOPO_INVALID_REF;
+        fileRec.firstModel = models_.size();
+
+        const std::vector<std::string> &modelRefs = meshFile.getModelRefs();
+        for (const auto &ref : modelRefs) {
+            MeshModel *meshModel = meshAssoc_->getMeshModelByRef(ref.c_str());
+            if (nullptr == meshModel) {
+                std::cout << "MeshModelReference " << ref << " not found." <<
+                    std::endl;
+                return false;
+            }
+            MLB::ModelRecord rec;
+            rec.ref = addString(meshModel->getRef());
+            rec.name = addString(meshModel->getName());
+            rec.gref = meshModel->getGref();
+            rec.aref = meshModel->getAref();
+            rec.mid = meshModel->getID();
+            addParamVertices(meshModel, rec.firstVertex, rec.numVertices);
+
+            // Mesh sheets, then mesh strings
+            rec.firstContainer = containers_.size();
+            std::vector<MeshSheet *> sheets;
+            meshModel->getMeshSheets(sheets);
+            for (auto sheet : sheets) {
+                addContainer(sheet);
+            }
+            std::vector<MeshString *> strings;
+            meshModel->getMeshStrings(strings);
+            for (auto string : strings) {
+                addContainer(string);
+            }
+            rec.numContainers = containers_.size() - rec.firstContainer;
+            models_.push_back(rec);
+        }
+        fileRec.numModels = models_.size() - fileRec.firstModel;
+        meshFiles_.push_back(fileRec);
+    }
+    return true;
+}
+
+
+void
+MeshLinkBinaryWriter::addPeriodicInfo()
+{
+    std::vector<const MeshLinkTransform *> xforms;
+    meshAssoc_->getTransforms(xforms);
+    for (auto xform : xforms) {
+        MLB::TransformRecord rec;
+        rec.xid = xform->getXID();
+        rec.aref = xform->hasAref() ? xform->getAref() : MESH_TOPO_INVALID_REF;
+        rec.name = addString(xform->getName());
+        rec.contents = addString(xform->getContents());
+        transforms_.push_back(rec);
+    }
+
+    std::vector<MeshElementLinkage *> links;
+    meshAssoc_->getMeshElementLinkages(links);
+    for (auto link : links) {
+        MLB::LinkageRecord rec;
+        std::string sourceEntityRef;
+        std::string targetEntityRef;
+        link->getEntityRefs(sourceEntityRef, targetEntityRef);
+        const char *name{ nullptr };
+        link->getName(&name);
+        rec.name = addString(nullptr != name ? name : "");
+        rec.sourceEntityRef = addString(sourceEntityRef);
+        rec.targetEntityRef = addString(targetEntityRef);
+        rec.aref = link->hasAref() ? link->getAref() : MESH_TOPO_INVALID_REF;
+        MLINT xref;
+        rec.xref = link->getXref(&xref) ? xref : MESH_TOPO_INVALID_REF;
+        linkages_.push_back(rec);
+    }
+}
+
+
+// A section to be written: its table entry and records
+struct SectionData {
+    SectionData(MLUINT32 type, size_t recordSize, const void *data,
+            size_t count) :
+        data(data)
+    {
+        entry.type = type;
+        entry.recordSize = (MLUINT32)recordSize;
+        entry.offset = 0;
+        entry.count = count;
+    }
+
+    MLB::SectionEntry entry;
+    const void *data;
+};
+
+
+// Output function appending to a std::vector<char>
+static bool
+bufferOutput(const void *data, size_t len, void *userData)
+{
+    std::vector<char> &buffer = *(std::vector<char> *)userData;
+    buffer.insert(buffer.end(), (const char *)data, (const char *)data + len);
+    return true;
+}
+
+
+// Write MeshAssociativity to a MeshLink binary container
+bool
+MeshLinkBinaryWriter::writeMeshLinkFile(const std::string &fname,
+    MeshAssociativity *meshAssociativity, bool compress, bool terminatePlatform)
+{
+    MeshLinkFileOutput output;
+    if (!output.open(fname)) {
+        return false;
+    }
+    bool result = writeContainer(meshAssociativity, MeshLinkFileOutput::write,
+        &output);
+    if (!output.close(result)) {
+        std::cout << "Failed to write " << fname << std::endl;
+        return false;
+    }
+    std::cout << "Completed writing " << fname << std::endl;
+    return true;
+}
+
+
+// Write MeshAssociativity to a MeshLink binary container in memory
+bool
+MeshLinkBinaryWriter::writeMeshLinkBuffer(MeshAssociativity *meshAssociativity,
+    std::vector<char> &buffer)
+{
+    buffer.clear();
+    if (!writeContainer(meshAssociativity, bufferOutput, &buffer)) {
+        buffer.clear();
+        return false;
+    }
+    return true;
+}
+
+
+// Write MeshAssociativity to a MeshLink binary container through a sink
+bool
+MeshLinkBinaryWriter::writeMeshLinkSink(MeshAssociativity *meshAssociativity,
+    MeshLinkSinkFunc sink, void *userData, bool compress,
+    bool terminatePlatform)
+{
+    if (nullptr == sink) {
+        return false;
+    }
+    return writeContainer(meshAssociativity, sink, userData);
+}
+
+
+// Build the sections and pass the container to the output function
+bool
+MeshLinkBinaryWriter::writeContainer(MeshAssociativity *meshAssociativity,
+    MeshLinkSinkFunc output, void *userData)
+{
+    if (nullptr != meshAssociativity) {
+        meshAssoc_ = meshAssociativity;
+    }
+    if (nullptr == meshAssoc_) {
+        std::cout << "Meshassociativity can't be null.\n";
+        return false;
+    }
+
+    strings_.assign(1, '\0');
+    attributes_.clear();
+    geometryFiles_.clear();
+    geometryRefs_.clear();
+    geometryGroups_.clear();
+    meshFiles_.clear();
+    models_.clear();
+    containers_.clear();
+    vertices_.clear();
+    integers_.clear();
+    references_.clear();
+    transforms_.clear();
+    linkages_.clear();
+
+    MLB::RootRecord root;
+    root.xmlVersion = addString("1.0");
+    root.xmlns = addString(xmlns_);
+    root.xmlnsXsi = addString(xmlns_xsi_);
+    root.schemaLocation = addString(schemaLocation_);
+    addAttributes();
+    addGeometryRefs();
+    if (!addMeshFiles()) {
+        std::cout << "Failed to write Mesh Files." << std::endl;
+        return false;
+    }
+    addPeriodicInfo();
+
+#define Section(Type, Vector) \
+    SectionData(MLB::Section##Type, sizeof(Vector[0]), Vector.data(), \
+        Vector.size())
+
+    std::vector<SectionData> sections;
+    sections.push_back(SectionData(MLB::SectionRoot, sizeof(root), &root, 1));
+    sections.push_back(Section(Attributes, attributes_));
+    sections.push_back(Section(GeometryFiles, geometryFiles_));
+    sections.push_back(Section(GeometryReferences, geometryRefs_));
+    sections.push_back(Section(GeometryGroups, geometryGroups_));
+    sections.push_back(Section(MeshFiles, meshFiles_));
+    sections.push_back(Section(Models, models_));
+    sections.push_back(Section(Containers, containers_));
+    sections.push_back(Section(ParamVertices, vertices_));
+    sections.push_back(Section(Integers, integers_));
+    sections.push_back(Section(References, references_));
+    sections.push_back(Section(Transforms, transforms_));
+    sections.push_back(Section(Linkages, linkages_));
+    sections.push_back(Section(Strings, strings_));
+#undef Section
+
+    // Lay out the sections after the header and section table
+    MLB::FileHeader header;
+    memcpy(header.magic, MLB::Magic, sizeof(header.magic));
+    header.version = MLB::Version;
+    header.byteOrder = MLB::ByteOrderMark;
+    header.numSections = sections.size();
+    header.sectionTableOffset = sizeof(header);
+    std::uint64_t offset = header.sectionTableOffset +
+        sections.size() * sizeof(MLB::SectionEntry);
+    for (auto &section : sections) {
+        offset = (offset + SECTION_ALIGNMENT - 1) & ~(std::uint64_t)
+            (SECTION_ALIGNMENT - 1);
+        section.entry.offset = offset;
+        offset += section.entry.recordSize * section.entry.count;
+    }
+
+    bool result = output(&header, sizeof(header), userData);
+    std::uint64_t pos = sizeof(header);
+    for (const auto &section : sections) {
+        result = result &&
+            output(&section.entry, sizeof(section.entry), userData);
+        pos += sizeof(section.entry);
+    }
+    static const char padding[SECTION_ALIGNMENT] = { 0 };
+    for (const auto &section : sections) {
+        size_t size = (size_t)(section.entry.recordSize * section.entry.count);
+        result = result &&
+            (section.entry.offset == pos ||
+             output(padding, (size_t)(section.entry.offset - pos), userData)) &&
+            (0 == size || output(section.data, size, userData));
+        pos = section.entry.offset + size;
+    }
+    return result;
+}
+
+
+/****************************************************************************
+* MeshLinkBinaryView class
+***************************************************************************/
+/**
+* \class MeshLinkBinaryView
+*
+* \brief Validated, read-only access to the sections of a MeshLinkBinary
+* container in memory
+*/
+class MeshLinkBinaryView {
+public:
+    MeshLinkBinaryView() :
+        ok_(true)
+    {
+        memset(sections_, 0, sizeof(sections_));
+    }
+
+    // Check the header and section table of the container
+    bool open(const char *data, size_t length);
+
+    // Record i of a section, i < count(type)
+    template<typename T>
+    const T &record(MLB::SectionType type, size_t i) const
+    {
+        return *(const T *)(sections_[type].data +
+            i * sections_[type].recordSize);
+    }
+
+    size_t count(MLB::SectionType type) const
+    {
+        return sections_[type].count;
+    }
+
+    // Whether records [first, first + num) are in a section
+    bool inRange(MLB::SectionType type, std::uint64_t first,
+        std::uint64_t num) const
+    {
+        return first <= count(type) && num <= count(type) - first;
+    }
+
+    const std::int64_t *integers(std::uint64_t first) const
+    {
+        return (const std::int64_t *)sections_[MLB::SectionIntegers].data +
+            first;
+    }
+
+    const std::uint64_t *references(std::uint64_t first) const
+    {
+        return (const std::uint64_t *)sections_[MLB::SectionReferences].data +
+            first;
+    }
+
+    // The string at an offset, or an empty string and not ok() if the
+    // offset is out of range
+    const char *string(std::uint64_t offset) const
+    {
+        if (offset < count(MLB::SectionStrings)) {
+            return sections_[MLB::SectionStrings].data + offset;
+        }
+        if (0 != offset) {
+            ok_ = false;
+        }
+        return "";
+    }
+
+    // Whether all strings referred to were in range
+    bool ok() const
+    {
+        return ok_;
+    }
+
+private:
+    struct Section {
+        const char *data;
+        size_t recordSize;
+        size_t count;
+    };
+
+    Section sections_[MLB::NumSectionTypes + 1];
+    // Aligned copy of a container not aligned in memory
+    std::vector<std::int64_t> aligned_;
+    mutable bool ok_;
+};
+
+
+bool
+MeshLinkBinaryView::open(const char *data, size_t length)
+{
+    if (!MLB::isBinary(data, length) || length < sizeof(MLB::FileHeader)) {
+        std::cout << "MeshLink binary container: invalid header." << std::endl;
+        return false;
+    }
+    if (0 != (size_t)data % SECTION_ALIGNMENT) {
+        aligned_.resize((length + sizeof(std::int64_t) - 1) /
+            sizeof(std::int64_t));
+        memcpy(aligned_.data(), data, length);
+        data = (const char *)aligned_.data();
+    }
+
+    const MLB::FileHeader &header = *(const MLB::FileHeader *)data;
+    if (MLB::ByteOrderMark != header.byteOrder) {
+        std::cout << "MeshLink binary container: written with a different "
+            "byte order." << std::endl;
+        return false;
+    }
+    if (0 == header.version || header.version > MLB::Version) {
+        std::cout << "MeshLink binary container: unsupported version " <<
+            header.version << "." << std::endl;
+        return false;
+    }
+    if (0 != header.sectionTableOffset % SECTION_ALIGNMENT ||
+            header.sectionTableOffset > length ||
+            header.numSections > (length - header.sectionTableOffset) /
+                sizeof(MLB::SectionEntry)) {
+        std::cout << "MeshLink binary container: invalid section table." <<
+            std::endl;
+        return false;
+    }
+
+    const MLB::SectionEntry *entries = (const MLB::SectionEntry *)
+        (data + header.sectionTableOffset);
+    for (std::uint64_t i = 0; i < header.numSections; ++i) {
+        const MLB::SectionEntry &entry = entries[i];
+        size_t minSize = minRecordSize(entry.type);
+        if (0 == minSize) {
+            // Unknown section from a later version
+            continue;
+        }
+        // Arrays of values must be packed, and records keep the
+        // alignment of their fields
+        bool isArray = (MLB::SectionStrings == entry.type ||
+            MLB::SectionIntegers == entry.type ||
+            MLB::SectionReferences == entry.type);
+        if (nullptr != sections_[entry.type].data ||
+                0 != entry.offset % SECTION_ALIGNMENT ||
+                entry.recordSize < minSize ||
+                (!isArray && 0 != entry.recordSize % SECTION_ALIGNMENT) ||
+                (isArray && entry.recordSize != minSize) ||
+                entry.offset > length ||
+                entry.count > (length - entry.offset) / entry.recordSize) {
+            std::cout << "MeshLink binary container: invalid section " <<
+                entry.type << "." << std::endl;
+            return false;
+        }
+        sections_[entry.type].data = data + entry.offset;
+        sections_[entry.type].recordSize = entry.recordSize;
+        sections_[entry.type].count = (size_t)entry.count;
+    }
+
+    // Every string must be terminated
+    size_t numChars = count(MLB::SectionStrings);
+    if (numChars > 0 && '\0' != sections_[MLB::SectionStrings].data[numChars - 1]) {
+        std::cout << "MeshLink binary container: unterminated string." <<
+            std::endl;
+        return false;
+    }
+    return true;
+}
+
+
+/****************************************************************************
+* MeshLinkParserXerces binary container reader
+***************************************************************************/
+
+bool
+MeshLinkParserXerces::loadBinaryContainer(const MeshLinkBinaryView &view,
+    MeshModel *model, size_t index)
+{
+    const MLB::ContainerRecord &rec =
+        view.record<MLB::ContainerRecord>(MLB::SectionContainers, index);
+    bool isSheet = (MLB::KindSheet == rec.kind);
+    const char *objName = isSheet ? "MeshSheet" : "MeshString";
+    std::string name(view.string(rec.name));
+    if (!(isSheet ? sheetFilter_ : stringFilter_).accepts(name, (MLINT)rec.gref)) {
+        return true;
+    }
+
+    bool validKind = isSheet ?
+        (3 == rec.pointsPerElement || 4 == rec.pointsPerElement) :
+        (MLB::KindString == rec.kind && 2 == rec.pointsPerElement);
+    bool validElements = rec.isReference ?
+        view.inRange(MLB::SectionReferences, rec.firstElement,
+            rec.numElements) :
+        (validKind && rec.numElements <= view.count(MLB::SectionIntegers) /
+            rec.pointsPerElement &&
+         view.inRange(MLB::SectionIntegers, rec.firstElement,
+            rec.numElements * rec.pointsPerElement));
+    if (!validKind || !validElements || rec.numElements > INT_MAX ||
+            !view.inRange(MLB::SectionParamVertices, rec.firstVertex,
+                rec.numVertices)) {
+        std::cout << objName << ": invalid binary container record." <<
+            std::endl;
+        return false;
+    }
+    if (0 == rec.numElements) {
+        std::cout << objName << ": error missing content." << std::endl;
+        return false;
+    }
+
+    MeshSheet *meshSheet = nullptr;
+    MeshString *meshString = nullptr;
+    MeshTopo *meshTopo;
+    if (isSheet) {
+        meshTopo = meshSheet = new MeshSheet();
+    }
+    else {
+        meshTopo = meshString = new MeshString();
+    }
+
+    // Identifying attributes, as parseMeshObjectAttributes
+    bool mapID = false;
+    bool result = true;
+    if (MESH_TOPO_INVALID_REF != rec.mid) {
+        if (!meshTopo->setID((MLINT)rec.mid)) {
+            result = false;
+        }
+        mapID = true;
+        if (isSheet ? nullptr != model->getMeshSheetByID((MLINT)rec.mid) :
+                nullptr != model->getMeshStringByID((MLINT)rec.mid)) {
+            std::cout << objName << ": mid identifier already in use." <<
+                std::endl;
+            result = false;
+        }
+    }
+    if (!name.empty()) {
+        meshTopo->setName(name);
+        if (isSheet ? nullptr != model->getMeshSheetByName(name) :
+                nullptr != model->getMeshStringByName(name)) {
+            std::cout << objName << ": name identifier already in use." <<
+                std::endl;
+            result = false;
+        }
+    }
+    else {
+        meshTopo->setName(meshTopo->getNextName().c_str());
+    }
+    if (MESH_TOPO_INVALID_REF != rec.gref &&
+            !meshTopo->setGref((MLINT)rec.gref)) {
+        result = false;
+    }
+    if (MESH_TOPO_INVALID_REF != rec.aref &&
+            !meshTopo->setAref((MLINT)rec.aref)) {
+        result = false;
+    }
+    std::string ref(view.string(rec.ref));
+    if (!ref.empty()) {
+        meshTopo->setRef(ref.c_str());
+        if (isSheet ? nullptr != model->getMeshSheetByRef(ref) :
+                nullptr != model->getMeshStringByRef(ref)) {
+            std::cout << objName << "Reference: ref identifier already in "
+                "use." << std::endl;
+            result = false;
+        }
+    }
+    if (!result) {
+        delete meshTopo;
+        return false;
+    }
+
+    for (std::uint64_t i = 0; i < rec.numVertices; ++i) {
+        const MLB::ParamVertexRecord &pv =
+            view.record<MLB::ParamVertexRecord>(MLB::SectionParamVertices,
+                (size_t)(rec.firstVertex + i));
+        meshTopo->addParamVertex(new ParamVertex(view.string(pv.vref),
+            (MLINT)pv.gref, (MLINT)pv.mid, pv.u, pv.v),
+            MESH_TOPO_INVALID_REF != pv.mid);
+    }
+
+    // Faces or edges; gref defaults to the container's
+    MLINT mid = (MLINT)rec.elementMid;
+    MLINT aref = (MLINT)rec.elementAref;
+    MLINT gref = (MESH_TOPO_INVALID_REF != rec.elementGref) ?
+        (MLINT)rec.elementGref : meshTopo->getGref();
+    bool elemMapID = (MESH_TOPO_INVALID_REF != rec.elementMid);
+    size_t count = (size_t)rec.numElements;
+    std::string elemName;
+    if (!rec.isReference) {
+        // Indices are used in place when they are MLINT
+        const std::int64_t *ints = view.integers(rec.firstElement);
+        std::vector<MLINT> converted;
+        const MLINT *indices = reinterpret_cast<const MLINT *>(ints);
+        if (!std::is_same<MLINT, std::int64_t>::value) {
+            converted.assign(ints, ints + count * rec.pointsPerElement);
+            indices = converted.data();
+        }
+        if (isSheet) {
+            addMeshFaces(model, meshTopo, indices, count,
+                3 == rec.pointsPerElement, mid, aref, gref, elemName,
+                elemMapID);
+        }
+        else {
+            addMeshEdges(model, meshTopo, indices, count, mid, aref, gref,
+                elemName, elemMapID);
+        }
+    }
+    else {
+        const std::uint64_t *refs = view.references(rec.firstElement);
+        for (size_t i = 0; i < count; ++i) {
+            std::string elemRef(view.string(refs[i]));
+            if (isSheet) {
+                if (!model->addFace(elemRef, mid, aref, gref, elemName,
+                        nullptr, nullptr, nullptr, elemMapID) ||
+                    !meshSheet->addFace(elemRef, mid, aref, gref, elemName,
+                        nullptr, nullptr, nullptr, elemMapID)) {
+                    printf("MeshFaceReference: error storing\n   %s\n",
+                        elemRef.c_str());
+                }
+            }
+            else {
+                if (!model->addEdge(elemRef, mid, aref, gref, elemName,
+                        nullptr, nullptr, elemMapID) ||
+                    !meshString->addEdge(elemRef, mid, aref, gref, elemName,
+                        nullptr, nullptr, elemMapID)) {
+                    printf("MeshEdgeReference: error storing\n   %s\n",
+                        elemRef.c_str());
+                }
+            }
+        }
+    }
+
+    result = isSheet ? storeMeshSheet(model, meshSheet) :
+        storeMeshString(model, meshString, mapID);
+    if (!result) {
+        delete meshTopo;
+    }
+    return result;
+}
+
+
+bool
+MeshLinkParserXerces::loadBinaryModel(const MeshLinkBinaryView &view,
+    MeshFile &meshFile, size_t index)
+{
+    const MLB::ModelRecord &rec =
+        view.record<MLB::ModelRecord>(MLB::SectionModels, index);
+    std::string ref(view.string(rec.ref));
+    std::string name(view.string(rec.name));
+    if (ref.empty()) {
+        std::cout << "MeshModelReference: missing ref attribute." << std::endl;
+        return false;
+    }
+    if (!modelFilter_.accepts(name, (MLINT)rec.gref)) {
+        return true;
+    }
+    if (!view.inRange(MLB::SectionContainers, rec.firstContainer,
+                rec.numContainers) ||
+            !view.inRange(MLB::SectionParamVertices, rec.firstVertex,
+                rec.numVertices)) {
+        std::cout << "MeshModelReference: invalid binary container record." <<
+            std::endl;
+        return false;
+    }
+
+    // As createMeshModel
+    bool mapID = (MESH_TOPO_INVALID_REF != rec.mid);
+    if (mapID && nullptr != meshAssociativity_->getMeshModelByID(rec.mid)) {
+        std::cout << "MeshModelReference: mid identifier already in "
+            "use." << std::endl;
+        return false;
+    }
+    if (!name.empty() &&
+            nullptr != meshAssociativity_->getMeshModelByName(name)) {
+        std::cout << "MeshModelReference: name identifier already in "
+            "use." << std::endl;
+        return false;
+    }
+    MeshModel *meshModel = new MeshModel(ref, (MLINT)rec.mid,
+        (MLINT)rec.aref, (MLINT)rec.gref, name);
+    if (!meshAssociativity_->addMeshModel(meshModel, mapID)) {
+        std::cout << "MeshModelReference: error storing model." << std::endl;
+        delete meshModel;
+        return false;
+    }
+    meshFile.addModelRef(ref);
+
+    for (std::uint64_t i = 0; i < rec.numContainers; ++i) {
+        if (!loadBinaryContainer(view, meshModel,
+                (size_t)(rec.firstContainer + i))) {
+            std::cout << "MeshModelReference node: problem reading mesh "
+                "container " << i + 1 << std::endl;
+            return false;
+        }
+    }
+
+    // ParamVertices, then the MeshPointReference points located by them
+    for (std::uint64_t i = 0; i < rec.numVertices; ++i) {
+        const MLB::ParamVertexRecord &pv =
+            view.record<MLB::ParamVertexRecord>(MLB::SectionParamVertices,
+                (size_t)(rec.firstVertex + i));
+        meshModel->addParamVertex(new ParamVertex(view.string(pv.vref),
+            (MLINT)pv.gref, (MLINT)pv.mid, pv.u, pv.v),
+            MESH_TOPO_INVALID_REF != pv.mid);
+    }
+    std::string pointName;
+    for (std::uint64_t i = 0; i < rec.numVertices; ++i) {
+        const MLB::ParamVertexRecord &pv =
+            view.record<MLB::ParamVertexRecord>(MLB::SectionParamVertices,
+                (size_t)(rec.firstVertex + i));
+        std::string vref(view.string(pv.vref));
+        if (!meshModel->addPoint(vref, MESH_TOPO_INVALID_REF,
+                MESH_TOPO_INVALID_REF, (MLINT)pv.gref, pointName,
+                meshModel->getParamVertByVref(vref), false)) {
+            printf("MeshPointReference: error storing\n   %s\n",
+                vref.c_str());
+        }
+    }
+
+    if (verbose_level_ > 0) {
+        if (!name.empty()) {
+            printf("MeshModel %s geometry associations:\n", name.c_str());
+        }
+        printf("%8" MLINT_FORMAT " mesh edges\n", meshModel->getNumEdges());
+        printf("%8" MLINT_FORMAT " mesh faces\n", meshModel->getNumFaces());
+    }
+    return true;
+}
+
+
+bool
+MeshLinkParserXerces::parseMeshLinkBinary(const char *data, size_t length,
+    MeshAssociativity *meshAssociativity)
+{
+    if (!meshAssociativity) { return false; }
+    meshAssociativity_ = meshAssociativity;
+    MeshLinkBinaryView view;
+    if (!view.open(data, length)) {
+        return false;
+    }
+
+    // Attributes, then the AttributeGroups referring to them
+    meshAssociativity_->clearAttributes();
+    for (int groups = 0; groups < 2; ++groups) {
+        for (size_t i = 0; i < view.count(MLB::SectionAttributes); ++i) {
+            const MLB::AttributeRecord &rec =
+                view.record<MLB::AttributeRecord>(MLB::SectionAttributes, i);
+            bool isGroup = (0 != rec.isGroup);
+            if (isGroup != (1 == groups)) {
+                continue;
+            }
+            const char *elemName = isGroup ? "AttributeGroup" : "Attribute";
+            if (nullptr != meshAssociativity_->getAttributeByID(rec.attid)) {
+                std::cout << elemName << " reuses existing attid attribute \"" <<
+                    rec.attid << "\"" << std::endl;
+                continue;
+            }
+            std::string name(view.string(rec.name));
+            std::string contents(view.string(rec.contents));
+            MeshLinkAttribute mlAtt((MLINT)rec.attid, name, contents, isGroup,
+                *meshAssociativity_);
+            if (mlAtt.isValid()) {
+                meshAssociativity_->addAttribute(std::move(mlAtt));
+            }
+        }
+    }
+
+    // GeometryFiles and their GeometryReferences
+    for (size_t i = 0; i < view.count(MLB::SectionGeometryFiles); ++i) {
+        const MLB::GeometryFileRecord &rec =
+            view.record<MLB::GeometryFileRecord>(MLB::SectionGeometryFiles, i);
+        if (!view.inRange(MLB::SectionGeometryReferences, rec.firstReference,
+                rec.numReferences)) {
+            std::cout << "GeometryFile: invalid binary container record." <<
+                std::endl;
+            return false;
+        }
+        std::string filename(view.string(rec.filename));
+        std::string aref(arefString(rec.aref));
+        GeometryFile geomFile(filename, aref);
+        for (std::uint64_t j = 0; j < rec.numReferences; ++j) {
+            const MLB::GeometryReferenceRecord &refRec =
+                view.record<MLB::GeometryReferenceRecord>(
+                    MLB::SectionGeometryReferences,
+                    (size_t)(rec.firstReference + j));
+            const char *ref = view.string(refRec.ref);
+            const char *name = view.string(refRec.name);
+            GeometryGroup group;
+            group.setID((MLINT)refRec.gid);
+            group.addEntityName(ref);
+            group.setName('\0' != *name ? name : ref);
+            if (MESH_TOPO_INVALID_REF != refRec.aref) {
+                group.setAref((MLINT)refRec.aref);
+            }
+            geomFile.addGeometryGroupID(group.getID());
+            meshAssociativity_->addGeometryGroup(std::move(group));
+        }
+        meshAssociativity_->addGeometryFile(std::move(geomFile));
+    }
+
+    // GeometryGroups of GeometryReferences
+    for (size_t i = 0; i < view.count(MLB::SectionGeometryGroups); ++i) {
+        const MLB::GeometryGroupRecord &rec =
+            view.record<MLB::GeometryGroupRecord>(MLB::SectionGeometryGroups, i);
+        if (!view.inRange(MLB::SectionIntegers, rec.firstGid, rec.numGids)) {
+            std::cout << "GeometryGroup: invalid binary container record." <<
+                std::endl;
+            return false;
+        }
+        GeometryGroup group;
+        const char *name = view.string(rec.name);
+        group.setName('\0' != *name ? name :
+            ("geom_group_" + std::to_string((long long)rec.gid)).c_str());
+        group.setID((MLINT)rec.gid);
+        const std::int64_t *gids = view.integers(rec.firstGid);
+        for (std::uint64_t j = 0; j < rec.numGids; ++j) {
+            MLINT gid = (MLINT)gids[j];
+            group.addGID(gid);
+            GeometryGroup *refgroup =
+                meshAssociativity_->getGeometryGroupByID(gid);
+            if (nullptr == refgroup) {
+                std::cout << "GeometryGroup unknown gid in content \"" <<
+                    gid << "\"" << std::endl;
+                return false;
+            }
+            refgroup->setGroupID(group.getID());
+            for (const auto &ent : refgroup->getEntityNameSet()) {
+                group.addEntityName(ent.c_str());
+            }
+        }
+        if (MESH_TOPO_INVALID_REF != rec.aref) {
+            group.setAref((MLINT)rec.aref);
+        }
+        meshAssociativity_->addGeometryGroup(std::move(group));
+    }
+
+    // MeshFiles and their models
+    if (0 == view.count(MLB::SectionMeshFiles)) {
+        std::cout << "Mesh Link File element(s) not found." << std::endl;
+        return false;
+    }
+    for (size_t i = 0; i < view.count(MLB::SectionMeshFiles); ++i) {
+        const MLB::MeshFileRecord &rec =
+            view.record<MLB::MeshFileRecord>(MLB::SectionMeshFiles, i);
+        if (0 == rec.numModels ||
+                !view.inRange(MLB::SectionModels, rec.firstModel,
+                    rec.numModels)) {
+            std::cout << "MeshFile node: no model references." << std::endl;
+            return false;
+        }
+        std::string filename(view.string(rec.filename));
+        std::string aref(arefString(rec.aref));
+        MeshFile mFile(filename, aref);
+        bool result = true;
+        for (std::uint64_t j = 0; result && j < rec.numModels; ++j) {
+            result = loadBinaryModel(view, mFile, (size_t)(rec.firstModel + j));
+        }
+        meshAssociativity_->addMeshFile(std::move(mFile));
+        if (!result) {
+            std::cout << "MeshFile node: problem reading mesh reference." <<
+                std::endl;
+            return false;
+        }
+    }
+
+    // Transforms, then the MeshElementLinkages referring to them
+    meshAssociativity_->clearTransforms();
+    meshAssociativity_->clearMeshElementLinkages();
+    for (size_t i = 0; i < view.count(MLB::SectionTransforms); ++i) {
+        const MLB::TransformRecord &rec =
+            view.record<MLB::TransformRecord>(MLB::SectionTransforms, i);
+        if (nullptr != meshAssociativity_->getTransformByID(rec.xid)) {
+            std::cout << "Transform reuses existing xid attribute \"" <<
+                rec.xid << "\"" << std::endl;
+            continue;
+        }
+        std::string name(view.string(rec.name));
+        std::string contents(view.string(rec.contents));
+        MeshLinkTransform mlXform((MLINT)rec.xid, name, contents,
+            *meshAssociativity_);
+        if (mlXform.isValid()) {
+            if (MESH_TOPO_INVALID_REF != rec.aref) {
+                mlXform.setAref((MLINT)rec.aref);
+            }
+            meshAssociativity_->addTransform(std::move(mlXform));
+        }
+    }
+    for (size_t i = 0; i < view.count(MLB::SectionLinkages); ++i) {
+        const MLB::LinkageRecord &rec =
+            view.record<MLB::LinkageRecord>(MLB::SectionLinkages, i);
+        std::string name(view.string(rec.name));
+        std::string srcEntRef(view.string(rec.sourceEntityRef));
+        std::string tgtEntRef(view.string(rec.targetEntityRef));
+        MeshElementLinkage *mlLink = new MeshElementLinkage(name, srcEntRef,
+            tgtEntRef, *meshAssociativity_);
+        if (!mlLink->isValid() ||
+                // stores and takes ownership of pointer
+                !meshAssociativity_->addMeshElementLinkage(mlLink)) {
+            delete mlLink;
+            std::cout << "MeshElementLinkage missing source or target entity " <<
+                std::endl;
+            return false;
+        }
+        if (MESH_TOPO_INVALID_REF != rec.xref &&
+                !mlLink->setXref((MLINT)rec.xref, *meshAssociativity_)) {
+            std::cout << "MeshElementLinkage missing xref transform" <<
+                std::endl;
+            return false;
+        }
+        if (MESH_TOPO_INVALID_REF != rec.aref) {
+            mlLink->setAref((MLINT)rec.aref);
+        }
+    }
+
+    // Cached for writing the MeshAssociativity as XML
+    if (view.count(MLB::SectionRoot) > 0) {
+        const MLB::RootRecord &root =
+            view.record<MLB::RootRecord>(MLB::SectionRoot, 0);
+        xmlVersion_ = view.string(root.xmlVersion);
+        xmlns_ = view.string(root.xmlns);
+        xmlns_xsi_ = view.string(root.xmlnsXsi);
+        schemaLocation_ = view.string(root.schemaLocation);
+    }
+
+    if (!view.ok()) {
+        std::cout << "MeshLink binary container: invalid string offset." <<
+            std::endl;
+        return false;
+    }
+
+    if (reorderEntities_) {
+        meshAssociativity_->reorderEntities();
+    }
+    return true;
+}
+
+/****************************************************************************
+ *
+ * This file is licensed under the Cadence Public License Version 1.0 (the
+ * "License"), a copy of which is found in the included file named "LICENSE",
+ * and is distributed "AS IS." TO THE MAXIMUM EXTENT PERMITTED BY APPLICABLE
+ * LAW, CADENCE DISCLAIMS ALL WARRANTIES AND IN NO EVENT SHALL BE LIABLE TO
+ * ANY PARTY FOR ANY DAMAGES ARISING OUT OF OR RELATING TO USE OF THIS FILE.
+ * Please see the License for the full text of applicable terms.
+ *
+ ****************************************************************************/
@@ -0,0 +1,372 @@
+/****************************************************************************
+ *
+ * (C) 2021 Cadence Design Systems, Inc. All rights reserved worldwide.
+ *
+ * This sample source code is not supported by Cadence Design Systems, Inc.
+ * It is provided freely for demonstration purposes only.
+ * SEE THE WARRANTY DISCLAIMER AT THE BOTTOM OF THIS FILE.
+ *
+ ***************************************************************************/
+
+#ifndef MESH_LINK_BINARY
+#define MESH_LINK_BINARY
+
+#include "Types.h"
+#include "MeshLinkWriter.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+
+class MeshAssociativity;
+class MeshModel;
+class MeshTopo;
+
+
+/****************************************************************************
+* MeshLinkBinary class
+***************************************************************************/
+/**
+* \class MeshLinkBinary
+*
+* \brief Layout of the MeshLink binary container (.mlb)
+*
+* The container holds the same MeshAssociativity data as a MeshLink XML
+* file in flat sections that are used in place when the file is memory
+* mapped. All values are in the byte order of the host that wrote the
+* file; the byteOrder header field lets a reader detect a mismatch.
+*
+* The file begins with a FileHeader, followed by the SectionEntry table
+* and the sections. Each section is an array of count records of
+* recordSize bytes, starting at an 8-byte aligned offset. A reader
+* accepts records larger than it expects, so later versions may append
+* fields to a record.
+*
+* Strings are stored once in the Strings section, each terminated by a
+* '\\0', and are referred to by their offset in it; offset 0 is the empty
+* string. Absent integer attributes hold MESH_TOPO_INVALID_REF.
+*
+* The Integers section holds the GeometryGroup member ids and the point
+* indices of each mesh face and edge block; the References section holds
+* the string offsets of each face and edge reference block. The
+* ParamVertex records of a model or mesh container are contiguous, as are
+* the containers of a model and the models of a mesh file.
+*/
+class MeshLinkBinary {
+public:
+    /// Magic number beginning every container
+    static const char Magic[8];
+
+    /// Container format version written
+    static const MLUINT32 Version = 1;
+
+    /// Value of the byteOrder header field as written by the host
+    static const MLUINT32 ByteOrderMark = 0x01020304;
+
+    /// Section types
+    enum SectionType {
+        SectionStrings = 1,         ///< char
+        SectionRoot,                ///< RootRecord, one record
+        SectionAttributes,          ///< AttributeRecord
+        SectionGeometryFiles,       ///< GeometryFileRecord
+        SectionGeometryReferences,  ///< GeometryReferenceRecord
+        SectionGeometryGroups,      ///< GeometryGroupRecord
+        SectionMeshFiles,           ///< MeshFileRecord
+        SectionModels,              ///< ModelRecord
+        SectionContainers,          ///< ContainerRecord
+        SectionParamVertices,       ///< ParamVertexRecord
+        SectionIntegers,            ///< std::int64_t
+        SectionReferences,          ///< std::uint64_t string offsets
+        SectionTransforms,          ///< TransformRecord
+        SectionLinkages,            ///< LinkageRecord
+        NumSectionTypes = SectionLinkages
+    };
+
+    /// Container kinds of ContainerRecord
+    enum ContainerKind {
+        KindSheet = 0,              ///< MeshSheet of faces
+        KindString = 1              ///< MeshString of edges
+    };
+
+    struct FileHeader {
+        char magic[8];
+        MLUINT32 version;
+        MLUINT32 byteOrder;
+        std::uint64_t numSections;
+        std::uint64_t sectionTableOffset;
+    };
+
+    struct SectionEntry {
+        MLUINT32 type;
+        MLUINT32 recordSize;
+        std::uint64_t offset;
+        std::uint64_t count;
+    };
+
+    /// MeshLink element attributes for writing XML
+    struct RootRecord {
+        std::uint64_t xmlVersion;
+        std::uint64_t xmlns;
+        std::uint64_t xmlnsXsi;
+        std::uint64_t schemaLocation;
+    };
+
+    struct AttributeRecord {
+        std::int64_t attid;
+        std::int64_t isGroup;
+        std::uint64_t name;
+        std::uint64_t contents;
+    };
+
+    struct GeometryFileRecord {
+        std::uint64_t filename;
+        std::int64_t aref;
+        std::uint64_t firstReference;   ///< GeometryReferenceRecord index
+        std::uint64_t numReferences;
+    };
+
+    struct GeometryReferenceRecord {
+        std::int64_t gid;
+        std::int64_t aref;
+        std::uint64_t ref;
+        std::uint64_t name;
+    };
+
+    struct GeometryGroupRecord {
+        std::int64_t gid;
+        std::int64_t aref;
+        std::uint64_t name;
+        std::uint64_t firstGid;         ///< Integers index
+        std::uint64_t numGids;
+    };
+
+    struct MeshFileRecord {
+        std::uint64_t filename;
+        std::int64_t aref;
+        std::uint64_t firstModel;       ///< ModelRecord index
+        std::uint64_t numModels;
+    };
+
+    struct ModelRecord {
+        std::uint64_t ref;
+        std::uint64_t name;
+        std::int64_t gref;
+        std::int64_t aref;
+        std::int64_t mid;
+        std::uint64_t firstVertex;      ///< ParamVertexRecord index
+        std::uint64_t numVertices;
+        std::uint64_t firstContainer;   ///< ContainerRecord index
+        std::uint64_t numContainers;
+    };
+
+    /// A MeshSheet or MeshString and its block of faces or edges
+    struct ContainerRecord {
+        std::int64_t kind;              ///< ContainerKind
+        std::uint64_t name;
+        std::uint64_t ref;
+        std::int64_t gref;
+        std::int64_t aref;
+        std::int64_t mid;
+        std::uint64_t firstVertex;      ///< ParamVertexRecord index
+        std::uint64_t numVertices;
+        std::int64_t pointsPerElement;  ///< 2 (Edge2), 3 (Tri3) or 4 (Quad4)
+        std::int64_t isReference;       ///< elements are refs, not indices
+        std::int64_t elementGref;
+        std::int64_t elementAref;
+        std::int64_t elementMid;
+        std::uint64_t firstElement;     ///< Integers or References index
+        std::uint64_t numElements;
+    };
+
+    struct ParamVertexRecord {
+        std::uint64_t vref;
+        std::int64_t gref;
+        std::int64_t mid;
+        double u;
+        double v;
+    };
+
+    struct TransformRecord {
+        std::int64_t xid;
+        std::int64_t aref;
+        std::uint64_t name;
+        std::uint64_t contents;
+    };
+
+    struct LinkageRecord {
+        std::uint64_t name;
+        std::uint64_t sourceEntityRef;
+        std::uint64_t targetEntityRef;
+        std::int64_t aref;
+        std::int64_t xref;
+    };
+
+    /// \brief Whether a document in memory is a binary container
+    static bool isBinary(const char *data, size_t length);
+
+    /// \brief Whether a file is a binary container
+    static bool isBinaryFile(const std::string &fname);
+};
+
+
+/****************************************************************************
+* MeshLinkMappedFile class
+***************************************************************************/
+/**
+* \class MeshLinkMappedFile
+*
+* \brief A file mapped read-only into memory for the life of the object
+*/
+class MeshLinkMappedFile {
+public:
+    MeshLinkMappedFile()
+    {
+    }
+    ~MeshLinkMappedFile()
+    {
+        unmap();
+    }
+
+    /// \brief Map a file, replacing any file already mapped
+    ///
+    /// \param sequential whether the file will be read front to back
+    /// \return false if the file could not be opened or mapped, or is empty
+    bool map(const std::string &fname, bool sequential);
+
+    /// \brief Unmap the file
+    void unmap();
+
+    /// The mapped file contents, or NULL if none
+    const char *data() const
+    {
+        return (const char *)addr_;
+    }
+
+    /// The length of the mapped file in bytes
+    size_t length() const
+    {
+        return length_;
+    }
+
+private:
+    MeshLinkMappedFile(const MeshLinkMappedFile &);
+    MeshLinkMappedFile &operator=(const MeshLinkMappedFile &);
+
+    void *addr_ { nullptr };
+    size_t length_ { 0 };
+};
+
+
+/****************************************************************************
+* MeshLinkBinaryWriter class
+***************************************************************************/
+/**
+* \class MeshLinkBinaryWriter
+*
+* \brief A MeshLink data writer emitting the binary container format
+*
+* Writes the data written by MeshLinkStreamWriter to a MeshLinkBinary
+* container. MeshLinkParserXerces::parseMeshLinkFile recognizes and
+* loads these files.
+*/
+class MeshLinkBinaryWriter : public MeshLinkWriter {
+public:
+    MeshLinkBinaryWriter()
+    {
+    }
+
+    MeshLinkBinaryWriter(const std::string &xmlns, const std::string &xmlns_xsi,
+        const std::string &schemaLocation):
+        xmlns_(xmlns),
+        xmlns_xsi_(xmlns_xsi),
+        schemaLocation_(schemaLocation)
+    {}
+    ~MeshLinkBinaryWriter()
+    {
+    }
+
+    /// \brief Write MeshAssociativity data to a MeshLink binary container
+    ///
+    /// Files whose names end in ".gz" are written gzip-compressed (see
+    /// MeshLinkFileOutput). The compress and terminatePlatform arguments
+    /// are accepted for interface compatibility.
+    bool writeMeshLinkFile(const std::string &fname,
+        MeshAssociativity *meshAssociativity, bool compress=true,
+        bool terminatePlatform=true) override;
+
+    /// \brief Write MeshAssociativity data to a MeshLink binary container
+    /// in memory
+    ///
+    /// The container may be loaded with
+    /// MeshLinkParserXerces::parseMeshLinkBuffer.
+    /// \param[out] buffer the container, replacing its contents
+    bool writeMeshLinkBuffer(MeshAssociativity *meshAssociativity,
+        std::vector<char> &buffer);
+
+    /// \brief Write MeshAssociativity data to an output sink
+    ///
+    /// The compress and terminatePlatform arguments are accepted for
+    /// interface compatibility.
+    bool writeMeshLinkSink(MeshAssociativity *meshAssociativity,
+        MeshLinkSinkFunc sink, void *userData, bool compress=true,
+        bool terminatePlatform=true) override;
+
+    // Stored in the container so that XML written after reading it
+    // validates
+    bool setMeshLinkAttributes(const std::string &xmlns,
+        const std::string &xmlns_xsi, const std::string &schemaLocation) override
+    {
+        xmlns_ = xmlns;
+        xmlns_xsi_ = xmlns_xsi;
+        schemaLocation_ = schemaLocation;
+        return true;
+    }
+
+private:
+    bool writeContainer(MeshAssociativity *meshAssociativity,
+        MeshLinkSinkFunc output, void *userData);
+
+    std::uint64_t addString(const std::string &str);
+    void addParamVertices(const MeshTopo *topo, std::uint64_t &first,
+        std::uint64_t &count);
+    bool addContainer(MeshTopo *container);
+
+    void addAttributes();
+    void addGeometryRefs();
+    bool addMeshFiles();
+    void addPeriodicInfo();
+
+    MeshAssociativity *meshAssoc_ { nullptr };
+
+    std::vector<char> strings_;
+    std::vector<MeshLinkBinary::AttributeRecord> attributes_;
+    std::vector<MeshLinkBinary::GeometryFileRecord> geometryFiles_;
+    std::vector<MeshLinkBinary::GeometryReferenceRecord> geometryRefs_;
+    std::vector<MeshLinkBinary::GeometryGroupRecord> geometryGroups_;
+    std::vector<MeshLinkBinary::MeshFileRecord> meshFiles_;
+    std::vector<MeshLinkBinary::ModelRecord> models_;
+    std::vector<MeshLinkBinary::ContainerRecord> containers_;
+    std::vector<MeshLinkBinary::ParamVertexRecord> vertices_;
+    std::vector<std::int64_t> integers_;
+    std::vector<std::uint64_t> references_;
+    std::vector<MeshLinkBinary::TransformRecord> transforms_;
+    std::vector<MeshLinkBinary::LinkageRecord> linkages_;
+
+    std::string xmlns_;
+    std::string xmlns_xsi_;
+    std::string schemaLocation_;
+};
+#endif // MESH_LINK_BINARY
+
+/****************************************************************************
+ *
+ * This file is licensed under the Cadence Public License Version 1.0 (the
+ * "License"), a copy of which is found in the included file named "LICENSE",
+ * and is distributed "AS IS." TO THE MAXIMUM EXTENT PERMITTED BY APPLICABLE
+ * LAW, CADENCE DISCLAIMS ALL WARRANTIES AND IN NO EVENT SHALL BE LIABLE TO
+ * ANY PARTY FOR ANY DAMAGES ARISING OUT OF OR RELATING TO USE OF THIS FILE.
+ * Please see the License for the full text of applicable terms.
+ *
+ ****************************************************************************/
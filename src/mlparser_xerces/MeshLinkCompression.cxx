@@ -0,0 +1,347 @@
+/****************************************************************************
+ *
+ * (C) 2021 Cadence Design Systems, Inc. All rights reserved worldwide.
+ *
+ * This sample source code is not supported by Cadence Design Systems, Inc.
+ * It is provided freely for demonstration purposes only.
+ * SEE THE WARRANTY DISCLAIMER AT THE BOTTOM OF THIS FILE.
+ *
+ ***************************************************************************/
+
+#include "Types.h"
+#include "MeshLinkCompression.h"
+#include "ThreadPool.h"
+
+#include "lzw.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+
+#ifdef HAVE_ZLIB
+#include <zlib.h>
+#endif
+
+// Chunk header: uncompressed bytes, compressed bits and shuffle size
+static const int CHUNK_HEADER_VALUES = 3;
+static const size_t CHUNK_HEADER_SIZE = CHUNK_HEADER_VALUES * sizeof(MLUINT32);
+
+// Largest chunk accepted, bounding the memory a corrupt header can claim
+static const size_t MAX_CHUNK_SIZE = 1 << 30;
+
+// Largest shuffle size accepted
+static const size_t MAX_SHUFFLE_SIZE = 64;
+
+
+// Group byte b of every value of the given size together, for each b in
+// turn. Trailing bytes not filling a value are copied as they are.
+static void
+shuffleBytes(const unsigned char *in, size_t size, size_t valueSize,
+    unsigned char *out)
+{
+    size_t count = size / valueSize;
+    for (size_t b = 0; b < valueSize; ++b) {
+        unsigned char *dest = out + b * count;
+        const unsigned char *src = in + b;
+        for (size_t i = 0; i < count; ++i, src += valueSize) {
+            dest[i] = *src;
+        }
+    }
+    size_t done = count * valueSize;
+    memcpy(out + done, in + done, size - done);
+}
+
+
+// Reverse shuffleBytes
+static void
+unshuffleBytes(const unsigned char *in, size_t size, size_t valueSize,
+    unsigned char *out)
+{
+    size_t count = size / valueSize;
+    for (size_t b = 0; b < valueSize; ++b) {
+        const unsigned char *src = in + b * count;
+        unsigned char *dest = out + b;
+        for (size_t i = 0; i < count; ++i, dest += valueSize) {
+            *dest = src[i];
+        }
+    }
+    size_t done = count * valueSize;
+    memcpy(out + done, in + done, size - done);
+}
+
+
+// Compress one chunk, returning its size in bits
+static bool
+compressChunk(MeshLinkCompression::Codec codec, const unsigned char *data,
+    size_t size, std::vector<unsigned char> &out, MLUINT32 &bits)
+{
+    switch (codec) {
+    case MeshLinkCompression::CodecLZW: {
+        std::uint8_t *compressed = nullptr;
+        int numBytes = 0;
+        int numBits = 0;
+        lzw::easyEncode(data, (int)size, &compressed, &numBytes, &numBits);
+        if (nullptr == compressed) {
+            return false;
+        }
+        out.assign(compressed, compressed + numBytes);
+        LZW_MFREE(compressed);
+        bits = (MLUINT32)numBits;
+        return true;
+    }
+#ifdef HAVE_ZLIB
+    case MeshLinkCompression::CodecDeflate: {
+        uLongf len = compressBound((uLong)size);
+        out.resize(len);
+        if (Z_OK != compress2(out.data(), &len, data, (uLong)size,
+                Z_DEFAULT_COMPRESSION)) {
+            return false;
+        }
+        out.resize(len);
+        bits = (MLUINT32)(len * 8);
+        return true;
+    }
+#endif
+    default:
+        return false;
+    }
+}
+
+
+// Decompress one chunk into exactly size bytes
+static bool
+decompressChunk(MeshLinkCompression::Codec codec, const unsigned char *data,
+    size_t numBytes, MLUINT32 bits, unsigned char *out, size_t size)
+{
+    switch (codec) {
+    case MeshLinkCompression::CodecLZW:
+        return (int)size == lzw::easyDecode(data, (int)numBytes, (int)bits,
+            out, (int)size);
+#ifdef HAVE_ZLIB
+    case MeshLinkCompression::CodecDeflate: {
+        uLongf len = (uLongf)size;
+        return Z_OK == uncompress(out, &len, data, (uLong)numBytes) &&
+            len == size;
+    }
+#endif
+    default:
+        return false;
+    }
+}
+
+
+bool
+MeshLinkCompression::isAvailable(Codec codec)
+{
+    switch (codec) {
+    case CodecNone:
+    case CodecLZW:
+        return true;
+    case CodecDeflate:
+#ifdef HAVE_ZLIB
+        return true;
+#else
+        return false;
+#endif
+    }
+    return false;
+}
+
+
+MeshLinkCompression::Codec
+MeshLinkCompression::getDefaultCodec()
+{
+    return isAvailable(CodecDeflate) ? CodecDeflate : CodecLZW;
+}
+
+
+const char *
+MeshLinkCompression::getName(Codec codec)
+{
+    switch (codec) {
+    case CodecLZW:
+        return "lzw";
+    case CodecDeflate:
+        return "deflate";
+    default:
+        return "none";
+    }
+}
+
+
+bool
+MeshLinkCompression::getCodec(const std::string &name, Codec &codec)
+{
+    if ("none" == name) {
+        codec = CodecNone;
+    }
+    else if ("lzw" == name) {
+        codec = CodecLZW;
+    }
+    else if ("deflate" == name) {
+        codec = CodecDeflate;
+    }
+    else {
+        return false;
+    }
+    return true;
+}
+
+
+bool
+MeshLinkCompression::compress(Codec codec, const unsigned char *data,
+    size_t size, size_t valueSize, std::vector<unsigned char> &payload,
+    size_t chunkSize, size_t numThreads)
+{
+    if (CodecNone == codec) {
+        payload.insert(payload.end(), data, data + size);
+        return true;
+    }
+    if (!isAvailable(codec)) {
+        std::cout << "Compression codec " << getName(codec) <<
+            " is not available in this build." << std::endl;
+        return false;
+    }
+    valueSize = std::max((size_t)1, std::min(valueSize, MAX_SHUFFLE_SIZE));
+    // Whole values per chunk
+    chunkSize = std::min(chunkSize, MAX_CHUNK_SIZE);
+    chunkSize = std::max(valueSize, chunkSize - chunkSize % valueSize);
+    size_t numChunks = (size + chunkSize - 1) / chunkSize;
+
+    std::vector<std::vector<unsigned char> > chunks(numChunks);
+    std::vector<MLUINT32> bits(numChunks, 0);
+    std::vector<char> compressed(numChunks, 0);
+    auto job = [&](size_t i) {
+        size_t offset = i * chunkSize;
+        size_t len = std::min(chunkSize, size - offset);
+        const unsigned char *chunk = data + offset;
+        std::vector<unsigned char> shuffled;
+        if (valueSize > 1) {
+            shuffled.resize(len);
+            shuffleBytes(chunk, len, valueSize, shuffled.data());
+            chunk = shuffled.data();
+        }
+        compressed[i] = compressChunk(codec, chunk, len, chunks[i], bits[i]);
+    };
+    ThreadPool::parallelFor(numChunks, job, numThreads);
+
+    // Append the chunks in order, each after its header
+    for (size_t i = 0; i < numChunks; ++i) {
+        if (!compressed[i]) {
+            std::cout << "Failed to compress chunk " << i << " with " <<
+                getName(codec) << "." << std::endl;
+            return false;
+        }
+        MLUINT32 header[CHUNK_HEADER_VALUES];
+        header[0] = (MLUINT32)std::min(chunkSize, size - i * chunkSize);
+        header[1] = bits[i];
+        header[2] = (MLUINT32)valueSize;
+        const unsigned char *first = (const unsigned char *)header;
+        payload.insert(payload.end(), first, first + CHUNK_HEADER_SIZE);
+        payload.insert(payload.end(), chunks[i].begin(), chunks[i].end());
+        std::vector<unsigned char>().swap(chunks[i]);
+    }
+    return true;
+}
+
+
+bool
+MeshLinkCompression::decompress(Codec codec, const unsigned char *data,
+    size_t size, bool swap, std::vector<unsigned char> &bytes,
+    size_t numThreads)
+{
+    if (CodecNone == codec) {
+        bytes.assign(data, data + size);
+        return true;
+    }
+    if (!isAvailable(codec)) {
+        std::cout << "Compression codec " << getName(codec) <<
+            " is not available in this build." << std::endl;
+        return false;
+    }
+
+    // Locate the chunks and their place in the output
+    struct Chunk {
+        size_t offset;      // compressed data offset in the payload
+        size_t numBytes;    // compressed data bytes
+        MLUINT32 bits;      // compressed data bits
+        size_t outOffset;   // uncompressed data offset in the output
+        size_t outSize;     // uncompressed data bytes
+        size_t valueSize;   // shuffle size
+    };
+    std::vector<Chunk> chunks;
+    size_t pos = 0;
+    size_t total = 0;
+    while (pos < size) {
+        if (size - pos < CHUNK_HEADER_SIZE) {
+            std::cout << "Compressed data: truncated chunk header." <<
+                std::endl;
+            return false;
+        }
+        MLUINT32 header[CHUNK_HEADER_VALUES];
+        memcpy(header, data + pos, CHUNK_HEADER_SIZE);
+        if (swap) {
+            for (int i = 0; i < CHUNK_HEADER_VALUES; ++i) {
+                unsigned char *b = (unsigned char *)&header[i];
+                std::reverse(b, b + sizeof(MLUINT32));
+            }
+        }
+        Chunk chunk;
+        chunk.offset = pos + CHUNK_HEADER_SIZE;
+        chunk.bits = header[1];
+        chunk.numBytes = ((size_t)header[1] + 7) / 8;
+        chunk.outOffset = total;
+        chunk.outSize = header[0];
+        chunk.valueSize = header[2];
+        if (0 == chunk.outSize || chunk.outSize > MAX_CHUNK_SIZE ||
+                0 == chunk.valueSize || chunk.valueSize > MAX_SHUFFLE_SIZE ||
+                0 == chunk.bits || size - chunk.offset < chunk.numBytes) {
+            std::cout << "Compressed data: invalid chunk header." << std::endl;
+            return false;
+        }
+        chunks.push_back(chunk);
+        total += chunk.outSize;
+        pos = chunk.offset + chunk.numBytes;
+    }
+
+    bytes.resize(total);
+    std::vector<char> decompressed(chunks.size(), 0);
+    auto job = [&](size_t i) {
+        const Chunk &chunk = chunks[i];
+        unsigned char *out = bytes.data() + chunk.outOffset;
+        if (1 == chunk.valueSize) {
+            decompressed[i] = decompressChunk(codec, data + chunk.offset,
+                chunk.numBytes, chunk.bits, out, chunk.outSize);
+            return;
+        }
+        std::vector<unsigned char> shuffled(chunk.outSize);
+        decompressed[i] = decompressChunk(codec, data + chunk.offset,
+            chunk.numBytes, chunk.bits, shuffled.data(), chunk.outSize);
+        if (decompressed[i]) {
+            unshuffleBytes(shuffled.data(), chunk.outSize, chunk.valueSize,
+                out);
+        }
+    };
+    ThreadPool::parallelFor(chunks.size(), job, numThreads);
+
+    for (size_t i = 0; i < chunks.size(); ++i) {
+        if (!decompressed[i]) {
+            std::cout << "Failed to decompress " << getName(codec) <<
+                " chunk " << i << "." << std::endl;
+            bytes.clear();
+            return false;
+        }
+    }
+    return true;
+}
+
+/****************************************************************************
+ *
+ * This file is licensed under the Cadence Public License Version 1.0 (the
+ * "License"), a copy of which is found in the included file named "LICENSE",
+ * and is distributed "AS IS." TO THE MAXIMUM EXTENT PERMITTED BY APPLICABLE
+ * LAW, CADENCE DISCLAIMS ALL WARRANTIES AND IN NO EVENT SHALL BE LIABLE TO
+ * ANY PARTY FOR ANY DAMAGES ARISING OUT OF OR RELATING TO USE OF THIS FILE.
+ * Please see the License for the full text of applicable terms.
+ *
+ ****************************************************************************/
@@ -0,0 +1,101 @@
+/****************************************************************************
+ *
+ * (C) 2021 Cadence Design Systems, Inc. All rights reserved worldwide.
+ *
+ * This sample source code is not supported by Cadence Design Systems, Inc.
+ * It is provided freely for demonstration purposes only.
+ * SEE THE WARRANTY DISCLAIMER AT THE BOTTOM OF THIS FILE.
+ *
+ ***************************************************************************/
+
+#ifndef MESH_LINK_COMPRESSION
+#define MESH_LINK_COMPRESSION
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+
+/****************************************************************************
+* MeshLinkCompression class
+***************************************************************************/
+/**
+* \class MeshLinkCompression
+*
+* \brief Block compression of packed binary array payloads
+*
+* A compressed payload is a sequence of independently compressed chunks.
+* Each chunk is preceded by three 32-bit unsigned integers in host byte
+* order: the uncompressed size in bytes, the compressed size in bits and
+* the shuffle size in bytes. Before compression the bytes of a chunk are
+* shuffled, grouping the first byte of every value, then the second, and
+* so on for values of the shuffle size; this makes the slowly varying
+* high bytes of mesh indices and coordinates compress far better.
+* Chunks are compressed and decompressed on multiple threads, and
+* payloads compressed separately may be concatenated.
+*/
+class MeshLinkCompression {
+public:
+    /// Block compression codecs
+    enum Codec {
+        CodecNone,      ///< packed bytes are stored as they are
+        CodecLZW,       ///< LZW with 12-bit codes (lzw.hpp)
+        CodecDeflate    ///< zlib deflate (requires HAVE_ZLIB)
+    };
+
+    /// Default uncompressed chunk size in bytes
+    static const size_t DefaultChunkSize = 1 << 20;
+
+    /// \brief Whether the codec is available in this build
+    static bool isAvailable(Codec codec);
+
+    /// \brief The best available codec, deflate if built with zlib and
+    /// otherwise LZW
+    static Codec getDefaultCodec();
+
+    /// \brief The codec's name as used in the 'compression' attribute
+    static const char *getName(Codec codec);
+
+    /// \brief Look up a codec by its 'compression' attribute name
+    ///
+    /// \param name the codec name
+    /// \param[out] codec the codec
+    /// \return false if the name is not a known codec
+    static bool getCodec(const std::string &name, Codec &codec);
+
+    /// \brief Compress bytes, appending chunks to a payload
+    ///
+    /// \param codec the compression codec
+    /// \param data,size the bytes to compress
+    /// \param valueSize the size in bytes of the packed values, used
+    ///                  as the shuffle size
+    /// \param[in,out] payload the compressed chunks are appended
+    /// \param chunkSize uncompressed bytes per chunk
+    /// \param numThreads threads to use, or 0 for ThreadPool::getConcurrency()
+    static bool compress(Codec codec, const unsigned char *data, size_t size,
+        size_t valueSize, std::vector<unsigned char> &payload,
+        size_t chunkSize = DefaultChunkSize, size_t numThreads = 0);
+
+    /// \brief Decompress a payload of compressed chunks
+    ///
+    /// \param codec the compression codec
+    /// \param data,size the compressed payload
+    /// \param swap whether the chunk headers must be byte-swapped
+    /// \param[out] bytes the uncompressed bytes
+    /// \param numThreads threads to use, or 0 for ThreadPool::getConcurrency()
+    static bool decompress(Codec codec, const unsigned char *data, size_t size,
+        bool swap, std::vector<unsigned char> &bytes, size_t numThreads = 0);
+};
+
+#endif // MESH_LINK_COMPRESSION
+
+/****************************************************************************
+ *
+ * This file is licensed under the Cadence Public License Version 1.0 (the
+ * "License"), a copy of which is found in the included file named "LICENSE",
+ * and is distributed "AS IS." TO THE MAXIMUM EXTENT PERMITTED BY APPLICABLE
+ * LAW, CADENCE DISCLAIMS ALL WARRANTIES AND IN NO EVENT SHALL BE LIABLE TO
+ * ANY PARTY FOR ANY DAMAGES ARISING OUT OF OR RELATING TO USE OF THIS FILE.
+ * Please see the License for the full text of applicable terms.
+ *
+ ****************************************************************************/
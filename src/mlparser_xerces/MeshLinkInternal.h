@@ -0,0 +1,83 @@
+/****************************************************************************
+ *
+ * (C) 2021 Cadence Design Systems, Inc. All rights reserved worldwide.
+ *
+ * This sample source code is not supported by Cadence Design Systems, Inc.
+ * It is provided freely for demonstration purposes only.
+ * SEE THE WARRANTY DISCLAIMER AT THE BOTTOM OF THIS FILE.
+ *
+ ***************************************************************************/
+
+#ifndef MESH_LINK_INTERNAL
+#define MESH_LINK_INTERNAL
+
+// Constants and helpers shared by the MeshLink XML parser and writers.
+// Internal to mlparser_xerces; not installed with the public headers.
+
+#include "Types.h"
+
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+static const int MAX_ID = 1024;
+
+// ParamVertex elements whose UV text is formatted together
+static const size_t ParamVertexBatch = 1 << 20;
+
+// Mesh containers whose content is prepared together, per thread
+static const size_t ContainersPerThread = 4;
+
+// The MeshLink schema namespace
+static const char *const NSStr = "https://pointwise.com";
+
+
+// Whether the host stores multi-byte values most significant byte first
+inline bool
+hostIsBigEndian()
+{
+    const MLINT32 one = 1;
+    return 0 == *(const unsigned char *)&one;
+}
+
+
+inline std::string
+intString(MLINT value)
+{
+    char buf[MAX_ID];
+    sprintf(buf, "%ld", (long)value);
+    return std::string(buf);
+}
+
+
+// Convert a string to a 64-bit int, failing if it is not entirely
+// an integer in range
+inline bool
+toInt64(const std::string &str, MLINT64 &value)
+{
+    if (str.empty()) {
+        return false;
+    }
+    char *end = NULL;
+    errno = 0;
+    long long val = strtoll(str.c_str(), &end, 10);
+    if ('\0' != *end || ERANGE == errno) {
+        return false;
+    }
+    value = (MLINT64)val;
+    return true;
+}
+
+#endif
+
+/****************************************************************************
+ *
+ * This file is licensed under the Cadence Public License Version 1.0 (the
+ * "License"), a copy of which is found in the included file named "LICENSE",
+ * and is distributed "AS IS." TO THE MAXIMUM EXTENT PERMITTED BY APPLICABLE
+ * LAW, CADENCE DISCLAIMS ALL WARRANTIES AND IN NO EVENT SHALL BE LIABLE TO
+ * ANY PARTY FOR ANY DAMAGES ARISING OUT OF OR RELATING TO USE OF THIS FILE.
+ * Please see the License for the full text of applicable terms.
+ *
+ ****************************************************************************/
@@ -0,0 +1,304 @@
+/****************************************************************************
+ *
+ * (C) 2021 Cadence Design Systems, Inc. All rights reserved worldwide.
+ *
+ * This sample source code is not supported by Cadence Design Systems, Inc.
+ * It is provided freely for demonstration purposes only.
+ * SEE THE WARRANTY DISCLAIMER AT THE BOTTOM OF THIS FILE.
+ *
+ ***************************************************************************/
+
+#include "MeshLinkOutput.h"
+
+#include <cstring>
+#include <iostream>
+
+#ifdef HAVE_ZLIB
+#include <zlib.h>
+#endif
+
+// Uncompressed bytes deflated at a time by the helper thread
+static const size_t GzipBlockSize = 1 << 20;
+
+// Blocks waiting for the helper thread before the writer waits
+static const size_t GzipMaxQueued = 4;
+
+
+/****************************************************************************
+* MeshLinkGzipSink
+***************************************************************************/
+
+// zlib stream state, kept out of the header
+struct MeshLinkGzipSink::Deflater {
+#ifdef HAVE_ZLIB
+    z_stream strm;
+#endif
+    std::vector<unsigned char> out;
+};
+
+
+MeshLinkGzipSink::MeshLinkGzipSink(MeshLinkSinkFunc sink, void *userData,
+        int level) :
+    sink_(sink),
+    userData_(userData),
+    level_(level)
+{
+}
+
+
+MeshLinkGzipSink::~MeshLinkGzipSink()
+{
+    finish();
+}
+
+
+bool
+MeshLinkGzipSink::isAvailable()
+{
+#ifdef HAVE_ZLIB
+    return true;
+#else
+    return false;
+#endif
+}
+
+
+bool
+MeshLinkGzipSink::start()
+{
+#ifdef HAVE_ZLIB
+    if (nullptr != deflater_ || nullptr == sink_) {
+        return false;
+    }
+    deflater_.reset(new Deflater);
+    z_stream &strm = deflater_->strm;
+    memset(&strm, 0, sizeof(strm));
+    // Window bits plus 16 writes a gzip header and trailer
+    if (Z_OK != deflateInit2(&strm, level_, Z_DEFLATED, 15 + 16, 8,
+            Z_DEFAULT_STRATEGY)) {
+        std::cout << "Failed to initialize gzip compression." << std::endl;
+        deflater_.reset();
+        return false;
+    }
+    deflater_->out.resize(GzipBlockSize / 4);
+    block_.reserve(GzipBlockSize);
+    finishing_ = false;
+    failed_ = false;
+    thread_ = std::thread(&MeshLinkGzipSink::run, this);
+    return true;
+#else
+    std::cout << "Writing gzip-compressed MeshLink files requires "
+        "a writer built with zlib (HAVE_ZLIB)." << std::endl;
+    return false;
+#endif
+}
+
+
+bool
+MeshLinkGzipSink::write(const void *data, size_t len, void *userData)
+{
+    return ((MeshLinkGzipSink *)userData)->put((const char *)data, len);
+}
+
+
+bool
+MeshLinkGzipSink::put(const char *data, size_t len)
+{
+    while (len > 0) {
+        size_t room = GzipBlockSize - block_.size();
+        size_t n = (len < room ? len : room);
+        block_.insert(block_.end(), data, data + n);
+        data += n;
+        len -= n;
+        if (block_.size() >= GzipBlockSize) {
+            queueBlock();
+        }
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    return !failed_;
+}
+
+
+// Pass the filled block to the helper thread, waiting while it is behind
+void
+MeshLinkGzipSink::queueBlock()
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    notFull_.wait(lock, [this]() { return queue_.size() < GzipMaxQueued; });
+    queue_.push_back(std::vector<char>());
+    queue_.back().swap(block_);
+    lock.unlock();
+    notEmpty_.notify_one();
+    block_.reserve(GzipBlockSize);
+}
+
+
+// Helper thread deflating queued blocks, ending the stream once the
+// writer finishes and the queue is empty
+void
+MeshLinkGzipSink::run()
+{
+#ifdef HAVE_ZLIB
+    z_stream &strm = deflater_->strm;
+    std::vector<unsigned char> &out = deflater_->out;
+    bool ok = true;
+    for (;;) {
+        std::vector<char> in;
+        bool last = false;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            notEmpty_.wait(lock,
+                [this]() { return !queue_.empty() || finishing_; });
+            if (queue_.empty()) {
+                last = true;
+            }
+            else {
+                in.swap(queue_.front());
+                queue_.pop_front();
+            }
+        }
+        notFull_.notify_one();
+
+        // After a failure blocks are discarded so the writer never waits
+        if (ok) {
+            strm.next_in = (Bytef *)in.data();
+            strm.avail_in = (uInt)in.size();
+            int flush = last ? Z_FINISH : Z_NO_FLUSH;
+            do {
+                strm.next_out = out.data();
+                strm.avail_out = (uInt)out.size();
+                if (Z_STREAM_ERROR == deflate(&strm, flush)) {
+                    ok = false;
+                    break;
+                }
+                size_t have = out.size() - strm.avail_out;
+                if (have > 0 && !sink_(out.data(), have, userData_)) {
+                    std::cout << "Failed writing gzip output." << std::endl;
+                    ok = false;
+                    break;
+                }
+            } while (0 == strm.avail_out);
+            if (!ok) {
+                std::lock_guard<std::mutex> lock(mutex_);
+                failed_ = true;
+            }
+        }
+        if (last) {
+            break;
+        }
+    }
+    deflateEnd(&strm);
+#endif
+}
+
+
+bool
+MeshLinkGzipSink::finish()
+{
+    if (!thread_.joinable()) {
+        return false;
+    }
+    if (!block_.empty()) {
+        queueBlock();
+    }
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        finishing_ = true;
+    }
+    notEmpty_.notify_one();
+    thread_.join();
+    deflater_.reset();
+    std::vector<char>().swap(block_);
+    return !failed_;
+}
+
+
+/****************************************************************************
+* MeshLinkFileOutput
+***************************************************************************/
+
+// Sink writing to a FILE
+static bool
+fileSink(const void *data, size_t len, void *userData)
+{
+    return 1 == fwrite(data, len, 1, (FILE *)userData);
+}
+
+
+bool
+MeshLinkFileOutput::isGzipName(const std::string &fname)
+{
+    const std::string ext(".gz");
+    return fname.size() > ext.size() &&
+        0 == fname.compare(fname.size() - ext.size(), ext.size(), ext);
+}
+
+
+bool
+MeshLinkFileOutput::open(const std::string &fname)
+{
+    close(true);
+    file_ = fopen(fname.c_str(), "wb");
+    if (nullptr == file_) {
+        std::cout << "Failed to open " << fname << " for writing." << std::endl;
+        return false;
+    }
+    fname_ = fname;
+    if (isGzipName(fname)) {
+        gzip_.reset(new MeshLinkGzipSink(fileSink, file_));
+        if (!gzip_->start()) {
+            close(false);
+            return false;
+        }
+    }
+    return true;
+}
+
+
+bool
+MeshLinkFileOutput::write(const void *data, size_t len, void *userData)
+{
+    MeshLinkFileOutput *output = (MeshLinkFileOutput *)userData;
+    if (nullptr == output->file_) {
+        return false;
+    }
+    if (nullptr != output->gzip_) {
+        return MeshLinkGzipSink::write(data, len, output->gzip_.get());
+    }
+    return fileSink(data, len, output->file_);
+}
+
+
+bool
+MeshLinkFileOutput::close(bool keep)
+{
+    if (nullptr == file_) {
+        return false;
+    }
+    if (nullptr != gzip_) {
+        if (!gzip_->finish()) {
+            keep = false;
+        }
+        gzip_.reset();
+    }
+    if (0 != fclose(file_)) {
+        keep = false;
+    }
+    file_ = nullptr;
+    if (!keep) {
+        // Don't leave a partial file behind
+        remove(fname_.c_str());
+    }
+    return keep;
+}
+
+/****************************************************************************
+ *
+ * This file is licensed under the Cadence Public License Version 1.0 (the
+ * "License"), a copy of which is found in the included file named "LICENSE",
+ * and is distributed "AS IS." TO THE MAXIMUM EXTENT PERMITTED BY APPLICABLE
+ * LAW, CADENCE DISCLAIMS ALL WARRANTIES AND IN NO EVENT SHALL BE LIABLE TO
+ * ANY PARTY FOR ANY DAMAGES ARISING OUT OF OR RELATING TO USE OF THIS FILE.
+ * Please see the License for the full text of applicable terms.
+ *
+ ****************************************************************************/
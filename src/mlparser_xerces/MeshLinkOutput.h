@@ -0,0 +1,150 @@
+/****************************************************************************
+ *
+ * (C) 2021 Cadence Design Systems, Inc. All rights reserved worldwide.
+ *
+ * This sample source code is not supported by Cadence Design Systems, Inc.
+ * It is provided freely for demonstration purposes only.
+ * SEE THE WARRANTY DISCLAIMER AT THE BOTTOM OF THIS FILE.
+ *
+ ***************************************************************************/
+
+#ifndef MESH_LINK_OUTPUT
+#define MESH_LINK_OUTPUT
+
+#include "Types.h"
+#include "MeshLinkWriter.h"
+
+#include <condition_variable>
+#include <cstdio>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+
+/****************************************************************************
+* MeshLinkGzipSink class
+***************************************************************************/
+/**
+* \class MeshLinkGzipSink
+*
+* \brief Output sink gzip-compressing a document for another sink
+*
+* Input is collected into blocks that a helper thread deflates and
+* passes to the downstream sink, so compression overlaps serialization.
+* A bounded number of blocks wait for the helper thread, bounding the
+* memory used. Requires zlib (HAVE_ZLIB).
+*/
+class MeshLinkGzipSink {
+public:
+    /// \brief Constructor
+    ///
+    /// \param sink,userData the sink receiving the gzip stream
+    /// \param level the zlib compression level, -1 for the default
+    MeshLinkGzipSink(MeshLinkSinkFunc sink, void *userData, int level = -1);
+    ~MeshLinkGzipSink();
+
+    /// \brief Whether gzip output is available in this build
+    static bool isAvailable();
+
+    /// \brief Start the helper thread
+    ///
+    /// \return false if gzip output is not available
+    bool start();
+
+    /// \brief MeshLinkSinkFunc compressing data; userData is the
+    /// MeshLinkGzipSink
+    static bool write(const void *data, size_t len, void *userData);
+
+    /// \brief Compress the remaining input, end the gzip stream and stop
+    /// the helper thread
+    ///
+    /// \return false if compressing or writing failed
+    bool finish();
+
+private:
+    struct Deflater;
+
+    MeshLinkGzipSink(const MeshLinkGzipSink &);
+    MeshLinkGzipSink &operator=(const MeshLinkGzipSink &);
+
+    bool put(const char *data, size_t len);
+    void queueBlock();
+    void run();
+
+    MeshLinkSinkFunc sink_;
+    void *userData_;
+    int level_;
+    std::unique_ptr<Deflater> deflater_;
+    std::thread thread_;
+
+    // Blocks waiting for the helper thread, and the block being filled
+    std::mutex mutex_;
+    std::condition_variable notEmpty_;
+    std::condition_variable notFull_;
+    std::deque<std::vector<char> > queue_;
+    std::vector<char> block_;
+    bool finishing_ { false };
+    bool failed_ { false };
+};
+
+
+/****************************************************************************
+* MeshLinkFileOutput class
+***************************************************************************/
+/**
+* \class MeshLinkFileOutput
+*
+* \brief A file written by the MeshLink writers through a MeshLinkSinkFunc
+*
+* Files whose names end in ".gz" are written gzip-compressed with a
+* MeshLinkGzipSink. MeshLinkParserXerces reads them back directly.
+*/
+class MeshLinkFileOutput {
+public:
+    MeshLinkFileOutput()
+    {
+    }
+    ~MeshLinkFileOutput()
+    {
+        close(false);
+    }
+
+    /// \brief Whether a file of this name is written gzip-compressed
+    static bool isGzipName(const std::string &fname);
+
+    /// \brief Open the file for writing
+    bool open(const std::string &fname);
+
+    /// \brief MeshLinkSinkFunc writing to the file; userData is the
+    /// MeshLinkFileOutput
+    static bool write(const void *data, size_t len, void *userData);
+
+    /// \brief Finish writing and close the file
+    ///
+    /// \param keep false to remove the file, as after a failed write
+    /// \return false if the file is removed or could not be completed
+    bool close(bool keep);
+
+private:
+    MeshLinkFileOutput(const MeshLinkFileOutput &);
+    MeshLinkFileOutput &operator=(const MeshLinkFileOutput &);
+
+    std::string fname_;
+    FILE *file_ { nullptr };
+    std::unique_ptr<MeshLinkGzipSink> gzip_;
+};
+#endif // MESH_LINK_OUTPUT
+
+/****************************************************************************
+ *
+ * This file is licensed under the Cadence Public License Version 1.0 (the
+ * "License"), a copy of which is found in the included file named "LICENSE",
+ * and is distributed "AS IS." TO THE MAXIMUM EXTENT PERMITTED BY APPLICABLE
+ * LAW, CADENCE DISCLAIMS ALL WARRANTIES AND IN NO EVENT SHALL BE LIABLE TO
+ * ANY PARTY FOR ANY DAMAGES ARISING OUT OF OR RELATING TO USE OF THIS FILE.
+ * Please see the License for the full text of applicable terms.
+ *
+ ****************************************************************************/
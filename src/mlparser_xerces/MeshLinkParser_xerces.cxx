@@ -10,25 +10,52 @@
 
 #include "MeshAssociativity.h"
 
+#include "MeshLinkBinary.h"
+#include "MeshLinkCompression.h"
+#include "MeshLinkInternal.h"
 #include "MeshLinkParser_xerces.h"
 #include "MeshLinkWriter_xerces.h"
+#include "TextScanner.h"
+#include "ThreadPool.h"
+#include "XercesPlatformSession.h"
 
 #include <iostream>
 #include <istream>
 #include <iterator>
 #include <sstream>
+#include <algorithm>
+#include <cerrno>
+#include <cstdlib>
+#include <limits>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+
+#ifdef HAVE_ZLIB
+#include <zlib.h>
+#endif
 
 // DOM Parser
 #include <xercesc/dom/DOM.hpp>
 #include <xercesc/framework/LocalFileInputSource.hpp>
+#include <xercesc/framework/XMLGrammarPoolImpl.hpp>
 #include <xercesc/parsers/XercesDOMParser.hpp>
 #include <xercesc/sax/HandlerBase.hpp>
+#include <xercesc/sax/InputSource.hpp>
 #include <xercesc/util/Base64.hpp>
+#include <xercesc/util/BinInputStream.hpp>
+#include <xercesc/util/BinMemInputStream.hpp>
 #include <xercesc/util/PlatformUtils.hpp>
 #include <xercesc/util/XercesDefs.hpp>
 #include <xercesc/util/XMLString.hpp>
 #include <xercesc/util/XMLUni.hpp>
 
+// SAX2 Parser
+#include <xercesc/sax2/Attributes.hpp>
+#include <xercesc/sax2/DefaultHandler.hpp>
+#include <xercesc/sax2/SAX2XMLReader.hpp>
+#include <xercesc/sax2/XMLReaderFactory.hpp>
+
 using namespace xercesc;
 
 class DOMNodeTagNameFilter: public DOMNodeFilter {
@@ -103,21 +130,280 @@ private:
 #define X(str) (XMLCopier<char, XMLCh>(str)).convert()
 #define Char(str) XMLCopier<XMLCh, char>(str).convert()
 
+// Decode base64 text into bytes, decompressing them if compressed
+static bool
+decodeBase64(const XMLCh *text, MeshLinkCompression::Codec codec, bool swap,
+    std::vector<XMLByte> &bytes)
+{
+    MemoryManager *memMgr = XMLPlatformUtils::fgMemoryManager;
+    XMLSize_t length = 0;
+    XMLByte *data = Base64::decodeToXMLByte(text, &length, memMgr);
+    if (nullptr == data) {
+        return false;
+    }
+    bool result = MeshLinkCompression::decompress(codec, data, length, swap,
+        bytes);
+    memMgr->deallocate(data);
+    return result;
+}
+
+
+// ParamVertex objects keyed by the point index their vref names
+typedef std::unordered_map<MLINT, ParamVertex *> ParamVertIndexMap;
+
+// Map the ParamVertex objects of topo whose vref is a point index, written
+// the way std::to_string writes it, so that MeshFace and MeshEdge indices
+// resolve without formatting each index as a vref string
+static void
+mapParamVertsByIndex(const MeshTopo *topo, ParamVertIndexMap &pvMap)
+{
+    const ParamVertVrefMap &vrefMap = topo->getParamVertVrefMap();
+    pvMap.clear();
+    pvMap.reserve(vrefMap.size());
+    ParamVertVrefMap::const_iterator iter;
+    for (iter = vrefMap.begin(); iter != vrefMap.end(); ++iter) {
+        const std::string &vref = iter->first;
+        size_t first = ('-' == vref[0]) ? 1 : 0;
+        if (first == vref.size() ||
+                ('0' == vref[first] && vref.size() > 1) ||
+                std::string::npos !=
+                    vref.find_first_not_of("0123456789", first)) {
+            continue;
+        }
+        errno = 0;
+        long long index = std::strtoll(vref.c_str(), nullptr, 10);
+        if (ERANGE == errno || (long long)(MLINT)index != index) {
+            continue;
+        }
+        pvMap[(MLINT)index] = iter->second;
+    }
+}
+
+
+// Look up the ParamVertex of topo for each of numInds point indices, NULL
+// where there is none; paramVerts is left empty when topo has none at all
+static void
+getParamVertsByIndex(const MeshTopo *topo, const MLINT *indices,
+    size_t numInds, std::vector<ParamVertex *> &paramVerts)
+{
+    paramVerts.clear();
+    if (topo->getParamVertVrefMap().empty()) {
+        return;
+    }
+    ParamVertIndexMap pvMap;
+    mapParamVertsByIndex(topo, pvMap);
+    paramVerts.resize(numInds);
+    size_t i;
+    for (i = 0; i < numInds; ++i) {
+        ParamVertIndexMap::const_iterator iter = pvMap.find(indices[i]);
+        paramVerts[i] = (iter != pvMap.end()) ? iter->second : NULL;
+    }
+}
+
+
+// Reverse the bytes of each of count packed values of the given size
+static void
+swapBytes(XMLByte *data, size_t size, size_t count)
+{
+    for (size_t i = 0; i < count; ++i, data += size) {
+        std::reverse(data, data + size);
+    }
+}
+
+
+// Read the width, byteOrder and compression attributes of a packed
+// binary array, returning false (and reporting it, if report) if any is
+// illegal
+static bool
+parseBinaryLayout(DOMElement *node, const char *elemName, int &width,
+    bool &swap, MeshLinkCompression::Codec &codec, bool report = true)
+{
+    width = 32;
+    swap = false;
+    codec = MeshLinkCompression::CodecNone;
+    if (node->hasAttribute(X("compression"))) {
+        XMLCopier<XMLCh, char> value(node->getAttribute(X("compression")));
+        std::string str((char *)value);
+        if (!MeshLinkCompression::getCodec(str, codec)) {
+            if (report) {
+                std::cout << elemName << ": illegal compression value: " <<
+                    str << std::endl;
+            }
+            return false;
+        }
+        if (!MeshLinkCompression::isAvailable(codec)) {
+            if (report) {
+                std::cout << elemName << ": " << str << " compressed data "
+                    "requires a parser built with zlib (HAVE_ZLIB)." <<
+                    std::endl;
+            }
+            return false;
+        }
+    }
+    if (node->hasAttribute(X("width"))) {
+        XMLCopier<XMLCh, char> value(node->getAttribute(X("width")));
+        std::string str((char *)value);
+        if ("32" != str && "64" != str) {
+            if (report) {
+                std::cout << elemName << ": illegal width value: " << str <<
+                    std::endl;
+            }
+            return false;
+        }
+        width = ("64" == str) ? 64 : 32;
+    }
+    if (node->hasAttribute(X("byteOrder"))) {
+        XMLCopier<XMLCh, char> value(node->getAttribute(X("byteOrder")));
+        std::string str((char *)value);
+        if ("little" != str && "big" != str) {
+            if (report) {
+                std::cout << elemName << ": illegal byteOrder value: " <<
+                    str << std::endl;
+            }
+            return false;
+        }
+        swap = (("big" == str) != hostIsBigEndian());
+    }
+    else {
+        swap = hostIsBigEndian();
+    }
+    return true;
+}
+
+
+// Largest count attribute accepted for an array of faces, edges or points
+static const unsigned long long MaxArrayCount = 1000000000000ULL;
+
+// Read a count attribute, returning false unless it is a decimal number
+// from 1 to MaxArrayCount. The limit keeps count times the values per
+// item and bytes per value (at most 4 and 8) within size_t.
+static bool
+parseCount(const std::string &str, size_t &count)
+{
+    size_t first = str.find_first_not_of(" \t\r\n");
+    size_t last = str.find_last_not_of(" \t\r\n");
+    if (std::string::npos == first) {
+        return false;
+    }
+    std::string digits = str.substr(first, last - first + 1);
+    if (std::string::npos != digits.find_first_not_of("0123456789")) {
+        return false;
+    }
+    errno = 0;
+    unsigned long long value = std::strtoull(digits.c_str(), nullptr, 10);
+    if (ERANGE == errno || 0 == value || MaxArrayCount < value ||
+            std::numeric_limits<size_t>::max() / 32 < value) {
+        return false;
+    }
+    count = (size_t)value;
+    return true;
+}
+
+
+// Read count packed integers of the given width (32 or 64 bits)
+static void
+unpackInts(const XMLByte *data, size_t count, int width, bool swap,
+    MLINT *values)
+{
+    if (64 == width) {
+        MLINT64 val;
+        for (size_t i = 0; i < count; ++i) {
+            memcpy(&val, data + i * sizeof(val), sizeof(val));
+            if (swap) { swapBytes((XMLByte *)&val, sizeof(val), 1); }
+            values[i] = (MLINT)val;
+        }
+    }
+    else {
+        MLINT32 val;
+        for (size_t i = 0; i < count; ++i) {
+            memcpy(&val, data + i * sizeof(val), sizeof(val));
+            if (swap) { swapBytes((XMLByte *)&val, sizeof(val), 1); }
+            values[i] = val;
+        }
+    }
+}
+
+
+// Decode base64 text holding packed integers of the given width
+static bool
+decodeBase64Ints(const XMLCh *text, XMLSize_t numValues, int width,
+    bool swap, MeshLinkCompression::Codec codec, std::vector<MLINT> &values)
+{
+    if (MeshLinkCompression::CodecNone != codec) {
+        std::vector<XMLByte> bytes;
+        if (!decodeBase64(text, codec, swap, bytes) ||
+                bytes.size() < numValues * (width / 8)) {
+            return false;
+        }
+        values.resize(numValues);
+        unpackInts(bytes.data(), numValues, width, swap, values.data());
+        return true;
+    }
+    MemoryManager *memMgr = XMLPlatformUtils::fgMemoryManager;
+    XMLSize_t length = 0;
+    XMLByte *data = Base64::decodeToXMLByte(text, &length, memMgr);
+    if (nullptr == data) {
+        return false;
+    }
+    bool result = (length >= numValues * (width / 8));
+    if (result) {
+        values.resize(numValues);
+        unpackInts(data, numValues, width, swap, values.data());
+    }
+    memMgr->deallocate(data);
+    return result;
+}
+
+
+// Collect the descendant elements of root with the given tag name in
+// document order, as a DOMNodeIterator would. An iterator is allocated
+// from and registered with the owner document, whereas this only reads
+// the DOM, so several threads may use it on the same document.
+static void
+getElementsByTag(DOMElement *root, const char *tagName,
+    std::vector<DOMElement *> &elems)
+{
+    XMLCopier<char, XMLCh> tag(tagName);
+    DOMNode *node = root->getFirstChild();
+    while (nullptr != node) {
+        if (DOMNode::ELEMENT_NODE == node->getNodeType()) {
+            DOMElement *elem = dynamic_cast<DOMElement*>(node);
+            if (nullptr != elem && XMLString::equals(tag, elem->getTagName())) {
+                elems.push_back(elem);
+            }
+        }
+        // Next node in document order within root
+        if (nullptr != node->getFirstChild()) {
+            node = node->getFirstChild();
+            continue;
+        }
+        while (node != root && nullptr == node->getNextSibling()) {
+            node = node->getParentNode();
+        }
+        node = (node == root) ? nullptr : node->getNextSibling();
+    }
+}
+
+
 // Returns true if Element node is a Text Node or CDATASection Node
+//
+// If the element has format="base64" and indices is given, the element
+// content is decoded directly into indices and value is left empty.
 static bool
-parseNode(DOMElement *node, std::vector<std::string> &atts, std::string &value)
+parseNode(DOMElement *node, std::vector<std::string> &atts, std::string &value,
+    std::vector<MLINT> *indices = NULL)
 {
     bool result = false;
     // Attributes vector contains names, to be replaced with parsed values
-    int count; // used if data is base64
+    std::string countStr; // used if data is base64
     bool base64 = false;
-    bool quads = false;
+    int valuesPerItem = 1; // indices per face or edge, from etype
     for (size_t i = 0; i < atts.size(); ++i) {
         XMLCopier<char, XMLCh> name(atts.at(i).c_str());
         XMLCopier<XMLCh, char> attr(node->getAttribute(name));
         if (!attr.empty()) {
             if (std::string("count") == atts.at(i)) {
-                count = std::stoul((char*)attr);
+                countStr = (char*)attr;
             }
             if (std::string("format") == atts.at(i)) {
                 if (std::string("base64") == std::string((char*)attr)) {
@@ -125,8 +411,15 @@ parseNode(DOMElement *node, std::vector<std::string> &atts, std::string &value)
                 }
             }
             if (std::string("etype") == atts.at(i)) {
-                if (std::string("Quad4") == std::string((char*)attr)) {
-                    quads = true;
+                std::string etype((char*)attr);
+                if ("Quad4" == etype) {
+                    valuesPerItem = 4;
+                }
+                else if ("Tri3" == etype) {
+                    valuesPerItem = 3;
+                }
+                else if ("Edge2" == etype) {
+                    valuesPerItem = 2;
                 }
             }
             atts[i] = attr;
@@ -140,22 +433,40 @@ parseNode(DOMElement *node, std::vector<std::string> &atts, std::string &value)
     DOMNode *child = node->getFirstChild();
     while (nullptr != child) {
         if (DOMNode::TEXT_NODE == child->getNodeType()) {
-            XMLCopier<XMLCh, char> contents(child->getNodeValue());
             if (base64) {
-                XMLSize_t length;
-                XMLByte *data = Base64::decode((const XMLByte*)((char*)contents),
-                    &length);
-                int faceIndxSize = count * (quads ? 4 : 3);
-                int *faceIndices = new int[faceIndxSize];
-                memcpy(faceIndices, data, faceIndxSize * sizeof(int));
-                for (int i = 0; i < faceIndxSize; ++i) {
-                    if (0 < i) {
-                        value += " ";
+                XMLCopier<XMLCh, char> tagName(node->getTagName());
+                size_t count = 1;
+                if (!countStr.empty() && !parseCount(countStr, count)) {
+                    std::cout << (char *)tagName << ": illegal count value: " <<
+                        countStr << std::endl;
+                    break;
+                }
+                size_t indxSize = count * valuesPerItem;
+                std::vector<MLINT> decoded;
+                std::vector<MLINT> &decodedIndices = indices ? *indices : decoded;
+                int width;
+                bool swap;
+                MeshLinkCompression::Codec codec;
+                if (!parseBinaryLayout(node, tagName, width, swap, codec)) {
+                    break;
+                }
+                if (!decodeBase64Ints(child->getNodeValue(), indxSize, width,
+                        swap, codec, decodedIndices)) {
+                    std::cout << "Base64 data: decoding failed or too few "
+                        "values." << std::endl;
+                    break;
+                }
+                if (NULL == indices) {
+                    for (size_t i = 0; i < indxSize; ++i) {
+                        if (0 < i) {
+                            value += " ";
+                        }
+                        value += std::to_string(decodedIndices[i]);
                     }
-                    value += std::to_string(faceIndices[i]);
                 }
             }
             else {
+                XMLCopier<XMLCh, char> contents(child->getNodeValue());
                 value = contents;
             }
             result = true;
@@ -166,9 +477,14 @@ parseNode(DOMElement *node, std::vector<std::string> &atts, std::string &value)
             DOMCDATASection *cdata = dynamic_cast<DOMCDATASection*>(child);
 
             // Base64 decode
+            MemoryManager *memMgr = XMLPlatformUtils::fgMemoryManager;
             XMLSize_t length;
-            XMLByte *data = Base64::decodeToXMLByte(cdata->getData(), &length);
-            value.assign((char*)data, length);
+            XMLByte *data = Base64::decodeToXMLByte(cdata->getData(), &length,
+                memMgr);
+            if (nullptr != data) {
+                value.assign((char*)data, length);
+                memMgr->deallocate(data);
+            }
             result = true;
             break;
         }
@@ -178,6 +494,254 @@ parseNode(DOMElement *node, std::vector<std::string> &atts, std::string &value)
 }
 
 
+// Attributes of the MeshFace element in the order parsed, the required
+// etype first
+static const char *MeshFaceAttributes[] = {
+    "etype", "mid", "aref", "gref", "name", "format", "count"
+};
+
+// Attributes of the MeshEdge element in the order parsed, the required
+// etype first
+static const char *MeshEdgeAttributes[] = {
+    "etype", "mid", "format", "count", "aref", "gref", "name"
+};
+
+// Attribute names as parseNode takes them
+template<size_t N>
+static std::vector<std::string>
+attributeNameList(const char *(&names)[N])
+{
+    return std::vector<std::string>(names, names + N);
+}
+
+
+// parseNode of a MeshFace or MeshEdge element, also scanning text content
+// into indices as parseMeshFace and parseMeshEdge would
+static bool
+decodeIndexContent(DOMElement *node, std::vector<std::string> &atts,
+    std::string &value, std::vector<MLINT> &indices)
+{
+    const std::vector<std::string> names = atts;
+    if (!parseNode(node, atts, value, &indices)) {
+        return false;
+    }
+    if (value.empty()) {
+        return true;
+    }
+    std::string etype;
+    std::string format("text");
+    size_t count = 1;
+    for (size_t i = 0; i < names.size(); ++i) {
+        const std::string &att = atts[i];
+        if ("etype" == names[i]) {
+            etype = att;
+        }
+        else if ("format" == names[i] && !att.empty()) {
+            format = att;
+        }
+        else if ("count" == names[i] && !att.empty() &&
+                !parseCount(att, count)) {
+            return true;
+        }
+    }
+    size_t valuesPerItem = ("Tri3" == etype) ? 3 : ("Quad4" == etype) ? 4 :
+        ("Edge2" == etype) ? 2 : 0;
+    if ("text" != format || 0 == valuesPerItem) {
+        return true;
+    }
+    size_t numInds = count * valuesPerItem;
+    TextScanner scan(value);
+    indices.reserve(std::min(numInds, value.size() / 2 + 1));
+    scan.scanArray(indices, numInds);
+    value.clear();
+    return true;
+}
+
+
+// Decode the base64 content of a ParamVertexArray element, leaving bytes
+// empty if it is missing or cannot be decoded
+static void
+decodeArrayContent(DOMElement *arrayNode, MeshLinkCompression::Codec codec,
+    bool swap, std::vector<XMLByte> &bytes)
+{
+    DOMNode *child = arrayNode->getFirstChild();
+    while (nullptr != child) {
+        if (DOMNode::TEXT_NODE == child->getNodeType() ||
+                DOMNode::CDATA_SECTION_NODE == child->getNodeType()) {
+            if (!decodeBase64(child->getNodeValue(), codec, swap, bytes)) {
+                bytes.clear();
+            }
+            break;
+        }
+        child = child->getNextSibling();
+    }
+}
+
+
+#ifdef HAVE_ZLIB
+// Xerces input stream decoding a gzip-compressed file as it is read
+class GzipInputStream : public BinInputStream {
+public:
+    GzipInputStream(gzFile file) :
+        file_(file),
+        pos_(0)
+    {
+        gzbuffer(file_, 256 * 1024);
+    }
+    ~GzipInputStream()
+    {
+        gzclose(file_);
+    }
+
+    XMLFilePos curPos() const override
+    {
+        return pos_;
+    }
+
+    XMLSize_t readBytes(XMLByte *const toFill,
+        const XMLSize_t maxToRead) override
+    {
+        int numRead = gzread(file_, toFill, (unsigned int)maxToRead);
+        if (numRead < 0) {
+            int errnum;
+            std::cout << "Gzip read error: " << gzerror(file_, &errnum) <<
+                std::endl;
+            numRead = 0;
+        }
+        pos_ += numRead;
+        return (XMLSize_t)numRead;
+    }
+
+    const XMLCh *getContentType() const override
+    {
+        return nullptr;
+    }
+
+private:
+    gzFile file_;
+    XMLFilePos pos_;
+};
+
+
+// Read a gzip-compressed MeshLinkBinary container into memory. Returns
+// false, leaving data empty, if the file is not one
+static bool
+readGzipBinary(const std::string &fname, std::vector<char> &data,
+    bool &readError)
+{
+    data.clear();
+    readError = false;
+    gzFile file = gzopen(fname.c_str(), "rb");
+    if (nullptr == file) {
+        return false;
+    }
+    char magic[sizeof(MeshLinkBinary::Magic)];
+    if (!gzdirect(file) &&
+            (int)sizeof(magic) == gzread(file, magic, sizeof(magic)) &&
+            MeshLinkBinary::isBinary(magic, sizeof(magic))) {
+        data.assign(magic, magic + sizeof(magic));
+        const size_t chunk = 1 << 20;
+        int numRead;
+        do {
+            size_t size = data.size();
+            data.resize(size + chunk);
+            numRead = gzread(file, data.data() + size, (unsigned int)chunk);
+            data.resize(size + (numRead > 0 ? numRead : 0));
+        } while (numRead > 0);
+        if (numRead < 0) {
+            int errnum;
+            std::cout << "Gzip read error: " << gzerror(file, &errnum) <<
+                std::endl;
+            readError = true;
+        }
+    }
+    gzclose(file);
+    return !data.empty();
+}
+
+
+// Whether a file is a gzip-compressed MeshLinkBinary container
+static bool
+isGzipBinaryFile(const std::string &fname)
+{
+    gzFile file = gzopen(fname.c_str(), "rb");
+    if (nullptr == file) {
+        return false;
+    }
+    char magic[sizeof(MeshLinkBinary::Magic)];
+    bool binary = !gzdirect(file) &&
+        (int)sizeof(magic) == gzread(file, magic, sizeof(magic)) &&
+        MeshLinkBinary::isBinary(magic, sizeof(magic));
+    gzclose(file);
+    return binary;
+}
+#endif
+
+
+// Xerces input source for a MeshLink document
+//
+// Reads a caller-supplied memory buffer, a memory-mapped file, a
+// gzip-compressed file (decoded as it is read) or a plain file.
+class MeshLinkInputSource : public InputSource {
+public:
+    MeshLinkInputSource(const char *fname, const char *buffer, size_t length,
+            bool mapFile) :
+        InputSource(fname),
+        fname_(fname),
+        data_((const XMLByte *)buffer),
+        length_(length),
+        gzip_(false)
+    {
+        if (nullptr != data_) {
+            return;
+        }
+        // Gzip files are recognized by their magic number
+        FILE *fp = fopen(fname, "rb");
+        if (nullptr != fp) {
+            unsigned char magic[2] = { 0, 0 };
+            gzip_ = (2 == fread(magic, 1, 2, fp) &&
+                0x1f == magic[0] && 0x8b == magic[1]);
+            fclose(fp);
+        }
+        // Read the file in place if it can be mapped
+        if (mapFile && !gzip_ && map_.map(fname_, true)) {
+            data_ = (const XMLByte *)map_.data();
+            length_ = map_.length();
+        }
+    }
+
+    BinInputStream *makeStream() const override
+    {
+        if (nullptr != data_) {
+            return new BinMemInputStream(data_, length_,
+                BinMemInputStream::BufOpt_Reference);
+        }
+        if (gzip_) {
+#ifdef HAVE_ZLIB
+            gzFile file = gzopen(fname_.c_str(), "rb");
+            if (nullptr == file) {
+                return nullptr;
+            }
+            return new GzipInputStream(file);
+#else
+            std::cout << fname_ << ": gzip-compressed MeshLink files require "
+                "a parser built with zlib (HAVE_ZLIB)." << std::endl;
+            return nullptr;
+#endif
+        }
+        LocalFileInputSource fileSource(X(fname_.c_str()));
+        return fileSource.makeStream();
+    }
+
+private:
+    std::string fname_;
+    const XMLByte *data_;
+    size_t length_;
+    bool gzip_;
+    MeshLinkMappedFile map_;
+};
+
+
 class SAXErrorHandler : public ErrorHandler {
 public:
     SAXErrorHandler() {
@@ -226,6 +790,10 @@ public:
         std::cout << "Fatal Errors: " << fatalErrorCount_ << std::endl;
     }
 
+    int getErrorCount() const {
+        return errorCount_ + fatalErrorCount_;
+    }
+
     virtual void resetErrors() {
         warningCount_ = 0;
         errorCount_ = 0;
@@ -239,91 +807,183 @@ private:
 };
 
 
+// Compiled schema grammars by schema file name. Each locked (read-only)
+// pool is shared by concurrent parsers. The cache holds its own platform
+// session so that the pools outlive the parsers' sessions.
+static std::mutex grammarPoolMutex;
+static std::map<std::string, XMLGrammarPool *> schemaGrammarPools;
+static XercesPlatformSession *grammarPoolSession = nullptr;
 
+// Return the grammar pool holding the compiled schema, loading it on
+// first use. The platform must be initialized.
+static XMLGrammarPool *
+getSchemaGrammarPool(const std::string &schemaName)
+{
+    std::lock_guard<std::mutex> lock(grammarPoolMutex);
+    auto iter = schemaGrammarPools.find(schemaName);
+    if (schemaGrammarPools.end() != iter) {
+        return iter->second;
+    }
 
+    XMLGrammarPool *pool = new XMLGrammarPoolImpl(
+        XMLPlatformUtils::fgMemoryManager);
+    XercesDOMParser *parser = new XercesDOMParser(nullptr,
+        XMLPlatformUtils::fgMemoryManager, pool);
+    SAXErrorHandler *errHandler(new SAXErrorHandler());
+    parser->setErrorHandler(errHandler);
 
-bool
-MeshLinkParserXerces::parseAttributes(xercesc_3_2::DOMElement *root)
-{
-    if (!meshAssociativity_) { return false; }
-    bool status = true;
-    meshAssociativity_->clearAttributes();
+    Grammar *schema = nullptr;
+    try {
+        parser->setDoNamespaces(true);
+        parser->setValidationSchemaFullChecking(true);
+        schema = parser->loadGrammar(schemaName.c_str(),
+            Grammar::SchemaGrammarType, true);
+    }
+    catch (const XMLException &toCatch) {
+        XMLCopier<XMLCh, char> msg(toCatch.getMessage());
+        std::cout << "Exception message: " << msg << std::endl;
+    }
+    catch (const SAXException &toCatch) {
+        XMLCopier<XMLCh, char> msg(toCatch.getMessage());
+        std::cout << "SAX Exception message: " << msg << std::endl;
+    }
+    catch (const DOMException &toCatch) {
+        XMLCopier<XMLCh, char> msg(toCatch.getMessage());
+        std::cout << "DOM Exception message: " << msg << std::endl;
+    }
 
-    DOMNode *attr;
-    {
-        DOMNodeTagNameFilter attFilter("Attribute");
-        DOMDocument *doc = root->getOwnerDocument();
-        DOMNode *attNode;
-        DOMNodeIterator *iter = doc->createNodeIterator(root, DOMNodeFilter::SHOW_ELEMENT, 
-            &attFilter, false);
-        while ((attNode = iter->nextNode()) != nullptr) {
-            DOMElement *elem = dynamic_cast<DOMElement *>(attNode);
-            if (nullptr != elem) {
+    if (nullptr == schema || 0 < errHandler->getErrorCount()) {
+        std::cout << "Schema not loaded. Check for file." << std::endl;
+        errHandler->outputCounts();
+        delete parser;
+        delete errHandler;
+        delete pool;
+        return nullptr;
+    }
 
-                int attid;
-                std::string name;
-                std::string contents;
+    std::cout << "Successfully loaded schema." << std::endl;
+    XMLCopier<XMLCh, char> targetNS(schema->getTargetNamespace());
+    std::cout << "Target namespace: " << targetNS << std::endl;
+    delete parser;
+    delete errHandler;
 
-                XMLCopier<char, XMLCh> nameName("name");
-                XMLCopier<char, XMLCh> attidName("attid");
+    pool->lockPool();
+    schemaGrammarPools[schemaName] = pool;
+    if (nullptr == grammarPoolSession) {
+        grammarPoolSession = new XercesPlatformSession();
+    }
+    return pool;
+}
 
-                DOMNamedNodeMap *attMap = attNode->getAttributes();
-                if (nullptr == attMap) {
-                    std::cout << "Attribute node not an element" << std::endl;
-                    continue;
-                }
 
-                // required atts
-                attr = attMap->getNamedItem(attidName);
-                if (nullptr == attr) {
-                    std::cout << "Attribute missing attid attribute" << std::endl;
-                    continue;
-                }
-                attid = XMLString::parseInt(attr->getNodeValue());
-                const MeshLinkAttribute *existing =
-                    meshAssociativity_->getAttributeByID(attid);
-                if (existing) {
-                    std::cout << "Attribute reuses existing attid attribute \"" <<
-                        attid << "\"" << std::endl;
-                    continue;
-                }
+// Release the compiled schema grammars
+void
+MeshLinkParserXerces::releaseSchemaGrammars()
+{
+    std::lock_guard<std::mutex> lock(grammarPoolMutex);
+    for (auto &entry : schemaGrammarPools) {
+        delete entry.second;
+    }
+    schemaGrammarPools.clear();
+    delete grammarPoolSession;
+    grammarPoolSession = nullptr;
+}
 
-                // optional atts
-                attr = attMap->getNamedItem(nameName);
-                if (nullptr != attr) {
-                    XMLCopier<XMLCh, char> xmlStr(attr->getNodeValue());
-                    name = (char *)xmlStr;
-                }
 
-                // contents
-                DOMNode *child = attNode->getFirstChild();
-                while (nullptr != child) {
-                    if (DOMNode::TEXT_NODE == child->getNodeType()) {
-                        XMLCopier<XMLCh, char> xmlStr(child->getNodeValue());
-                        contents = (char *)xmlStr;
-                        break;
-                    }
-                    child = child->getNextSibling();
-                }
 
-                if (contents.empty()) {
-                    std::cout << "Attribute missing content" << std::endl;
-                    continue;
-                }
-                else {
-                    MeshLinkAttribute mlAtt((MLINT)attid, name, contents, false,
-                        *meshAssociativity_);
-                    if (mlAtt.isValid()) {
-                        meshAssociativity_->addAttribute(mlAtt);
-                    }
-                }
-            }
-        }
-        iter->release();
-    }
 
-    // AttributeGroup elements
-    {
+
+bool
+MeshLinkParserXerces::parseAttribute(xercesc_3_2::DOMElement *attNode,
+    bool isGroup)
+{
+    const char *elemName = isGroup ? "AttributeGroup" : "Attribute";
+    DOMNode *attr;
+
+    int attid;
+    std::string name;
+    std::string contents;
+
+    XMLCopier<char, XMLCh> nameName("name");
+    XMLCopier<char, XMLCh> attidName("attid");
+
+    DOMNamedNodeMap *attMap = attNode->getAttributes();
+    if (nullptr == attMap) {
+        std::cout << elemName << " node not an element" << std::endl;
+        return false;
+    }
+
+    // required atts
+    attr = attMap->getNamedItem(attidName);
+    if (nullptr == attr) {
+        std::cout << elemName << " missing attid attribute" << std::endl;
+        return false;
+    }
+    attid = XMLString::parseInt(attr->getNodeValue());
+    const MeshLinkAttribute *existing =
+        meshAssociativity_->getAttributeByID(attid);
+    if (existing) {
+        std::cout << elemName << " reuses existing attid attribute \"" <<
+            attid << "\"" << std::endl;
+        return false;
+    }
+
+    // optional atts
+    attr = attMap->getNamedItem(nameName);
+    if (nullptr != attr) {
+        XMLCopier<XMLCh, char> xmlStr(attr->getNodeValue());
+        name = (char *)xmlStr;
+    }
+
+    // contents
+    DOMNode *child = attNode->getFirstChild();
+    while (nullptr != child) {
+        if (DOMNode::TEXT_NODE == child->getNodeType()) {
+            XMLCopier<XMLCh, char> xmlStr(child->getNodeValue());
+            contents = (char *)xmlStr;
+            break;
+        }
+        child = child->getNextSibling();
+    }
+
+    if (contents.empty()) {
+        std::cout << elemName << " missing content" << std::endl;
+        return false;
+    }
+
+    MeshLinkAttribute mlAtt((MLINT)attid, name, contents, isGroup,
+        *meshAssociativity_);
+    if (mlAtt.isValid()) {
+        meshAssociativity_->addAttribute(std::move(mlAtt));
+    }
+    return true;
+}
+
+
+bool
+MeshLinkParserXerces::parseAttributes(xercesc_3_2::DOMElement *root)
+{
+    if (!meshAssociativity_) { return false; }
+    bool status = true;
+    meshAssociativity_->clearAttributes();
+
+    {
+        DOMNodeTagNameFilter attFilter("Attribute");
+        DOMDocument *doc = root->getOwnerDocument();
+        DOMNode *attNode;
+        DOMNodeIterator *iter = doc->createNodeIterator(root, DOMNodeFilter::SHOW_ELEMENT, 
+            &attFilter, false);
+        while ((attNode = iter->nextNode()) != nullptr) {
+            DOMElement *elem = dynamic_cast<DOMElement *>(attNode);
+            if (nullptr != elem) {
+                parseAttribute(elem, false);
+            }
+        }
+        iter->release();
+    }
+
+    // AttributeGroup elements
+    {
         DOMNodeTagNameFilter attFilter("AttributeGroup");
         DOMDocument *doc = root->getOwnerDocument();
         DOMNode *attNode;
@@ -332,73 +992,169 @@ MeshLinkParserXerces::parseAttributes(xercesc_3_2::DOMElement *root)
         while ((attNode = iter->nextNode()) != nullptr) {
             DOMElement *elem = dynamic_cast<DOMElement *>(attNode);
             if (nullptr != elem) {
+                parseAttribute(elem, true);
+            }
+        }
+        iter->release();
+    }
 
-                int attid;
-                std::string name;
-                std::string contents;
+    return status;
+}
 
-                XMLCopier<char, XMLCh> nameName("name");
-                XMLCopier<char, XMLCh> attidName("attid");
 
-                DOMNamedNodeMap *attMap = attNode->getAttributes();
-                if (nullptr == attMap) {
-                    std::cout << "AttributeGroup node not an element" << std::endl;
-                    continue;
-                }
+bool
+MeshLinkParserXerces::parseTransform(xercesc_3_2::DOMElement *attNode)
+{
+    DOMNode *attr;
 
-                // required atts
-                attr = attMap->getNamedItem(attidName);
-                if (nullptr == attr) {
-                    std::cout << "AttributeGroup missing attid attribute" <<
-                        std::endl;
-                    continue;
-                }
-                attid = XMLString::parseInt(attr->getNodeValue());
-                const MeshLinkAttribute *existing =
-                    meshAssociativity_->getAttributeByID(attid);
-                if (existing) {
-                    std::cout << "AttributeGroup reuses existing attid attribute \"" <<
-                        attid << "\"" << std::endl;
-                    continue;
-                }
+    int xid;
+    std::string name;
+    std::string contents;
 
-                // optional atts
-                attr = attMap->getNamedItem(nameName);
-                if (nullptr != attr) {
-                    XMLCopier<XMLCh, char> xmlStr(attr->getNodeValue());
-                    name = (char *)xmlStr;
-                }
+    XMLCopier<char, XMLCh> nameName("name");
+    XMLCopier<char, XMLCh> xidName("xid");
 
-                // contents
-                DOMNode *child = attNode->getFirstChild();
-                while (nullptr != child) {
-                    if (DOMNode::TEXT_NODE == child->getNodeType()) {
-                        XMLCopier<XMLCh, char> xmlStr(child->getNodeValue());
-                        contents = (char *)xmlStr;
-                        break;
-                    }
-                    child = child->getNextSibling();
-                }
+    DOMNamedNodeMap *attMap = attNode->getAttributes();
+    if (nullptr == attMap) {
+        std::cout << "Attribute node not an element" << std::endl;
+        return false;
+    }
 
-                if (contents.empty()) {
-                    std::cout << "AttributeGroup missing content" << std::endl;
-                    continue;
-                }
-                else {
-                    MeshLinkAttribute mlAtt((MLINT)attid, name, contents, true,
-                        *meshAssociativity_);
-                    if (mlAtt.isValid()) {
-                        meshAssociativity_->addAttribute(mlAtt);
-                    }
-                }
-            }
+    // required atts
+    attr = attMap->getNamedItem(xidName);
+    if (nullptr == attr) {
+        std::cout << "Transform missing xid attribute" << std::endl;
+        return false;
+    }
+    xid = XMLString::parseInt(attr->getNodeValue());
+    const MeshLinkTransform *existing =
+        meshAssociativity_->getTransformByID(xid);
+    if (existing) {
+        std::cout << "Transform reuses existing xid attribute \"" <<
+            xid << "\"" << std::endl;
+        return false;
+    }
+
+    // optional name attribute
+    attr = attMap->getNamedItem(nameName);
+    if (nullptr != attr) {
+        XMLCopier<XMLCh, char> xmlStr(attr->getNodeValue());
+        name = (char *)xmlStr;
+    }
+
+    // contents
+    DOMNode *child = attNode->getFirstChild();
+    while (nullptr != child) {
+        if (DOMNode::TEXT_NODE == child->getNodeType()) {
+            XMLCopier<XMLCh, char> xmlStr(child->getNodeValue());
+            contents = (char *)xmlStr;
+            break;
         }
-        iter->release();
+        child = child->getNextSibling();
     }
 
-    return status;
+    if (contents.empty()) {
+        std::cout << "Transform missing content" << std::endl;
+        return false;
+    }
+
+    MeshLinkTransform mlXform((MLINT)xid, name, contents,
+        *meshAssociativity_);
+    if (mlXform.isValid()) {
+        // optional aref attribute
+        DOMNode *arefAttr = attMap->getNamedItem(X("aref"));
+        if (nullptr != arefAttr) {
+            const XMLCh *valStr = arefAttr->getNodeValue();
+            mlXform.setAref(XMLString::parseInt(valStr));
+        }
+
+        meshAssociativity_->addTransform(std::move(mlXform));
+    }
+    return true;
+}
+
+
+bool
+MeshLinkParserXerces::parseMeshElementLinkage(xercesc_3_2::DOMElement *attNode)
+{
+    DOMNode *attr;
+
+    std::string name;
+    std::string srcEntRef;
+    std::string tgtEntRef;
+
+    XMLCopier<char, XMLCh> nameName("name");
+    XMLCopier<char, XMLCh> srcEntRefName("sourceEntityRef");
+    XMLCopier<char, XMLCh> tgtEntRefName("targetEntityRef");
+
+    DOMNamedNodeMap *attMap = attNode->getAttributes();
+    if (nullptr == attMap) {
+        std::cout << "Attribute node not an element" << std::endl;
+        return false;
+    }
+
+    // required atts
+    attr = attMap->getNamedItem(srcEntRefName);
+    if (nullptr == attr) {
+        std::cout << "MeshElementLinkage missing sourceEntityRef attribute" << std::endl;
+        return false;
+    }
+    else {
+        XMLCopier<XMLCh, char> xmlStr(attr->getNodeValue());
+        srcEntRef = (char *)xmlStr;
+    }
+
+    attr = attMap->getNamedItem(tgtEntRefName);
+    if (nullptr == attr) {
+        std::cout << "MeshElementLinkage missing targetEntityRef attribute" << std::endl;
+        return false;
+    }
+    else {
+        XMLCopier<XMLCh, char> xmlStr(attr->getNodeValue());
+        tgtEntRef = (char *)xmlStr;
+    }
+
+
+    // optional name attribute
+    attr = attMap->getNamedItem(nameName);
+    if (nullptr != attr) {
+        XMLCopier<XMLCh, char> xmlStr(attr->getNodeValue());
+        name = (char *)xmlStr;
+    }
+
+    
+    MeshElementLinkage *mlLink = new MeshElementLinkage(name, srcEntRef,
+        tgtEntRef, *meshAssociativity_);
+    if (mlLink->isValid() &&
+        // stores and takes ownership of pointer
+        meshAssociativity_->addMeshElementLinkage(mlLink)
+        ) {
+        // optional xref attribute
+        DOMNode *xrefAttr = attMap->getNamedItem(X("xref"));
+        if (nullptr != xrefAttr) {
+            const XMLCh *valStr = xrefAttr->getNodeValue();
+            if (!mlLink->setXref(XMLString::parseInt(valStr), *meshAssociativity_)) {
+                delete mlLink; mlLink = NULL;
+                std::cout << "MeshElementLinkage missing xref transform" << std::endl;
+                return false;
+            }
+        }
+        // optional aref attribute
+        DOMNode *arefAttr = attMap->getNamedItem(X("aref"));
+        if (nullptr != arefAttr) {
+            const XMLCh *valStr = arefAttr->getNodeValue();
+            mlLink->setAref(XMLString::parseInt(valStr));
+        }
+    }
+    else {
+        delete mlLink; mlLink = NULL;
+        std::cout << "MeshElementLinkage missing source or target entity " << std::endl;
+        return false;
+    }
+    return true;
 }
 
+
 bool
 MeshLinkParserXerces::parsePeriodicInfo(xercesc_3_2::DOMElement *root)
 {
@@ -407,7 +1163,6 @@ MeshLinkParserXerces::parsePeriodicInfo(xercesc_3_2::DOMElement *root)
     meshAssociativity_->clearTransforms();
     meshAssociativity_->clearMeshElementLinkages();
 
-    DOMNode *attr;
     {
         DOMNodeTagNameFilter attFilter("Transform");
         DOMDocument *doc = root->getOwnerDocument();
@@ -417,72 +1172,7 @@ MeshLinkParserXerces::parsePeriodicInfo(xercesc_3_2::DOMElement *root)
         while ((attNode = iter->nextNode()) != nullptr) {
             DOMElement *elem = dynamic_cast<DOMElement *>(attNode);
             if (nullptr != elem) {
-
-                int xid;
-                std::string name;
-                std::string contents;
-
-                XMLCopier<char, XMLCh> nameName("name");
-                XMLCopier<char, XMLCh> xidName("xid");
-
-                DOMNamedNodeMap *attMap = attNode->getAttributes();
-                if (nullptr == attMap) {
-                    std::cout << "Attribute node not an element" << std::endl;
-                    continue;
-                }
-
-                // required atts
-                attr = attMap->getNamedItem(xidName);
-                if (nullptr == attr) {
-                    std::cout << "Transform missing xid attribute" << std::endl;
-                    continue;
-                }
-                xid = XMLString::parseInt(attr->getNodeValue());
-                const MeshLinkTransform *existing =
-                    meshAssociativity_->getTransformByID(xid);
-                if (existing) {
-                    std::cout << "Transform reuses existing xid attribute \"" <<
-                        xid << "\"" << std::endl;
-                    continue;
-                }
-
-                // optional name attribute
-                attr = attMap->getNamedItem(nameName);
-                if (nullptr != attr) {
-                    XMLCopier<XMLCh, char> xmlStr(attr->getNodeValue());
-                    name = (char *)xmlStr;
-                }
-
-                // contents
-                DOMNode *child = attNode->getFirstChild();
-                while (nullptr != child) {
-                    if (DOMNode::TEXT_NODE == child->getNodeType()) {
-                        XMLCopier<XMLCh, char> xmlStr(child->getNodeValue());
-                        contents = (char *)xmlStr;
-                        break;
-                    }
-                    child = child->getNextSibling();
-                }
-
-                if (contents.empty()) {
-                    std::cout << "Transform missing content" << std::endl;
-                    continue;
-                }
-                else {
-                    MeshLinkTransform mlXform((MLINT)xid, name, contents,
-                        *meshAssociativity_);
-                    if (mlXform.isValid()) {
-                        // optional aref attribute
-                        DOMNode *arefAttr = attMap->getNamedItem(X("aref"));
-                        if (nullptr != arefAttr) {
-                            const XMLCh *valStr = arefAttr->getNodeValue();
-                            mlXform.setAref(XMLString::parseInt(valStr));
-                        }
-
-                        // stores a copy
-                        meshAssociativity_->addTransform(mlXform);
-                    }
-                }
+                parseTransform(elem);
             }
         }
         iter->release();
@@ -497,79 +1187,7 @@ MeshLinkParserXerces::parsePeriodicInfo(xercesc_3_2::DOMElement *root)
         while ((attNode = iter->nextNode()) != nullptr) {
             DOMElement *elem = dynamic_cast<DOMElement *>(attNode);
             if (nullptr != elem) {
-
-                std::string name;
-                std::string srcEntRef;
-                std::string tgtEntRef;
-
-                XMLCopier<char, XMLCh> nameName("name");
-                XMLCopier<char, XMLCh> srcEntRefName("sourceEntityRef");
-                XMLCopier<char, XMLCh> tgtEntRefName("targetEntityRef");
-
-                DOMNamedNodeMap *attMap = attNode->getAttributes();
-                if (nullptr == attMap) {
-                    std::cout << "Attribute node not an element" << std::endl;
-                    continue;
-                }
-
-                // required atts
-                attr = attMap->getNamedItem(srcEntRefName);
-                if (nullptr == attr) {
-                    std::cout << "MeshElementLinkage missing sourceEntityRef attribute" << std::endl;
-                    continue;
-                }
-                else {
-                    XMLCopier<XMLCh, char> xmlStr(attr->getNodeValue());
-                    srcEntRef = (char *)xmlStr;
-                }
-
-                attr = attMap->getNamedItem(tgtEntRefName);
-                if (nullptr == attr) {
-                    std::cout << "MeshElementLinkage missing targetEntityRef attribute" << std::endl;
-                    continue;
-                }
-                else {
-                    XMLCopier<XMLCh, char> xmlStr(attr->getNodeValue());
-                    tgtEntRef = (char *)xmlStr;
-                }
-
-
-                // optional name attribute
-                attr = attMap->getNamedItem(nameName);
-                if (nullptr != attr) {
-                    XMLCopier<XMLCh, char> xmlStr(attr->getNodeValue());
-                    name = (char *)xmlStr;
-                }
-
-                
-                MeshElementLinkage *mlLink = new MeshElementLinkage(name, srcEntRef,
-                    tgtEntRef, *meshAssociativity_);
-                if (mlLink->isValid() &&
-                    // stores and takes ownership of pointer
-                    meshAssociativity_->addMeshElementLinkage(mlLink)
-                    ) {
-                    // optional xref attribute
-                    DOMNode *xrefAttr = attMap->getNamedItem(X("xref"));
-                    if (nullptr != xrefAttr) {
-                        const XMLCh *valStr = xrefAttr->getNodeValue();
-                        if (!mlLink->setXref(XMLString::parseInt(valStr), *meshAssociativity_)) {
-                            delete mlLink; mlLink = NULL;
-                            std::cout << "MeshElementLinkage missing xref transform" << std::endl;
-                            continue;
-                        }
-                    }
-                    // optional aref attribute
-                    DOMNode *arefAttr = attMap->getNamedItem(X("aref"));
-                    if (nullptr != arefAttr) {
-                        const XMLCh *valStr = arefAttr->getNodeValue();
-                        mlLink->setAref(XMLString::parseInt(valStr));
-                    }
-                }
-                else {
-                    delete mlLink; mlLink = NULL;
-                    std::cout << "MeshElementLinkage missing source or target entity " << std::endl;
-                    continue;
-                }
+                parseMeshElementLinkage(elem);
             }
         }
         iter->release();
@@ -590,59 +1208,28 @@ MeshLinkParserXerces::validate(const std::string &fileName,
     // initialization, and must be destroyed before termination - that
     // includes anything on the stack, so, don't use the stack
     // (includes std::shared_ptr)
-    try {
-        XMLPlatformUtils::Initialize();
-        std::cout << "Successfully initialized xerces API." << std::endl;
+    XercesPlatformSession session;
+    if (!session) {
+        return false;
     }
-    catch (const XMLException &) {
-        std::cout << "Failed to initialize xerces API." << std::endl;
-        return 1;
+
+    // Use explicitly defined schema file, not the schemaLocation
+    // specified in meshlink file. The compiled schema is cached.
+    XMLGrammarPool *grammarPool = nullptr;
+    if (!schemaName.empty() &&
+            nullptr == (grammarPool = getSchemaGrammarPool(schemaName))) {
+        result = false;
     }
 
     // No std::shared_ptr here - gets released after Terminate(),
     // which throws a memory exception
-    XercesDOMParser* parser = new XercesDOMParser();
+    XercesDOMParser* parser = new XercesDOMParser(nullptr,
+        XMLPlatformUtils::fgMemoryManager, grammarPool);
+    parser->useCachedGrammarInParse(nullptr != grammarPool);
     // std::shared_ptr okay here - parser does NOT take ownership
     SAXErrorHandler* errHandler(new SAXErrorHandler());
     parser->setErrorHandler(errHandler);
 
-    if (!schemaName.empty()) {
-        // Use explicitly defined schema file, not the schemaLocation
-        // specified in meshlink file
-        try {
-            XMLCopier<char, XMLCh> sc(schemaName.c_str());
-            parser->useCachedGrammarInParse(true);
-            Grammar *schema = parser->loadGrammar(sc, Grammar::SchemaGrammarType,
-                true);
-            if (nullptr == schema) {
-                std::cout << "Schema not loaded. Check for file." << std::endl;
-                errHandler->outputCounts();
-                result = false;
-            }
-            else {
-                std::cout << "Successfully loaded schema." << std::endl;
-                XMLCopier<XMLCh, char> targetNS(schema->getTargetNamespace());
-                std::cout << "Target namespace: " << targetNS << std::endl;
-                errHandler->resetErrors();
-            }
-        }
-        catch (const XMLException &toCatch) {
-            XMLCopier<XMLCh, char> msg(toCatch.getMessage());
-            std::cout << "Exception message: " << msg << std::endl;
-            result = false;
-        }
-        catch (const SAXException &toCatch) {
-            XMLCopier<XMLCh, char> msg(toCatch.getMessage());
-            std::cout << "SAX Exception message: " << msg << std::endl;
-            result = false;
-        }
-        catch (const DOMException &toCatch) {
-            XMLCopier<XMLCh, char> msg(toCatch.getMessage());
-            std::cout << "DOM Exception message: " << msg << std::endl;
-            result = false;
-        }
-    }
-
     if (result) {
         try {
             if (parser->isUsingCachedGrammarInParse()) {
@@ -675,15 +1262,6 @@ MeshLinkParserXerces::validate(const std::string &fileName,
     delete parser;
     delete errHandler;
 
-    try {
-        XMLPlatformUtils::Terminate();
-        std::cout << "Successfully terminated xerces API." << std::endl;
-    }
-    catch (const XMLException &) {
-        std::cout << "Failed to terminate xerces API." << std::endl;
-        return false;
-    }
-
     return result;
 }
 
@@ -806,8 +1384,8 @@ parseGeomGroupDOM(DOMNode *geometryGroupDOM,
         GeometryGroup *refgroup = meshAssociativity->getGeometryGroupByID(grefID);
         if (refgroup) {
             refgroup->setGroupID(gid);
-            const std::vector<std::string> &ents = refgroup->getEntityNames();
-            std::vector<std::string>::const_iterator iter;
+            const std::set<std::string> &ents = refgroup->getEntityNameSet();
+            std::set<std::string>::const_iterator iter;
             for (iter = ents.cbegin(); iter != ents.cend(); ++iter) {
                 group.addEntityName((*iter).c_str());
             }
@@ -837,6 +1415,29 @@ parseGeomGroupDOM(DOMNode *geometryGroupDOM,
 }
 
 
+// Parse the filename and aref attributes of a GeometryFile or MeshFile
+// element
+static bool
+parseFileAttributes(DOMElement *elem, const char *elemName,
+    std::string &filename, std::string &aref)
+{
+    if (elem->hasAttribute(X("filename"))) {
+        XMLCopier<XMLCh, char> xmlStr(elem->getAttribute(X("filename")));
+        filename = (char *)xmlStr;
+    }
+    else {
+        std::cout << elemName << " node: no filename attribute." <<
+            std::endl;
+        return false;
+    }
+    if (elem->hasAttribute(X("aref"))) {
+        XMLCopier<XMLCh, char> xmlStr(elem->getAttribute(X("aref")));
+        aref = (char *)xmlStr;
+    }
+    return true;
+}
+
+
 // Parse GeometryFile element and child GeometryReference and
 // GeometryGroup elements
 bool
@@ -860,19 +1461,9 @@ MeshLinkParserXerces::parseGeometryRefs(DOMElement *root)
 
                 std::string filename, aref;
 
-                if (elem->hasAttribute(X("filename"))) {
-                    XMLCopier<XMLCh, char> xmlStr(elem->getAttribute(X("filename")));
-                    filename = (char *)xmlStr;
-                }
-                else {
-                    std::cout << "GeometryFile node: no filename attribute." <<
-                        std::endl;
+                if (!parseFileAttributes(elem, "GeometryFile", filename, aref)) {
                     return false;
                 }
-                if (elem->hasAttribute(X("aref"))) {
-                    XMLCopier<XMLCh, char> xmlStr(elem->getAttribute(X("aref")));
-                    aref = (char *)xmlStr;
-                }
 
                 GeometryFile geomFile(filename, aref);
 
@@ -885,15 +1476,15 @@ MeshLinkParserXerces::parseGeometryRefs(DOMElement *root)
                     while (result && (geomRef = iter2->nextNode()) != nullptr) {
                         GeometryGroup geom_group;
                         if ((result = parseGeomRefDOM(geomRef, geom_group))) {
-                            meshAssociativity_->addGeometryGroup(geom_group);
                             geomFile.addGeometryGroupID(geom_group.getID());
+                            meshAssociativity_->addGeometryGroup(std::move(geom_group));
                         }
                     }
                     iter2->release();
                 }
                 // Since we add via value instead of pointer, we better
                 // add it after we've made all our changes/additions
-                meshAssociativity_->addGeometryFile(geomFile);
+                meshAssociativity_->addGeometryFile(std::move(geomFile));
             }
         }
         iter->release();
@@ -910,7 +1501,7 @@ MeshLinkParserXerces::parseGeometryRefs(DOMElement *root)
             GeometryGroup geom_group;
             if ((result = parseGeomGroupDOM(geomGroup, meshAssociativity_,
                 geom_group))) {
-                meshAssociativity_->addGeometryGroup(geom_group);
+                meshAssociativity_->addGeometryGroup(std::move(geom_group));
             }
         }
         iter->release();
@@ -928,18 +1519,9 @@ MeshLinkParserXerces::parseMeshFile(xercesc_3_2::DOMElement *meshFile)
 
     std::string filename, aref;
 
-    if (meshFile->hasAttribute(X("filename"))) {
-        XMLCopier<XMLCh, char> xmlStr(meshFile->getAttribute(X("filename")));
-        filename = (char *)xmlStr;
-    }
-    else {
-        std::cout << "MeshFile node: no filename attribute." << std::endl;
+    if (!parseFileAttributes(meshFile, "MeshFile", filename, aref)) {
         return false;
     }
-    if (meshFile->hasAttribute(X("aref"))) {
-        XMLCopier<XMLCh, char> xmlStr(meshFile->getAttribute(X("aref")));
-        aref = (char *)xmlStr;
-    }
 
     MeshFile mFile(filename, aref);
 
@@ -957,6 +1539,9 @@ MeshLinkParserXerces::parseMeshFile(xercesc_3_2::DOMElement *meshFile)
             ++count;
             if (DOMNode::ELEMENT_NODE == node->getNodeType()) {
                 modelRef = dynamic_cast<DOMElement*>(node);
+                if (!loadFilterAccepts(modelFilter_, modelRef)) {
+                    continue;
+                }
                 result = parseMeshRefModel(mFile, modelRef);
             }
         }
@@ -968,7 +1553,7 @@ MeshLinkParserXerces::parseMeshFile(xercesc_3_2::DOMElement *meshFile)
         return false;
     }
 
-    meshAssociativity_->addMeshFile(mFile);
+    meshAssociativity_->addMeshFile(std::move(mFile));
 
     if (!result) {
         std::cout << "MeshFile node: problem parsing mesh reference." <<
@@ -980,7 +1565,7 @@ MeshLinkParserXerces::parseMeshFile(xercesc_3_2::DOMElement *meshFile)
 }
 
 
-#define ParseMeshContainer(MeshModel, MeshObj)                          \
+#define ParseMeshContainerNoRecurse(MeshModel, MeshObj)                 \
     {                                                                   \
         DOMNodeTagNameFilter attFilter(#MeshObj);                       \
         DOMNode *node;                                                  \
@@ -991,6 +1576,11 @@ MeshLinkParserXerces::parseMeshFile(xercesc_3_2::DOMElement *meshFile)
         XMLSize_t i = 0;                                                \
         while (result && (node = iter->nextNode()) != nullptr) {        \
             ++i;                                                        \
+            DOMNode *parentNode = node->getParentNode();                \
+            if (parentNode && DOMNode::ELEMENT_NODE == parentNode->getNodeType()) { \
+                DOMElement *parentElem = dynamic_cast<DOMElement*>(parentNode); \
+                if (parentElem != MeshModel) continue;                  \
+            }                                                           \
             if (DOMNode::ELEMENT_NODE == node->getNodeType()) {         \
                 meshObj = dynamic_cast<DOMElement*>(node);              \
                 result = parse##MeshObj(meshModel, meshObj);            \
@@ -1005,42 +1595,10 @@ MeshLinkParserXerces::parseMeshFile(xercesc_3_2::DOMElement *meshFile)
     }
 
 
-#define ParseMeshContainerNoRecurse(MeshModel, MeshObj)                 \
-    {                                                                   \
-        DOMNodeTagNameFilter attFilter(#MeshObj);                       \
-        DOMNode *node;                                                  \
-        DOMDocument *doc = MeshModel->getOwnerDocument();               \
-        DOMNodeIterator *iter = doc->createNodeIterator(MeshModel,      \
-            DOMNodeFilter::SHOW_ELEMENT, &attFilter, false);            \
-        DOMElement *meshObj;                                            \
-        XMLSize_t i = 0;                                                \
-        while (result && (node = iter->nextNode()) != nullptr) {        \
-            ++i;                                                        \
-            DOMNode *parentNode = node->getParentNode();                \
-            if (parentNode && DOMNode::ELEMENT_NODE == parentNode->getNodeType()) { \
-                DOMElement *parentElem = dynamic_cast<DOMElement*>(parentNode); \
-                if (parentElem != MeshModel) continue;                  \
-            }                                                           \
-            if (DOMNode::ELEMENT_NODE == node->getNodeType()) {         \
-                meshObj = dynamic_cast<DOMElement*>(node);              \
-                result = parse##MeshObj(meshModel, meshObj);            \
-            }                                                           \
-        }                                                               \
-        iter->release();                                                \
-        if (!result) {                                                  \
-            std::cout << "MeshModelReference node: problem "            \
-                "parsing " << #MeshObj << " " << i << std::endl;        \
-            return false;                                               \
-        }                                                               \
-    }
-
-
-bool
-MeshLinkParserXerces::parseMeshRefModel(MeshFile &meshFile,
+MeshModel *
+MeshLinkParserXerces::createMeshModel(MeshFile &meshFile,
     xercesc_3_2::DOMElement *modelRef)
 {
-    if (!meshAssociativity_) { return false; }
-
     bool mapID = false;
     int mid = MESH_TOPO_INVALID_REF;
     std::string name;
@@ -1055,7 +1613,7 @@ MeshLinkParserXerces::parseMeshRefModel(MeshFile &meshFile,
     else {
         // Bad model store
         std::cout << "MeshModelReference: missing ref attribute." << std::endl;
-        return false;
+        return NULL;
     }
 
     if (modelRef->hasAttribute(X("mid"))) {
@@ -1066,7 +1624,7 @@ MeshLinkParserXerces::parseMeshRefModel(MeshFile &meshFile,
             // Can't have multiple mid values
             std::cout << "MeshModelReference: mid identifier already in "
                 "use." << std::endl;
-            return false;
+            return NULL;
         }
         mapID = true;
     }
@@ -1086,31 +1644,256 @@ MeshLinkParserXerces::parseMeshRefModel(MeshFile &meshFile,
             // Can't have multiple name values
             std::cout << "MeshModelReference: name identifier already in "
                 "use." << std::endl;
-            return false;
+            return NULL;
         }
     }
 
     MeshModel* meshModel = new MeshModel(ref, mid, aref, gref, name);
 
-    bool result = meshAssociativity_->addMeshModel(meshModel, mapID);
-
-    if (!result) {
+    if (!meshAssociativity_->addMeshModel(meshModel, mapID)) {
         // bad model store
         std::cout << "MeshModelReference: error storing model." << std::endl;
         delete meshModel;
+        return NULL;
+    }
+
+    // Add to MeshFile
+    meshFile.addModelRef(ref);
+    return meshModel;
+}
+
+
+bool
+MeshLinkParserXerces::loadFilterAccepts(const MeshLinkLoadFilter &filter,
+    xercesc_3_2::DOMElement *element)
+{
+    std::string name;
+    MLINT gref = MESH_TOPO_INVALID_REF;
+    if (element->hasAttribute(X("name"))) {
+        XMLCopier<XMLCh, char> xmlStr(element->getAttribute(X("name")));
+        name = std::string(xmlStr);
+    }
+    if (element->hasAttribute(X("gref"))) {
+        gref = XMLString::parseInt(element->getAttribute(X("gref")));
+    }
+    return filter.accepts(name, gref);
+}
+
+
+void
+MeshLinkParserXerces::printMeshModelInfo(xercesc_3_2::DOMElement *modelRef,
+    MeshModel *meshModel)
+{
+    if (verbose_level_ > 0) {
+        DOMAttr *attNode = modelRef->getAttributeNode(X("name"));
+        if (attNode) {
+            XMLCopier<XMLCh, char> val(attNode->getValue());
+            printf("MeshModel %s geometry associations:\n", (char *)val);
+        }
+        printf("%8" MLINT_FORMAT " mesh edges\n", meshModel->getNumEdges());
+        printf("%8" MLINT_FORMAT " mesh faces\n", meshModel->getNumFaces());
+    }
+}
+
+
+// Tags of the mesh object elements of a MeshModelReference, in the order
+// they are parsed
+static const char *MeshObjectTags[] = {
+    "MeshSheet", "MeshSheetReference", "MeshString", "MeshStringReference"
+};
+static const size_t NumMeshObjectKinds =
+    sizeof(MeshObjectTags) / sizeof(MeshObjectTags[0]);
+
+
+void
+MeshLinkParserXerces::getMeshObjects(xercesc_3_2::DOMElement *modelRef,
+    std::vector<xercesc_3_2::DOMElement *> &objs, std::vector<size_t> &kinds,
+    std::vector<size_t> &ordinals)
+{
+    const MeshLinkLoadFilter *filters[NumMeshObjectKinds] = {
+        &sheetFilter_, &sheetFilter_, &stringFilter_, &stringFilter_
+    };
+    std::vector<DOMElement *> kindObjs;
+    for (size_t k = 0; k < NumMeshObjectKinds; ++k) {
+        kindObjs.clear();
+        getElementsByTag(modelRef, MeshObjectTags[k], kindObjs);
+        for (size_t i = 0; i < kindObjs.size(); ++i) {
+            if (loadFilterAccepts(*filters[k], kindObjs[i])) {
+                objs.push_back(kindObjs[i]);
+                kinds.push_back(k);
+                ordinals.push_back(i + 1);
+            }
+        }
+    }
+}
+
+
+// Decode the bulk content of the selected models ahead of populating the
+// associativity, so that only the entities are created sequentially
+void
+MeshLinkParserXerces::decodeContent(xercesc_3_2::DOMElement *root)
+{
+    decodedContent_.clear();
+    if (ThreadPool::getConcurrency() < 2) {
+        return;
+    }
+
+    // ParamVertexArray elements of the models, and MeshFace, MeshEdge and
+    // ParamVertexArray elements of their sheets and strings
+    std::vector<DOMElement *> elems;
+    std::vector<DOMElement *> files;
+    std::vector<DOMElement *> models;
+    std::vector<DOMElement *> arrays;
+    std::vector<DOMElement *> objs;
+    std::vector<size_t> kinds;
+    std::vector<size_t> ordinals;
+    getElementsByTag(root, "MeshFile", files);
+    for (size_t f = 0; f < files.size(); ++f) {
+        models.clear();
+        getElementsByTag(files[f], "MeshModelReference", models);
+        for (size_t m = 0; m < models.size(); ++m) {
+            DOMElement *modelRef = models[m];
+            if (!loadFilterAccepts(modelFilter_, modelRef)) {
+                continue;
+            }
+            arrays.clear();
+            getElementsByTag(modelRef, "ParamVertexArray", arrays);
+            for (size_t a = 0; a < arrays.size(); ++a) {
+                if (arrays[a]->getParentNode() == modelRef) {
+                    elems.push_back(arrays[a]);
+                }
+            }
+            objs.clear();
+            kinds.clear();
+            ordinals.clear();
+            getMeshObjects(modelRef, objs, kinds, ordinals);
+            for (size_t o = 0; o < objs.size(); ++o) {
+                getElementsByTag(objs[o], "ParamVertexArray", elems);
+                getElementsByTag(objs[o], "MeshFace", elems);
+                getElementsByTag(objs[o], "MeshEdge", elems);
+            }
+        }
+    }
+    if (elems.size() < 2) {
+        return;
+    }
+
+    const std::vector<std::string> faceAtts =
+        attributeNameList(MeshFaceAttributes);
+    const std::vector<std::string> edgeAtts =
+        attributeNameList(MeshEdgeAttributes);
+    XMLCopier<char, XMLCh> faceTag("MeshFace");
+    XMLCopier<char, XMLCh> edgeTag("MeshEdge");
+    std::vector<DecodedContent> contents(elems.size());
+    ThreadPool::parallelFor(elems.size(), [&](size_t i) {
+        DOMElement *elem = elems[i];
+        DecodedContent &content = contents[i];
+        bool isFace = XMLString::equals(faceTag, elem->getTagName());
+        if (isFace || XMLString::equals(edgeTag, elem->getTagName())) {
+            content.atts = isFace ? faceAtts : edgeAtts;
+            content.result = decodeIndexContent(elem, content.atts,
+                content.value, content.indices);
+            return;
+        }
+        // Layout errors are left to parseParamVertexArray to report
+        int width;
+        bool swap;
+        MeshLinkCompression::Codec codec;
+        if (parseBinaryLayout(elem, "ParamVertexArray", width, swap, codec,
+                false)) {
+            decodeArrayContent(elem, codec, swap, content.bytes);
+            content.result = true;
+        }
+    });
+    for (size_t i = 0; i < elems.size(); ++i) {
+        decodedContent_[elems[i]] = std::move(contents[i]);
+    }
+}
+
+
+bool
+MeshLinkParserXerces::parseIndexNode(xercesc_3_2::DOMElement *node,
+    std::vector<std::string> &atts, std::string &value,
+    std::vector<MLINT> &indices)
+{
+    DecodedContentMap::iterator iter = decodedContent_.find(node);
+    if (decodedContent_.end() == iter ||
+            iter->second.atts.size() != atts.size()) {
+        return parseNode(node, atts, value, &indices);
+    }
+    DecodedContent &content = iter->second;
+    bool result = content.result;
+    atts.swap(content.atts);
+    value.swap(content.value);
+    indices.swap(content.indices);
+    decodedContent_.erase(iter);
+    return result;
+}
+
+
+bool
+MeshLinkParserXerces::takeDecodedBytes(xercesc_3_2::DOMElement *node,
+    std::vector<unsigned char> &bytes)
+{
+    DecodedContentMap::iterator iter = decodedContent_.find(node);
+    if (decodedContent_.end() == iter || !iter->second.result) {
         return false;
     }
-    else {
-        // Add to MeshFile
-        meshFile.addModelRef(ref);
+    bytes.swap(iter->second.bytes);
+    decodedContent_.erase(iter);
+    return true;
+}
+
 
-        // Parse MeshSheets
-        ParseMeshContainer(modelRef, MeshSheet);
-        ParseMeshContainer(modelRef, MeshSheetReference);
+// Parser for a MeshSheet or MeshString element of a MeshModelReference
+typedef bool (MeshLinkParserXerces::*pParseModelObj)(MeshModel *model,
+    xercesc_3_2::DOMElement *domElement);
 
-        // Parse MeshStrings
-        ParseMeshContainer(modelRef, MeshString);
-        ParseMeshContainer(modelRef, MeshStringReference);
+
+bool
+MeshLinkParserXerces::parseMeshObjects(MeshModel *meshModel,
+    xercesc_3_2::DOMElement *modelRef)
+{
+    static const pParseModelObj parseFuncs[NumMeshObjectKinds] = {
+        &MeshLinkParserXerces::parseMeshSheet,
+        &MeshLinkParserXerces::parseMeshSheetReference,
+        &MeshLinkParserXerces::parseMeshString,
+        &MeshLinkParserXerces::parseMeshStringReference
+    };
+
+    std::vector<DOMElement *> objs;
+    std::vector<size_t> kinds;
+    std::vector<size_t> ordinals;
+    getMeshObjects(modelRef, objs, kinds, ordinals);
+    for (size_t i = 0; i < objs.size(); ++i) {
+        if (!(this->*parseFuncs[kinds[i]])(meshModel, objs[i])) {
+            std::cout << "MeshModelReference node: problem "
+                "parsing " << MeshObjectTags[kinds[i]] << " " << ordinals[i] <<
+                std::endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+
+bool
+MeshLinkParserXerces::parseMeshRefModel(MeshFile &meshFile,
+    xercesc_3_2::DOMElement *modelRef)
+{
+    if (!meshAssociativity_) { return false; }
+
+    MeshModel *meshModel = createMeshModel(meshFile, modelRef);
+    bool result = (NULL != meshModel);
+
+    if (!result) {
+        return false;
+    }
+    else {
+        // Parse MeshSheets and MeshStrings
+        if (!parseMeshObjects(meshModel, modelRef)) {
+            return false;
+        }
 
         // Parse MeshPoints
 
@@ -1139,6 +1922,23 @@ MeshLinkParserXerces::parseMeshRefModel(MeshFile &meshFile,
             iter->release();
         }
 
+        // Param vertex arrays (direct children only, as above)
+        {
+            DOMNodeTagNameFilter attFilter("ParamVertexArray");
+            DOMNode *node;
+            DOMDocument *doc = modelRef->getOwnerDocument();
+            DOMNodeIterator *iter = doc->createNodeIterator(modelRef, DOMNodeFilter::SHOW_ELEMENT,
+                &attFilter, false);
+            while (result && (node = iter->nextNode()) != nullptr) {
+                if (node->getParentNode() != modelRef) {
+                    continue;
+                }
+                DOMElement *arrayNode = dynamic_cast<DOMElement*>(node);
+                result = parseParamVertexArray(meshModel, arrayNode);
+            }
+            iter->release();
+        }
+
         if (!result) {
             std::cout << "MeshModel: error parsing vertex." << std::endl;
             return false;
@@ -1146,16 +1946,7 @@ MeshLinkParserXerces::parseMeshRefModel(MeshFile &meshFile,
 
         ParseMeshContainerNoRecurse(modelRef, MeshPointReference);
 
-
-        if (result && verbose_level_ > 0) {
-            DOMAttr *attNode = modelRef->getAttributeNode(X("name"));
-            if (attNode) {
-                XMLCopier<XMLCh, char> val(attNode->getValue());
-                printf("MeshModel %s geometry associations:\n", (char *)val);
-            }
-            printf("%8" MLINT_FORMAT " mesh edges\n", meshModel->getNumEdges());
-            printf("%8" MLINT_FORMAT " mesh faces\n", meshModel->getNumFaces());
-        }
+        printMeshModelInfo(modelRef, meshModel);
     }
 
     return true;
@@ -1165,15 +1956,15 @@ MeshLinkParserXerces::parseMeshRefModel(MeshFile &meshFile,
 MeshLinkParserXerces::~MeshLinkParserXerces()
 {
     //clearMeshObjs();
+    releaseDocument();
 }
 
 
 bool
-MeshLinkParserXerces::parseMeshObject(MeshModel *model,
+MeshLinkParserXerces::parseMeshObjectAttributes(MeshModel *model,
     MeshTopo* meshTopo,
     xercesc_3_2::DOMElement *xmlObj,
-    const char *objName,
-    ParseMeshObjMap &parseMeshObjMap, bool &mapID)
+    bool &mapID)
 {
     if (NULL == meshTopo) { return false; }
     MeshString *meshString = dynamic_cast<MeshString *> (meshTopo);
@@ -1181,7 +1972,10 @@ MeshLinkParserXerces::parseMeshObject(MeshModel *model,
 
     mapID = false;
     if (xmlObj->hasAttribute(X("mid"))) {
-        meshTopo->setID( XMLString::parseInt(xmlObj->getAttribute(X("mid"))) );
+        if (!meshTopo->setID(
+                XMLString::parseInt(xmlObj->getAttribute(X("mid"))))) {
+            return false;
+        }
 
         if (meshString) {
             MeshString *existingString =
@@ -1237,10 +2031,16 @@ MeshLinkParserXerces::parseMeshObject(MeshModel *model,
         }
     }
     if (xmlObj->hasAttribute(X("gref"))) {
-        meshTopo->setGref(XMLString::parseInt(xmlObj->getAttribute(X("gref"))));
+        if (!meshTopo->setGref(
+                XMLString::parseInt(xmlObj->getAttribute(X("gref"))))) {
+            return false;
+        }
     }
     if (xmlObj->hasAttribute(X("aref"))) {
-        meshTopo->setAref(XMLString::parseInt(xmlObj->getAttribute(X("aref"))));
+        if (!meshTopo->setAref(
+                XMLString::parseInt(xmlObj->getAttribute(X("aref"))))) {
+            return false;
+        }
     }
 
 
@@ -1268,21 +2068,33 @@ MeshLinkParserXerces::parseMeshObject(MeshModel *model,
             }
         }
     }
+    return true;
+}
+
+
+bool
+MeshLinkParserXerces::parseMeshObject(MeshModel *model,
+    MeshTopo* meshTopo,
+    xercesc_3_2::DOMElement *xmlObj,
+    const char *objName,
+    ParseMeshObjMap &parseMeshObjMap, bool &mapID)
+{
+    if (!parseMeshObjectAttributes(model, meshTopo, xmlObj, mapID)) {
+        return false;
+    }
 
     bool result = true;
 
-    // Param vertices
-    {
-        DOMNodeTagNameFilter attFilter("ParamVertex");
-        DOMNode *node;
-        DOMDocument *doc = xmlObj->getOwnerDocument();
-        DOMNodeIterator *iter = doc->createNodeIterator(xmlObj, DOMNodeFilter::SHOW_ELEMENT,
-            &attFilter, false);
-        while (result && (node = iter->nextNode()) != nullptr) {
-            DOMElement *vertNode = dynamic_cast<DOMElement*>(node);
-            result = parseParamVertex(meshTopo, vertNode);
-        }
-        iter->release();
+    // Param vertices (read-only DOM traversal, see parseMeshObjects)
+    std::vector<DOMElement *> elems;
+    getElementsByTag(xmlObj, "ParamVertex", elems);
+    for (size_t i = 0; result && i < elems.size(); ++i) {
+        result = parseParamVertex(meshTopo, elems[i]);
+    }
+    elems.clear();
+    getElementsByTag(xmlObj, "ParamVertexArray", elems);
+    for (size_t i = 0; result && i < elems.size(); ++i) {
+        result = parseParamVertexArray(meshTopo, elems[i]);
     }
     if (!result) {
         std::cout << objName << ": error parsing vertex." << std::endl;
@@ -1296,18 +2108,11 @@ MeshLinkParserXerces::parseMeshObject(MeshModel *model,
              meshObjIter != parseMeshObjMap.end(); ++meshObjIter) {
         const char *meshObjName = meshObjIter->first;
         pParseMeshObj parseMeshObj = meshObjIter->second;
-        {
-            DOMNodeTagNameFilter attFilter(meshObjName);
-            DOMNode *node;
-            DOMDocument *doc = xmlObj->getOwnerDocument();
-            DOMNodeIterator *iter = doc->createNodeIterator(xmlObj, DOMNodeFilter::SHOW_ELEMENT,
-                &attFilter, false);
-            while (result && (node = iter->nextNode()) != nullptr) {
-                ++totalItems;
-                DOMElement *itemNode = dynamic_cast<DOMElement*>(node);
-                result = (this->*parseMeshObj)(model, meshTopo, itemNode);
-            }
-            iter->release();
+        elems.clear();
+        getElementsByTag(xmlObj, meshObjName, elems);
+        for (size_t i = 0; result && i < elems.size(); ++i) {
+            ++totalItems;
+            result = (this->*parseMeshObj)(model, meshTopo, elems[i]);
         }
         if (!result) {
             std::cout << objName << ": error parsing " << meshObjName << "." <<
@@ -1351,28 +2156,41 @@ MeshLinkParserXerces::parseMeshString(MeshModel *model,
     bool mapID = false;
 
     bool result = parseMeshObject(model, meshTopo, meshStringNode, "MeshString",
-        parseMap, mapID);
-
-    if (result) {
-        result = model->addMeshString(meshString, mapID);
-        if (!result) {
-            printf("MeshString: error storing\n   %s\n",
-                    (char*)meshStringNode->getNodeName());
-        }
-    }
+        parseMap, mapID) &&
+        storeMeshString(model, meshString, mapID);
 
     if (!result) {
         delete meshString;
         return result;
     }
 
+    return true;
+}
+
+
+bool
+MeshLinkParserXerces::storeMeshString(MeshModel *model,
+    MeshString *meshString, bool mapID)
+{
+    if (!model->addMeshString(meshString, mapID)) {
+        printf("MeshString: error storing\n   %s\n",
+                meshString->getName().c_str());
+        return false;
+    }
+
+    printMeshStringInfo(meshString);
+    return true;
+}
+
+
+void
+MeshLinkParserXerces::printMeshStringInfo(MeshString *meshString)
+{
     if (verbose_level_ > 0) {
         printf("MeshString %s geometry associations:\n", meshString->getName().c_str());
         printf("%8" MLINT_FORMAT " parametric vertices\n", meshString->getNumParamVerts());
         printf("%8" MLINT_FORMAT " mesh edges\n", meshString->getNumEdges());
     }
-
-    return true;
 }
 
 
@@ -1405,7 +2223,9 @@ MeshLinkParserXerces::parseMeshPointReference(MeshModel *model,
     attributeNames.push_back("name");
     std::vector<std::string> attrs = attributeNames;
     std::string value;
-    if (parseNode(meshPointNode, attrs, value)) {
+    // base64 content is decoded directly into indices
+    std::vector<MLINT> indices;
+    if (parseNode(meshPointNode, attrs, value, &indices)) {
 
         // Optional mid attribute
         int iattr = 0;
@@ -1423,7 +2243,7 @@ MeshLinkParserXerces::parseMeshPointReference(MeshModel *model,
         if (attrs[iattr] != "") {
             format = attrs[iattr];
         }
-        if ("text" != format) {
+        if ("text" != format && "base64" != format) {
             std::cout << "MeshPointReference: illegal format value: " <<
                 format << std::endl;
             return false;
@@ -1472,11 +2292,16 @@ MeshLinkParserXerces::parseMeshPointReference(MeshModel *model,
         }
 
         bool result = true;
-        if ("" != value && count > 0) {
-            std::istringstream is(value.c_str());
+        if (("" != value || !indices.empty()) && count > 0) {
+            TextScanner scan(value);
             std::string ref;
             for (int icnt = 0; icnt < count; ++icnt) {
-                is >> ref;
+                if (indices.empty()) {
+                    scan.nextToken(ref);
+                }
+                else {
+                    ref = std::to_string(indices[icnt]);
+                }
 
                 ParamVertex *pv1 = NULL;
                 // map parametric verts from parent
@@ -1556,27 +2381,40 @@ MeshLinkParserXerces::parseMeshSheet(MeshModel *model,
     bool mapID = false;
 
     bool result = parseMeshObject(model, meshTopo, meshSheetNode, "MeshSheet",
-        parseMap, mapID);
-    if (result) {
-        result = model->addMeshSheet(meshSheet);
-        if (!result) {
-            printf("MeshSheet: error storing\n  %s \n",
-                (char*)meshSheetNode->getNodeName());
-        }
-    }
+        parseMap, mapID) &&
+        storeMeshSheet(model, meshSheet);
     if (!result) {
         delete meshSheet;
         return result;
     }
 
+    return true;
+}
+
+
+bool
+MeshLinkParserXerces::storeMeshSheet(MeshModel *model, MeshSheet *meshSheet)
+{
+    if (!model->addMeshSheet(meshSheet)) {
+        printf("MeshSheet: error storing\n  %s \n",
+            meshSheet->getName().c_str());
+        return false;
+    }
+
+    printMeshSheetInfo(meshSheet);
+    return true;
+}
+
+
+void
+MeshLinkParserXerces::printMeshSheetInfo(MeshSheet *meshSheet)
+{
     if (verbose_level_ > 0) {
         printf("MeshSheet %s geometry associations:\n", meshSheet->getName().c_str());
         printf("%8" MLINT_FORMAT " parametric vertices\n", meshSheet->getNumParamVerts());
         printf("%8" MLINT_FORMAT " mesh edges\n", meshSheet->getNumFaceEdges());
         printf("%8" MLINT_FORMAT " mesh faces\n", meshSheet->getNumFaces());
     }
-
-    return true;
 }
 
 
@@ -1594,9 +2432,7 @@ MeshLinkParserXerces::parseParamVertex(MeshTopo *meshTopo,
         bool mapID = false;
         int mid = MESH_TOPO_INVALID_REF;
         if (attrs[0] != "") {
-            std::istringstream is(attrs[0]);
-            int mid;
-            is >> mid;
+            TextScanner(attrs[0]).next(mid);
             mapID = true;
         }
 
@@ -1613,11 +2449,13 @@ MeshLinkParserXerces::parseParamVertex(MeshTopo *meshTopo,
                 std::endl;
             return false;
         }
-        else {
-            gref = std::stoi(attrs[2]);
+        else if (!TextScanner(attrs[2]).next(gref)) {
+            std::cout << "ParamVertex: illegal gref value: " << attrs[2] <<
+                std::endl;
+            return false;
         }
 
-        int dim;
+        int dim = 0;
         if (attrs[3] == "") {
             std::cout << "ParamVertex: missing dim attribute." <<
                 std::endl;
@@ -1625,7 +2463,7 @@ MeshLinkParserXerces::parseParamVertex(MeshTopo *meshTopo,
         }
         else {
             // check dim
-            dim = std::stoi(attrs[3]);
+            TextScanner(attrs[3]).next(dim);
             if (dim < 1 || dim > 2) {
                 std::cout << "ParamVertex node: dim is bad " << dim <<
                     std::endl;
@@ -1635,16 +2473,11 @@ MeshLinkParserXerces::parseParamVertex(MeshTopo *meshTopo,
 
         // Element content is UV
         MLVector2D uv = {0.0, 0.0};
-        if (1 == dim) {
-            uv[0] = std::stod(value);
-        }
-        else {
-            std::istringstream points(value);
-            double val;
-            for (int ii = 0; ii < dim; ++ii) {
-                points >> val;
-                uv[ii] = val;
-            }
+        TextScanner scan(value);
+        if ((size_t)dim != scan.scanArray(uv, (size_t)dim)) {
+            std::cout << "ParamVertex: expected " << dim <<
+                " coordinate values." << std::endl;
+            return false;
         }
 
         ParamVertex *pv = new ParamVertex(vref,gref,mid,uv[0],uv[1]);
@@ -1660,30 +2493,113 @@ MeshLinkParserXerces::parseParamVertex(MeshTopo *meshTopo,
 }
 
 bool
-MeshLinkParserXerces::parseMeshFace(MeshModel *model,
-    MeshTopo* parentMeshTopo,
-    xercesc_3_2::DOMElement *faceArrayNode)
+MeshLinkParserXerces::parseParamVertexArray(MeshTopo *meshTopo,
+    xercesc_3_2::DOMElement *arrayNode)
 {
-    if (NULL == parentMeshTopo) { return false; }
-    MeshSheet* meshSheet =
-        dynamic_cast <MeshSheet*> (parentMeshTopo);
-
-    std::vector<std::string> attributeNames;
     // Required attributes
-    attributeNames.push_back("etype");
-    int numReqAttrs = (int)attributeNames.size();
+    if (!arrayNode->hasAttribute(X("count"))) {
+        std::cout << "ParamVertexArray: missing count attribute." <<
+            std::endl;
+        return false;
+    }
+    XMLCopier<XMLCh, char> countStr(arrayNode->getAttribute(X("count")));
+    size_t count;
+    if (!parseCount((char *)countStr, count)) {
+        std::cout << "ParamVertexArray: illegal count value: " <<
+            (char *)countStr << std::endl;
+        return false;
+    }
+    if (!arrayNode->hasAttribute(X("dim"))) {
+        std::cout << "ParamVertexArray: missing dim attribute." <<
+            std::endl;
+        return false;
+    }
+    int dim = XMLString::parseInt(arrayNode->getAttribute(X("dim")));
+    if (dim < 1 || dim > 2) {
+        std::cout << "ParamVertexArray node: dim is bad " << dim <<
+            std::endl;
+        return false;
+    }
 
     // Optional attributes
-    attributeNames.push_back("mid");
-    attributeNames.push_back("aref");
-    attributeNames.push_back("gref");
-    attributeNames.push_back("name");
-    attributeNames.push_back("format");
-    attributeNames.push_back("count");
-    std::vector<std::string> attrs = attributeNames;
-    std::string value;
-    bool triFace;
-    if (parseNode(faceArrayNode, attrs, value)) {
+    if (arrayNode->hasAttribute(X("format"))) {
+        XMLCopier<XMLCh, char> format(arrayNode->getAttribute(X("format")));
+        if (std::string("base64") != (char *)format) {
+            std::cout << "ParamVertexArray: illegal format value: " <<
+                (char *)format << std::endl;
+            return false;
+        }
+    }
+    bool hasMids = false;
+    if (arrayNode->hasAttribute(X("mids"))) {
+        XMLCopier<XMLCh, char> mids(arrayNode->getAttribute(X("mids")));
+        hasMids = (std::string("true") == (char *)mids ||
+            std::string("1") == (char *)mids);
+    }
+    int width;
+    bool swap;
+    MeshLinkCompression::Codec codec;
+    if (!parseBinaryLayout(arrayNode, "ParamVertexArray", width, swap,
+            codec)) {
+        return false;
+    }
+
+    // Content is the base64 packed arrays vref[count], gref[count],
+    // optional mid[count] as integers of the given width, then
+    // uv[count*dim] as doubles
+    std::vector<XMLByte> bytes;
+    if (!takeDecodedBytes(arrayNode, bytes)) {
+        decodeArrayContent(arrayNode, codec, swap, bytes);
+    }
+    size_t numInts = hasMids ? 3 : 2;
+    size_t intBytes = count * numInts * (width / 8);
+    size_t uvBytes = count * dim * sizeof(double);
+    if (bytes.size() < intBytes + uvBytes) {
+        std::cout << "ParamVertexArray: too few values for count " <<
+            count << std::endl;
+        return false;
+    }
+
+    // vref, gref and mid arrays unpacked together
+    std::vector<MLINT> ints(count * numInts);
+    unpackInts(bytes.data(), ints.size(), width, swap, ints.data());
+    const MLINT *vrefs = ints.data();
+    const MLINT *grefs = vrefs + count;
+    const MLINT *mids = hasMids ? grefs + count : NULL;
+    XMLByte *uvs = bytes.data() + intBytes;
+    if (swap) {
+        swapBytes(uvs, sizeof(double), count * dim);
+    }
+    MLVector2D uv = {0.0, 0.0};
+    for (size_t i = 0; i < count; ++i) {
+        MLINT mid = mids ? mids[i] : MESH_TOPO_INVALID_REF;
+        memcpy(uv, uvs + i * dim * sizeof(double), dim * sizeof(double));
+
+        ParamVertex *pv = new ParamVertex(std::to_string(vrefs[i]), grefs[i],
+            mid, uv[0], uv[1]);
+        meshTopo->addParamVertex(pv, MESH_TOPO_INVALID_REF != mid);
+    }
+    return true;
+}
+
+bool
+MeshLinkParserXerces::parseMeshFace(MeshModel *model,
+    MeshTopo* parentMeshTopo,
+    xercesc_3_2::DOMElement *faceArrayNode)
+{
+    if (NULL == parentMeshTopo) { return false; }
+
+    const std::vector<std::string> attributeNames =
+        attributeNameList(MeshFaceAttributes);
+    // Required attributes
+    int numReqAttrs = 1;
+
+    std::vector<std::string> attrs = attributeNames;
+    std::string value;
+    // base64 content is decoded directly into indices
+    std::vector<MLINT> indices;
+    bool triFace;
+    if (parseIndexNode(faceArrayNode, attrs, value, indices)) {
         int n;
         int iattr = 0;
         // First numReqAttrs are required
@@ -1711,7 +2627,7 @@ MeshLinkParserXerces::parseMeshFace(MeshModel *model,
 
         // Optional mid attribute
         ++iattr;
-        int mid = MESH_TOPO_INVALID_REF;
+        MLINT mid = MESH_TOPO_INVALID_REF;
         bool mapID = false;
         if (attrs[iattr] != "") {
             std::istringstream is(attrs[iattr]);
@@ -1721,7 +2637,7 @@ MeshLinkParserXerces::parseMeshFace(MeshModel *model,
 
         // Optional aref attribute
         ++iattr;
-        int aref = MESH_TOPO_INVALID_REF;
+        MLINT aref = MESH_TOPO_INVALID_REF;
         if (attrs[iattr] != "") {
             std::istringstream is(attrs[iattr]);
             is >> aref;
@@ -1729,7 +2645,7 @@ MeshLinkParserXerces::parseMeshFace(MeshModel *model,
 
         // Optional gref attribute
         ++iattr;
-        int gref = (int)parentMeshTopo->getGref();  // default is parent's Gref
+        MLINT gref = parentMeshTopo->getGref();  // default is parent's Gref
         if (attrs[iattr] != "") {
             std::istringstream is(attrs[iattr]);
             is >> gref;
@@ -1753,122 +2669,28 @@ MeshLinkParserXerces::parseMeshFace(MeshModel *model,
 
         // Optional count attribute
         ++iattr;
-        int count = 1;
-        if (attrs[iattr] != "") {
-            std::istringstream isCount(attrs[iattr]);
-            isCount >> count;
-            if (count <= 0 || count > 1e12) {
-                std::cout << "MeshFace: illegal format value: " <<
-                    format << std::endl;
-                return false;
-            }
+        size_t count = 1;
+        if (attrs[iattr] != "" && !parseCount(attrs[iattr], count)) {
+            std::cout << "MeshFace: illegal count value: " <<
+                attrs[iattr] << std::endl;
+            return false;
         }
 
-        if ("" != value && count > 0) {
-            std::istringstream is(value.c_str());
-            MLINT i1, i2, i3, i4;
-            ParamVertex *pv1, *pv2, *pv3, *pv4;
-            for (int icnt = 0; icnt < count; ++icnt) {
-                if (triFace) {
-                    // 1 group of 3
-                    is >> i1 >> i2 >> i3;
-                    // Map parametric verts from parent
-                    pv1 = parentMeshTopo->getParamVertByVref(std::to_string(i1));
-                    pv2 = parentMeshTopo->getParamVertByVref(std::to_string(i2));
-                    pv3 = parentMeshTopo->getParamVertByVref(std::to_string(i3));
-                    model->addFaceEdge(i1, i2, mid, aref, gref, pv1, pv2);
-                    model->addFaceEdge(i2, i3, mid, aref, gref, pv2, pv3);
-                    model->addFaceEdge(i3, i1, mid, aref, gref, pv3, pv1);
-
-                    model->addFaceEdgePoint(i1, mid, aref, gref, pv1);
-                    model->addFaceEdgePoint(i2, mid, aref, gref, pv2);
-                    model->addFaceEdgePoint(i3, mid, aref, gref, pv3);
-
-                    // Record map from mesh face indices to geometry group ID
-                    bool result = model->addFace(i1, i2, i3,
-                        mid, aref, gref, name, pv1, pv2, pv3, mapID);
-                    if (!result) {
-                        printf("MeshFace: error storing\n   %s\n",
-                            (char*)faceArrayNode->getNodeName());
-                    }
-
-                    if (meshSheet) {
-                        meshSheet->addFaceEdge(i1, i2, mid, aref, gref, pv1, pv2);
-                        meshSheet->addFaceEdge(i2, i3, mid, aref, gref, pv2, pv3);
-                        meshSheet->addFaceEdge(i3, i1, mid, aref, gref, pv3, pv1);
-                        bool result = meshSheet->addFace(i1, i2, i3,
-                            mid, aref, gref, name, pv1, pv2, pv3, mapID);
-                        if (!result) {
-                            printf("MeshFace: error storing\n   %s\n",
-                                (char*)faceArrayNode->getNodeName());
-                        }
-                    }
-
-#if DEBUG
-                    MeshFace *face = model->findFaceByInds(i1, i2, i3);
-                    ML_assert(nullptr != face);
-                    face = meshSheet->findFaceByInds(i1, i2, i3);
-                    ML_assert(nullptr != face);
-#endif
-
-                }
-                else if (!triFace) {
-                    // 1 group of 4
-                    is >> i1 >> i2 >> i3 >> i4;
-
-                    // Map parametric verts from parent
-                    pv1 = parentMeshTopo->getParamVertByVref(std::to_string(i1));
-                    pv2 = parentMeshTopo->getParamVertByVref(std::to_string(i2));
-                    pv3 = parentMeshTopo->getParamVertByVref(std::to_string(i3));
-                    pv4 = parentMeshTopo->getParamVertByVref(std::to_string(i4));
-
-                    if (model) {
-                        model->addFaceEdge(i1, i2, mid, aref, gref, pv1, pv2);
-                        model->addFaceEdge(i2, i3, mid, aref, gref, pv2, pv3);
-                        model->addFaceEdge(i3, i4, mid, aref, gref, pv3, pv4);
-                        model->addFaceEdge(i4, i1, mid, aref, gref, pv4, pv1);
-
-                        model->addFaceEdgePoint(i1, mid, aref, gref, pv1);
-                        model->addFaceEdgePoint(i2, mid, aref, gref, pv2);
-                        model->addFaceEdgePoint(i3, mid, aref, gref, pv3);
-                        model->addFaceEdgePoint(i4, mid, aref, gref, pv4);
-
-                        // record map from mesh face indices to geometry group ID
-                        bool result = model->addFace(i1, i2, i3, i4,
-                            mid, aref, gref, name, pv1, pv2, pv3, pv4, mapID);
-                        if (!result) {
-                            printf("MeshFace: error storing\n   %s\n",
-                                (char*)faceArrayNode->getNodeName());
-                        }
-                    }
-
-                    if (meshSheet) {
-                        meshSheet->addFaceEdge(i1, i2, mid, aref, gref, pv1, pv2);
-                        meshSheet->addFaceEdge(i2, i3, mid, aref, gref, pv2, pv3);
-                        meshSheet->addFaceEdge(i3, i4, mid, aref, gref, pv3, pv4);
-                        meshSheet->addFaceEdge(i4, i1, mid, aref, gref, pv4, pv1);
-                        bool result = meshSheet->addFace(i1, i2, i3, i4,
-                            mid, aref, gref, name, pv1, pv2, pv3, pv4, mapID);
-                        if (!result) {
-                            printf("MeshFace: error storing\n   %s\n",
-                                (char*)faceArrayNode->getNodeName());
-                        }
-                    }
-
-#if DEBUG
-                    MeshFace *face = model->findFaceByInds(i1, i2, i3, i4);
-                    ML_assert(nullptr != face);
-                    face = meshSheet->findFaceByInds(i1, i2, i3, i4);
-                    ML_assert(nullptr != face);
-#endif
-
-                }
-                else {
-                    std::cout << "MeshFace: illegal etype value: " <<
-                        etype << std::endl;
-                    return false;
-                }
+        size_t numInds = count * (triFace ? 3 : 4);
+        if ("text" == format && "" != value) {
+            // Each index takes at least one digit and a separator
+            TextScanner scan(value);
+            indices.reserve(std::min(numInds, value.size() / 2 + 1));
+            scan.scanArray(indices, numInds);
+        }
+        if (!indices.empty()) {
+            if (indices.size() < numInds) {
+                std::cout << "MeshFace: fewer indices than count " <<
+                    count << std::endl;
+                return false;
             }
+            addMeshFaces(model, parentMeshTopo, indices.data(), count, triFace,
+                mid, aref, gref, name, mapID);
         }
     }
     else {
@@ -1879,6 +2701,31 @@ MeshLinkParserXerces::parseMeshFace(MeshModel *model,
     return true;
 }
 
+
+void
+MeshLinkParserXerces::addMeshFaces(MeshModel *model, MeshTopo *parentMeshTopo,
+    const MLINT *indices, size_t count, bool triFace,
+    MLINT mid, MLINT aref, MLINT gref, std::string &name, bool mapID)
+{
+    MeshSheet* meshSheet =
+        dynamic_cast <MeshSheet*> (parentMeshTopo);
+    int pointsPerFace = triFace ? 3 : 4;
+    std::vector<ParamVertex *> paramVerts;
+    getParamVertsByIndex(parentMeshTopo, indices, count * pointsPerFace,
+        paramVerts);
+    ParamVertex *const *pvs = paramVerts.empty() ? NULL : paramVerts.data();
+
+    if (!model->addFaces(indices, count, pointsPerFace,
+            mid, aref, gref, name, pvs, mapID)) {
+        printf("MeshFace: error storing faces in MeshModel\n");
+    }
+    if (meshSheet && !meshSheet->addFaces(indices, count, pointsPerFace,
+            mid, aref, gref, name, pvs, mapID)) {
+        printf("MeshFace: error storing faces in MeshSheet %s\n",
+            meshSheet->getName().c_str());
+    }
+}
+
 bool
 MeshLinkParserXerces::parseMeshFaceReference(MeshModel *model,
     MeshTopo* parentMeshTopo,
@@ -1997,10 +2844,10 @@ MeshLinkParserXerces::parseMeshFaceReference(MeshModel *model,
         ParamVertex *pv4 = NULL;
 
         if ("" != value && count > 0) {
-            std::istringstream is(value.c_str());
+            TextScanner scan(value);
             std::string ref;
             for (int icnt = 0; icnt < count; ++icnt) {
-                is >> ref;
+                scan.nextToken(ref);
 
                 // Record map from mesh face indices to geometry group ID
                 bool result = model->addFace(ref,
@@ -2047,24 +2894,17 @@ MeshLinkParserXerces::parseMeshEdge(MeshModel *model,
     xercesc_3_2::DOMElement *edgeNode)
 {
     if (NULL == parentMeshTopo) { return false; }
-    MeshString* meshString =
-        dynamic_cast <MeshString*> (parentMeshTopo);
 
-    std::vector<std::string> attributeNames;
+    const std::vector<std::string> attributeNames =
+        attributeNameList(MeshEdgeAttributes);
     // Required attributes
-    attributeNames.push_back("etype");
-    int numReqAttrs = (int)attributeNames.size();
+    int numReqAttrs = 1;
 
-    // Optional attributes
-    attributeNames.push_back("mid");
-    attributeNames.push_back("format");
-    attributeNames.push_back("count");
-    attributeNames.push_back("aref");
-    attributeNames.push_back("gref");
-    attributeNames.push_back("name");
     std::vector<std::string> attrs = attributeNames;
     std::string value;
-    if (parseNode(edgeNode, attrs, value)) {
+    // base64 content is decoded directly into indices
+    std::vector<MLINT> indices;
+    if (parseIndexNode(edgeNode, attrs, value, indices)) {
         int n;
         int iattr = 0;
         // First numReqAttrs are required
@@ -2085,7 +2925,7 @@ MeshLinkParserXerces::parseMeshEdge(MeshModel *model,
 
         // Optional mid attribute
         ++iattr;
-        int mid = MESH_TOPO_INVALID_REF;
+        MLINT mid = MESH_TOPO_INVALID_REF;
         bool mapID = false;
         if (attrs[iattr] != "") {
             std::istringstream is(attrs[iattr]);
@@ -2099,7 +2939,7 @@ MeshLinkParserXerces::parseMeshEdge(MeshModel *model,
         if (attrs[iattr] != "") {
             format = attrs[iattr];
         }
-        if ("text" != format) {
+        if ("text" != format && "base64" != format) {
             std::cout << "MeshEdge: illegal format value: " <<
                 format << std::endl;
             return false;
@@ -2107,20 +2947,16 @@ MeshLinkParserXerces::parseMeshEdge(MeshModel *model,
 
         // Optional count attribute
         ++iattr;
-        int count = 1;
-        if (attrs[iattr] != "") {
-            std::istringstream isCount(attrs[iattr]);
-            isCount >> count;
-            if (count <= 0 || count > 1e12) {
-                std::cout << "MeshEdge: illegal count value: " <<
-                    count << std::endl;
-                return false;
-            }
+        size_t count = 1;
+        if (attrs[iattr] != "" && !parseCount(attrs[iattr], count)) {
+            std::cout << "MeshEdge: illegal count value: " <<
+                attrs[iattr] << std::endl;
+            return false;
         }
 
         // Optional aref attribute
         ++iattr;
-        int aref = MESH_TOPO_INVALID_REF;
+        MLINT aref = MESH_TOPO_INVALID_REF;
         if (attrs[iattr] != "") {
             std::istringstream is(attrs[iattr]);
             is >> aref;
@@ -2128,7 +2964,7 @@ MeshLinkParserXerces::parseMeshEdge(MeshModel *model,
 
         // Optional gref attribute
         ++iattr;
-        int gref = (int)parentMeshTopo->getGref();  // default to parent's Gref
+        MLINT gref = parentMeshTopo->getGref();  // default to parent's Gref
         if (attrs[iattr] != "") {
             std::istringstream is(attrs[iattr]);
             is >> gref;
@@ -2138,52 +2974,21 @@ MeshLinkParserXerces::parseMeshEdge(MeshModel *model,
         ++iattr;
         std::string name = attrs[iattr];
 
-        if ("" != value && count > 0) {
-            std::istringstream is(value.c_str());
-            MLINT i1, i2;
-            for (int icnt = 0; icnt < count; ++icnt) {
-                // 1 group of 2
-                is >> i1 >> i2;
-
-                // Map parametric verts from parent
-                ParamVertex *pv1,*pv2;
-                pv1 = parentMeshTopo->getParamVertByVref(std::to_string(i1));
-                pv2 = parentMeshTopo->getParamVertByVref(std::to_string(i2));
-
-                model->addEdgePoint(i1, mid, aref, gref, pv1);
-                model->addEdgePoint(i2, mid, aref, gref, pv2);
-
-                bool result = model->addEdge(i1, i2,
-                    mid,
-                    aref,
-                    gref,
-                    name,
-                    pv1,pv2, mapID);
-                if (!result) {
-                    printf("MeshEdge: error storing\n   %s\n",
-                        (char*)edgeNode->getNodeName());
-                }
-
-                if (meshString) {
-                    bool results = meshString->addEdge(i1, i2,
-                        mid,
-                        aref,
-                        gref,
-                        name,
-                        pv1, pv2, mapID);
-                    if (!result) {
-                        printf("MeshEdge: error storing\n   %s\n",
-                            (char*)edgeNode->getNodeName());
-                    }
-                }
-#if DEBUG
-                MeshEdge *edge = model->findEdgeByInds(i1, i2);
-                ML_assert(nullptr != edge);
-                edge = meshString->findEdgeByInds(i1, i2);
-                ML_assert(nullptr != edge);
-#endif
-
+        size_t numInds = count * 2;
+        if ("text" == format && "" != value) {
+            // Each index takes at least one digit and a separator
+            TextScanner scan(value);
+            indices.reserve(std::min(numInds, value.size() / 2 + 1));
+            scan.scanArray(indices, numInds);
+        }
+        if (!indices.empty()) {
+            if (indices.size() < numInds) {
+                std::cout << "MeshEdge: fewer indices than count " <<
+                    count << std::endl;
+                return false;
             }
+            addMeshEdges(model, parentMeshTopo, indices.data(), count,
+                mid, aref, gref, name, mapID);
         }
     }
     else {
@@ -2194,6 +2999,27 @@ MeshLinkParserXerces::parseMeshEdge(MeshModel *model,
     return true;
 }
 
+void
+MeshLinkParserXerces::addMeshEdges(MeshModel *model, MeshTopo *parentMeshTopo,
+    const MLINT *indices, size_t count,
+    MLINT mid, MLINT aref, MLINT gref, std::string &name, bool mapID)
+{
+    MeshString* meshString =
+        dynamic_cast <MeshString*> (parentMeshTopo);
+    std::vector<ParamVertex *> paramVerts;
+    getParamVertsByIndex(parentMeshTopo, indices, 2 * count, paramVerts);
+    ParamVertex *const *pvs = paramVerts.empty() ? NULL : paramVerts.data();
+
+    if (!model->addEdges(indices, count, mid, aref, gref, name, pvs, mapID)) {
+        printf("MeshEdge: error storing edges in MeshModel\n");
+    }
+    if (meshString && !meshString->addEdges(indices, count,
+            mid, aref, gref, name, pvs, mapID)) {
+        printf("MeshEdge: error storing edges in MeshString %s\n",
+            meshString->getName().c_str());
+    }
+}
+
 bool
 MeshLinkParserXerces::parseMeshEdgeReference(MeshModel *model,
     MeshTopo* parentMeshTopo,
@@ -2303,10 +3129,10 @@ MeshLinkParserXerces::parseMeshEdgeReference(MeshModel *model,
         }
 
         if ("" != value && count > 0) {
-            std::istringstream is(value.c_str());
+            TextScanner scan(value);
             std::string ref;
             for (int icnt = 0; icnt < count; ++icnt) {
-                is >> ref;
+                scan.nextToken(ref);
 
                 bool result = model->addEdge(
                     ref,
@@ -2357,28 +3183,143 @@ bool
 MeshLinkParserXerces::parseMeshLinkFile(
     std::string fname,
     MeshAssociativity *meshAssociativity)
+{
+    if (MeshLinkBinary::isBinaryFile(fname)) {
+        MeshLinkMappedFile file;
+        if (!file.map(fname, true)) {
+            std::cout << "Unable to map " << fname << std::endl;
+            return false;
+        }
+        return parseMeshLinkBinary(file.data(), file.length(),
+            meshAssociativity);
+    }
+#ifdef HAVE_ZLIB
+    {
+        std::vector<char> data;
+        bool readError;
+        if (readGzipBinary(fname, data, readError)) {
+            return !readError &&
+                parseMeshLinkBinary(data.data(), data.size(), meshAssociativity);
+        }
+    }
+#endif
+    MeshLinkInput input;
+    input.fname = fname;
+    return parseMeshLinkInput(input, meshAssociativity);
+}
+
+
+// Read MeshLink document from memory
+bool
+MeshLinkParserXerces::parseMeshLinkBuffer(
+    const char *buffer,
+    size_t length,
+    MeshAssociativity *meshAssociativity)
+{
+    if (nullptr == buffer) { return false; }
+    if (MeshLinkBinary::isBinary(buffer, length)) {
+        return parseMeshLinkBinary(buffer, length, meshAssociativity);
+    }
+    MeshLinkInput input;
+    input.fname = "MeshLinkBuffer";
+    input.buffer = buffer;
+    input.length = length;
+    return parseMeshLinkInput(input, meshAssociativity);
+}
+
+
+// A MeshLink document read into a Xerces DOM model. The platform
+// session is held for as long as the document
+struct MeshLinkParserXerces::LoadedDocument {
+    LoadedDocument() : parser(nullptr), errHandler(nullptr) {}
+    ~LoadedDocument() {
+        delete parser;
+        delete errHandler;
+    }
+
+    XercesPlatformSession session;
+    XercesDOMParser *parser;
+    SAXErrorHandler *errHandler;
+};
+
+
+// Read MeshLink document from a file or memory
+bool
+MeshLinkParserXerces::parseMeshLinkInput(
+    const MeshLinkInput &input,
+    MeshAssociativity *meshAssociativity)
 {
     if (!meshAssociativity) { return false; }
-    meshAssociativity_ = meshAssociativity;
-    bool result = true;
-    try {
-        XMLPlatformUtils::Initialize();
-        std::cout << "Successfully initialized xerces API." << std::endl;
+    bool result = loadDocument(input) && buildDocument(meshAssociativity);
+    releaseDocument();
+    return result;
+}
+
+
+// Read a MeshLink XML file ahead of populating an associativity from it
+bool
+MeshLinkParserXerces::loadMeshLinkFile(const std::string &fname,
+    bool &loaded)
+{
+    loaded = false;
+    if (MeshLinkBinary::isBinaryFile(fname)) {
+        return true;
+    }
+#ifdef HAVE_ZLIB
+    if (isGzipBinaryFile(fname)) {
+        return true;
+    }
+#endif
+    MeshLinkInput input;
+    input.fname = fname;
+    loaded = loadDocument(input);
+    return loaded;
+}
+
+
+// Read MeshLink document into a DOM model
+bool
+MeshLinkParserXerces::loadDocument(const MeshLinkInput &input)
+{
+    releaseDocument();
+    document_ = new LoadedDocument();
+    if (!document_->session) {
+        releaseDocument();
+        return false;
     }
-    catch (const XMLException &) {
-        std::cout << "Failed to initialize xerces API." << std::endl;
+
+    XMLGrammarPool *grammarPool = nullptr;
+    if (validateOnParse_ && !schemaName_.empty() &&
+            nullptr == (grammarPool = getSchemaGrammarPool(schemaName_))) {
+        releaseDocument();
         return false;
     }
 
-    XercesDOMParser *parser = new XercesDOMParser();
+    bool result = true;
+    XercesDOMParser *parser = new XercesDOMParser(nullptr,
+        XMLPlatformUtils::fgMemoryManager, grammarPool);
     SAXErrorHandler* errHandler(new SAXErrorHandler());
     parser->setErrorHandler(errHandler);
+    document_->parser = parser;
+    document_->errHandler = errHandler;
 
     try {
         parser->setValidationSchemaFullChecking(false);
         parser->setDoNamespaces(true);
-        parser->parse(fname.c_str());
+        if (validateOnParse_) {
+            parser->setValidationScheme(XercesDOMParser::Val_Always);
+            parser->setDoSchema(true);
+            parser->useCachedGrammarInParse(nullptr != grammarPool);
+        }
+        MeshLinkInputSource source(input.fname.c_str(), input.buffer,
+            input.length, mapInputFiles_);
+        parser->parse(source);
         errHandler->outputCounts();
+        if (validateOnParse_ && 0 < errHandler->getErrorCount()) {
+            std::cout << "MeshLink document does not conform to the schema." <<
+                std::endl;
+            result = false;
+        }
     }
     catch (const XMLException &toCatch) {
         char *msg = XMLString::transcode(toCatch.getMessage());
@@ -2393,101 +3334,1099 @@ MeshLinkParserXerces::parseMeshLinkFile(
         result = false;
     }
 
-    if (result) {
-        DOMDocument *doc;
-        DOMElement *meshLinkRoot;
-        if (nullptr == (doc = parser->getDocument())) {
-            std::cout << "Mesh Link document was not created from XML file." <<
-                std::endl;
-            XMLPlatformUtils::Terminate();
-            result = false;
-            return result;
-        }
+    if (!result) {
+        releaseDocument();
+    }
+    return result;
+}
 
-        if (nullptr == (meshLinkRoot = doc->getDocumentElement())) {
-            std::cout << "Mesh Link root element not found." << std::endl;
-            XMLPlatformUtils::Terminate();
-            result = false;
-            return result;
-        }
 
-        // Attribute and AttributeGroup elements
-        parseAttributes(meshLinkRoot);
+void
+MeshLinkParserXerces::releaseDocument()
+{
+    decodedContent_.clear();
+    delete document_;
+    document_ = NULL;
+}
+
+
+// Populate MeshAssociativity from the DOM model read by loadDocument
+bool
+MeshLinkParserXerces::buildDocument(MeshAssociativity *meshAssociativity)
+{
+    if (!meshAssociativity || NULL == document_) { return false; }
+    meshAssociativity_ = meshAssociativity;
+    DOMDocument *doc;
+    DOMElement *meshLinkRoot;
+    if (nullptr == (doc = document_->parser->getDocument())) {
+        std::cout << "Mesh Link document was not created from XML file." <<
+            std::endl;
+        return false;
+    }
+
+    if (nullptr == (meshLinkRoot = doc->getDocumentElement())) {
+        std::cout << "Mesh Link root element not found." << std::endl;
+        return false;
+    }
 
-        // GeometryFile, GeometryReference and GeometryGroup elements
-        parseGeometryRefs(meshLinkRoot);
+    // Attribute and AttributeGroup elements
+    parseAttributes(meshLinkRoot);
 
-        // MeshFile elements
+    // GeometryFile, GeometryReference and GeometryGroup elements
+    parseGeometryRefs(meshLinkRoot);
 
-        // Parse MeshFiles - multiple ModelReferences each containing
-        // multiple MeshSheets, each containing multiple ParamVertices
-        // (points) and one MeshFaceArray
-        result = true;
+    // Face, edge and vertex arrays are decoded concurrently. The entities
+    // are then created in document order, so unnamed ones are named the
+    // same way on every read.
+    decodeContent(meshLinkRoot);
 
-        XMLSize_t count = 0;
-        {
-            DOMNodeTagNameFilter attFilter("MeshFile");
-            DOMDocument *doc = meshLinkRoot->getOwnerDocument();
-            DOMNode *node;
-            DOMNodeIterator *iter = doc->createNodeIterator(meshLinkRoot, DOMNodeFilter::SHOW_ELEMENT,
-                &attFilter, false);
-            DOMElement *meshFile;
-            while ((node = iter->nextNode()) != nullptr) {
-                ++count;
-                if (nullptr != node &&
-                    DOMNode::ELEMENT_NODE == node->getNodeType()) {
-                    meshFile = dynamic_cast<DOMElement*>(node);
-                    result = parseMeshFile(meshFile);
-                }
+    // MeshFile elements
+
+    // Parse MeshFiles - multiple ModelReferences each containing
+    // multiple MeshSheets, each containing multiple ParamVertices
+    // (points) and one MeshFaceArray
+    bool result = true;
+
+    XMLSize_t count = 0;
+    {
+        DOMNodeTagNameFilter attFilter("MeshFile");
+        DOMDocument *doc = meshLinkRoot->getOwnerDocument();
+        DOMNode *node;
+        DOMNodeIterator *iter = doc->createNodeIterator(meshLinkRoot, DOMNodeFilter::SHOW_ELEMENT,
+            &attFilter, false);
+        DOMElement *meshFile;
+        while ((node = iter->nextNode()) != nullptr) {
+            ++count;
+            if (nullptr != node &&
+                DOMNode::ELEMENT_NODE == node->getNodeType()) {
+                meshFile = dynamic_cast<DOMElement*>(node);
+                result = parseMeshFile(meshFile);
             }
-            iter->release();
         }
+        iter->release();
+    }
 
-        if (!result || 0 == count) {
-            std::cout << "Mesh Link File element(s) not found." << std::endl;
-            XMLPlatformUtils::Terminate();
-            return result;
-        }
-
-
-        // Transform and MeshElementLinkage elements
-        parsePeriodicInfo(meshLinkRoot);
-
-
-        // Cached items for later use if/when writing out Xml file based
-        // on parsed/modified Meshassociativity.
-        XMLCopier<XMLCh, char> uri = doc->getDocumentURI();
-        DOMNode *node = doc->getFirstChild();
-        DOMNamedNodeMap *atts = node->getAttributes();
-        if (nullptr != atts) {
-            XMLSize_t size = atts->getLength();
-            if (size > 3) {
-                // Version
-                DOMNode *attNode = atts->getNamedItem(X("version"));
-                xmlVersion_ = Char(attNode->getNodeValue());
-                // Xml Namespace
-                attNode = atts->getNamedItem(X("xmlns"));
-                xmlns_ = Char(attNode->getNodeValue());
-                // Xml Namespace schema instance
-                attNode = atts->getNamedItem(X("xmlns:xsi"));
-                xmlns_xsi_ = Char(attNode->getNodeValue());
-                // Xml schema location
-                attNode = atts->getNamedItem(X("xsi:schemaLocation"));
-                schemaLocation_ = Char(attNode->getNodeValue());
-            }
+    if (!result || 0 == count) {
+        std::cout << "Mesh Link File element(s) not found." << std::endl;
+        return result;
+    }
+
+
+    // Transform and MeshElementLinkage elements
+    parsePeriodicInfo(meshLinkRoot);
+
+
+    // Cached items for later use if/when writing out Xml file based
+    // on parsed/modified Meshassociativity.
+    XMLCopier<XMLCh, char> uri = doc->getDocumentURI();
+    DOMNode *node = doc->getFirstChild();
+    DOMNamedNodeMap *atts = node->getAttributes();
+    if (nullptr != atts) {
+        XMLSize_t size = atts->getLength();
+        if (size > 3) {
+            // Version
+            DOMNode *attNode = atts->getNamedItem(X("version"));
+            xmlVersion_ = Char(attNode->getNodeValue());
+            // Xml Namespace
+            attNode = atts->getNamedItem(X("xmlns"));
+            xmlns_ = Char(attNode->getNodeValue());
+            // Xml Namespace schema instance
+            attNode = atts->getNamedItem(X("xmlns:xsi"));
+            xmlns_xsi_ = Char(attNode->getNodeValue());
+            // Xml schema location
+            attNode = atts->getNamedItem(X("xsi:schemaLocation"));
+            schemaLocation_ = Char(attNode->getNodeValue());
         }
     }
 
-    delete parser;
-    delete errHandler;
+    if (result && reorderEntities_) {
+        meshAssociativity_->reorderEntities();
+    }
 
-    try {
-        XMLPlatformUtils::Terminate();
-        std::cout << "Successfully terminated xerces API." << std::endl;
+    return result;
+}
+
+
+// Read several MeshLink files, concurrently where possible, and merge them
+// in order
+bool
+MeshLinkParserXerces::parseMeshLinkFiles(
+    const std::vector<std::string> &fnames,
+    MeshAssociativity *meshAssociativity,
+    bool offsetPointIndices)
+{
+    if (!meshAssociativity) { return false; }
+    const size_t numFiles = fnames.size();
+    if (0 == numFiles) { return true; }
+
+    std::vector<MeshLinkParserXerces *> parsers(numFiles, nullptr);
+    for (size_t i = 0; i < numFiles; ++i) {
+        parsers[i] = createParser();
+        parsers[i]->setVerboseLevel(verbose_level_);
+        parsers[i]->setMapInputFiles(mapInputFiles_);
+        parsers[i]->setValidateOnParse(validateOnParse_, schemaName_);
+        parsers[i]->modelFilter_ = modelFilter_;
+        parsers[i]->sheetFilter_ = sheetFilter_;
+        parsers[i]->stringFilter_ = stringFilter_;
     }
-    catch (const XMLException &) {
-        std::cout << "Failed to terminate xerces API." << std::endl;
-        return false;
+
+    // The documents of a round of files are read concurrently. The files
+    // are then populated and merged sequentially in file order, so the
+    // result and the names given to unnamed entities are deterministic.
+    // A round holds no more documents in memory than there are threads.
+    const size_t roundSize = ThreadPool::getConcurrency();
+    bool result = true;
+    for (size_t first = 0; first < numFiles; first += roundSize) {
+        size_t count = std::min(roundSize, numFiles - first);
+        std::vector<char> read(count, 0);
+        std::vector<char> loaded(count, 0);
+        ThreadPool::parallelFor(count, [&](size_t i) {
+            bool isLoaded = false;
+            read[i] = parsers[first + i]->loadMeshLinkFile(fnames[first + i],
+                isLoaded);
+            loaded[i] = isLoaded;
+        });
+
+        for (size_t i = 0; i < count; ++i) {
+            MeshLinkParserXerces *parser = parsers[first + i];
+            const std::string &fname = fnames[first + i];
+            MeshAssociativity fileAssoc;
+            bool parsed = read[i] && (loaded[i] ?
+                parser->buildDocument(&fileAssoc) :
+                parser->parseMeshLinkFile(fname, &fileAssoc));
+            parser->releaseDocument();
+            if (!parsed) {
+                std::cout << "Failed to parse MeshLink file: " << fname <<
+                    std::endl;
+                result = false;
+                continue;
+            }
+            MLINT offset = 0;
+            MLINT destMin, destMax, srcMin, srcMax;
+            if (offsetPointIndices &&
+                meshAssociativity->getPointIndexRange(&destMin, &destMax) &&
+                fileAssoc.getPointIndexRange(&srcMin, &srcMax)) {
+                offset = destMax + 1 - srcMin;
+            }
+            if (!meshAssociativity->merge(fileAssoc, offset)) {
+                std::cout << "Failed to merge MeshLink file: " << fname <<
+                    std::endl;
+                result = false;
+            }
+            if (xmlns_.empty()) {
+                xmlVersion_ = parser->xmlVersion_;
+                xmlns_ = parser->xmlns_;
+                xmlns_xsi_ = parser->xmlns_xsi_;
+                schemaLocation_ = parser->schemaLocation_;
+            }
+        }
+    }
+
+    for (size_t i = 0; i < numFiles; ++i) {
+        delete parsers[i];
+    }
+    meshAssociativity_ = meshAssociativity;
+    if (reorderEntities_) {
+        meshAssociativity_->reorderEntities();
+    }
+    return result;
+}
+
+
+/****************************************************************************
+ * MeshLinkSAXHandler class
+ ***************************************************************************/
+
+typedef std::basic_string<XMLCh> XMLStr;
+
+// Element captured from the SAX2 event stream. Each element is rebuilt
+// as a detached DOM element so the DOM element parsers above can be reused.
+struct SAXElement {
+    SAXElement() : cdata(false) {}
+
+    XMLStr name;
+    std::vector<std::pair<XMLStr, XMLStr> > atts;
+    XMLStr text;
+    bool cdata;
+};
+
+// Scratch document size (in characters) at which it is recreated to
+// release the memory held by rebuilt elements
+static const size_t SAXScratchLimit = 1 << 20;
+
+// Streaming MeshLink document handler
+class MeshLinkSAXHandler : public DefaultHandler {
+public:
+    MeshLinkSAXHandler(MeshLinkParserXerces &parser);
+    ~MeshLinkSAXHandler();
+
+    bool getResult() const { return result_; }
+
+    void startDocument() override;
+    void endDocument() override;
+    void startElement(const XMLCh *const uri, const XMLCh *const localname,
+        const XMLCh *const qname, const Attributes &attrs) override;
+    void endElement(const XMLCh *const uri, const XMLCh *const localname,
+        const XMLCh *const qname) override;
+    void characters(const XMLCh *const chars, const XMLSize_t length) override;
+    void startCDATA() override;
+    void endCDATA() override;
+
+private:
+    enum Tag {
+        TagAttribute,
+        TagAttributeGroup,
+        TagGeometryFile,
+        TagGeometryReference,
+        TagGeometryGroup,
+        TagMeshFile,
+        TagMeshModelReference,
+        TagMeshSheet,
+        TagMeshSheetReference,
+        TagMeshString,
+        TagMeshStringReference,
+        TagParamVertex,
+        TagParamVertexArray,
+        TagMeshPointReference,
+        TagMeshFace,
+        TagMeshFaceReference,
+        TagMeshEdge,
+        TagMeshEdgeReference,
+        TagTransform,
+        TagMeshElementLinkage,
+        NumTags,
+        TagUnknown = NumTags
+    };
+    static const char *tagNames_[NumTags];
+
+    Tag getTag(const XMLCh *localname) const;
+    static void copyElement(const XMLCh *qname, const Attributes &attrs,
+        SAXElement &record);
+    static std::string getAttribute(const SAXElement &record,
+        const char *name);
+    DOMElement *toDOMElement(const SAXElement &record);
+
+    void parseElement(Tag tag, DOMElement *elem);
+    void startGeometryFile(DOMElement *elem);
+    void endGeometryFile();
+    void startMeshFile(DOMElement *elem);
+    void endMeshFile();
+    void startMeshModel(DOMElement *elem);
+    void endMeshModel();
+    void startMeshObject(Tag tag, DOMElement *elem);
+    void endMeshObject();
+    void deleteMeshObject();
+    void failMeshObject();
+    void failMeshFile();
+
+    MeshLinkParserXerces &parser_;
+    MeshAssociativity *meshAssociativity_;
+    XMLCh *tags_[NumTags];
+
+    // Scratch document owning the rebuilt elements
+    DOMImplementation *domImpl_;
+    DOMDocument *scratch_;
+    size_t scratchSize_;
+
+    bool result_;
+    int depth_;
+    // Elements deeper than this are ignored after a MeshFile error
+    int skipDepth_;
+    // Elements at and below this depth are skipped by a load filter
+    int filterDepth_;
+
+    // Leaf element being read
+    bool capturing_;
+    bool inCDATA_;
+    int captureDepth_;
+    Tag captureTag_;
+    SAXElement current_;
+
+    // Root element attributes
+    SAXElement root_;
+
+    // Elements stored at the end of the document
+    std::vector<SAXElement> attributeGroups_;
+    std::vector<SAXElement> geometryGroups_;
+    std::vector<SAXElement> transforms_;
+    std::vector<SAXElement> linkages_;
+
+    // GeometryFile being read
+    GeometryFile *geomFile_;
+    bool geometryOK_;
+
+    // MeshFile being read
+    MeshFile *meshFile_;
+    XMLSize_t meshFileCount_;
+    int meshFileDepth_;
+    XMLSize_t modelCount_;
+    bool meshFileOK_;
+    bool meshResult_;
+
+    // MeshModel being read
+    MeshModel *model_;
+    SAXElement modelRecord_;
+    std::vector<SAXElement> modelPointRefs_;
+    XMLSize_t objCounts_[NumTags];
+
+    // MeshSheet or MeshString being read
+    MeshTopo *topo_;
+    Tag topoTag_;
+    const char *topoName_;
+    bool topoMapID_;
+    XMLSize_t topoItems_;
+};
+
+
+const char *MeshLinkSAXHandler::tagNames_[NumTags] = {
+    "Attribute",
+    "AttributeGroup",
+    "GeometryFile",
+    "GeometryReference",
+    "GeometryGroup",
+    "MeshFile",
+    "MeshModelReference",
+    "MeshSheet",
+    "MeshSheetReference",
+    "MeshString",
+    "MeshStringReference",
+    "ParamVertex",
+    "ParamVertexArray",
+    "MeshPointReference",
+    "MeshFace",
+    "MeshFaceReference",
+    "MeshEdge",
+    "MeshEdgeReference",
+    "Transform",
+    "MeshElementLinkage"
+};
+
+
+MeshLinkSAXHandler::MeshLinkSAXHandler(MeshLinkParserXerces &parser) :
+    parser_(parser),
+    meshAssociativity_(parser.meshAssociativity_),
+    domImpl_(NULL),
+    scratch_(NULL),
+    scratchSize_(0),
+    result_(false),
+    depth_(0),
+    skipDepth_(0),
+    filterDepth_(0),
+    capturing_(false),
+    inCDATA_(false),
+    captureDepth_(0),
+    captureTag_(TagUnknown),
+    geomFile_(NULL),
+    geometryOK_(true),
+    meshFile_(NULL),
+    meshFileCount_(0),
+    meshFileDepth_(0),
+    modelCount_(0),
+    meshFileOK_(true),
+    meshResult_(true),
+    model_(NULL),
+    topo_(NULL),
+    topoTag_(TagUnknown),
+    topoName_(NULL),
+    topoMapID_(false),
+    topoItems_(0)
+{
+    for (int i = 0; i < NumTags; ++i) {
+        tags_[i] = XMLString::transcode(tagNames_[i]);
+        objCounts_[i] = 0;
+    }
+    domImpl_ = DOMImplementationRegistry::getDOMImplementation(X("Core"));
+    scratch_ = domImpl_->createDocument();
+}
+
+
+MeshLinkSAXHandler::~MeshLinkSAXHandler()
+{
+    for (int i = 0; i < NumTags; ++i) {
+        XMLString::release(&tags_[i]);
+    }
+    scratch_->release();
+    // Objects not yet stored in the MeshAssociativity
+    delete geomFile_;
+    delete meshFile_;
+    deleteMeshObject();
+}
+
+
+MeshLinkSAXHandler::Tag
+MeshLinkSAXHandler::getTag(const XMLCh *localname) const
+{
+    for (int i = 0; i < NumTags; ++i) {
+        if (XMLString::equals(tags_[i], localname)) {
+            return (Tag)i;
+        }
+    }
+    return TagUnknown;
+}
+
+
+void
+MeshLinkSAXHandler::copyElement(const XMLCh *qname, const Attributes &attrs,
+    SAXElement &record)
+{
+    record.name = qname;
+    record.atts.clear();
+    for (XMLSize_t i = 0; i < attrs.getLength(); ++i) {
+        record.atts.push_back(std::make_pair(XMLStr(attrs.getQName(i)),
+            XMLStr(attrs.getValue(i))));
+    }
+    record.text.clear();
+    record.cdata = false;
+}
+
+
+std::string
+MeshLinkSAXHandler::getAttribute(const SAXElement &record, const char *name)
+{
+    XMLCopier<char, XMLCh> xmlName(name);
+    for (size_t i = 0; i < record.atts.size(); ++i) {
+        if (XMLString::equals(xmlName.convert(), record.atts[i].first.c_str())) {
+            XMLCopier<XMLCh, char> value(record.atts[i].second.c_str());
+            return std::string((char *)value);
+        }
+    }
+    return std::string();
+}
+
+
+// Rebuild a captured element in the scratch document. The caller
+// releases the element before the next one is built.
+DOMElement *
+MeshLinkSAXHandler::toDOMElement(const SAXElement &record)
+{
+    if (scratchSize_ > SAXScratchLimit) {
+        scratch_->release();
+        scratch_ = domImpl_->createDocument();
+        scratchSize_ = 0;
+    }
+    DOMElement *elem = scratch_->createElement(record.name.c_str());
+    scratchSize_ += record.name.size();
+    for (size_t i = 0; i < record.atts.size(); ++i) {
+        elem->setAttribute(record.atts[i].first.c_str(),
+            record.atts[i].second.c_str());
+        scratchSize_ += record.atts[i].first.size() +
+            record.atts[i].second.size();
+    }
+    if (!record.text.empty()) {
+        if (record.cdata) {
+            elem->appendChild(scratch_->createCDATASection(record.text.c_str()));
+        }
+        else {
+            elem->appendChild(scratch_->createTextNode(record.text.c_str()));
+        }
+        scratchSize_ += record.text.size();
+    }
+    return elem;
+}
+
+
+void
+MeshLinkSAXHandler::startDocument()
+{
+    meshAssociativity_->clearAttributes();
+}
+
+
+void
+MeshLinkSAXHandler::endDocument()
+{
+    size_t i;
+    DOMElement *elem;
+
+    // AttributeGroup content refers to Attribute elements
+    for (i = 0; i < attributeGroups_.size(); ++i) {
+        elem = toDOMElement(attributeGroups_[i]);
+        parser_.parseAttribute(elem, true);
+        elem->release();
+    }
+
+    // GeometryGroup content refers to GeometryReference elements
+    for (i = 0; geometryOK_ && i < geometryGroups_.size(); ++i) {
+        GeometryGroup geom_group;
+        elem = toDOMElement(geometryGroups_[i]);
+        if ((geometryOK_ = parseGeomGroupDOM(elem, meshAssociativity_,
+                geom_group))) {
+            meshAssociativity_->addGeometryGroup(std::move(geom_group));
+        }
+        elem->release();
+    }
+
+    if (!meshResult_ || 0 == meshFileCount_) {
+        std::cout << "Mesh Link File element(s) not found." << std::endl;
+        result_ = meshResult_;
+        return;
+    }
+
+    // Transform and MeshElementLinkage elements refer to mesh entities
+    meshAssociativity_->clearTransforms();
+    meshAssociativity_->clearMeshElementLinkages();
+    for (i = 0; i < transforms_.size(); ++i) {
+        elem = toDOMElement(transforms_[i]);
+        parser_.parseTransform(elem);
+        elem->release();
+    }
+    for (i = 0; i < linkages_.size(); ++i) {
+        elem = toDOMElement(linkages_[i]);
+        parser_.parseMeshElementLinkage(elem);
+        elem->release();
+    }
+
+    // Cached items for later use if/when writing out Xml file based
+    // on parsed/modified Meshassociativity.
+    if (root_.atts.size() > 3) {
+        parser_.xmlVersion_ = getAttribute(root_, "version");
+        parser_.xmlns_ = getAttribute(root_, "xmlns");
+        parser_.xmlns_xsi_ = getAttribute(root_, "xmlns:xsi");
+        parser_.schemaLocation_ = getAttribute(root_, "xsi:schemaLocation");
+    }
+
+    result_ = true;
+}
+
+
+void
+MeshLinkSAXHandler::startElement(const XMLCh *const uri,
+    const XMLCh *const localname, const XMLCh *const qname,
+    const Attributes &attrs)
+{
+    ++depth_;
+    if (1 == depth_) {
+        copyElement(qname, attrs, root_);
+        return;
+    }
+    if ((skipDepth_ > 0 && depth_ > skipDepth_) || filterDepth_ > 0 ||
+            capturing_) {
+        return;
+    }
+
+    Tag tag = getTag(localname);
+    switch (tag) {
+    case TagGeometryFile:
+    case TagMeshFile:
+    case TagMeshModelReference:
+    case TagMeshSheet:
+    case TagMeshSheetReference:
+    case TagMeshString:
+    case TagMeshStringReference: {
+        // Containers are created from their attributes
+        SAXElement record;
+        copyElement(qname, attrs, record);
+        DOMElement *elem = toDOMElement(record);
+        switch (tag) {
+        case TagGeometryFile:
+            startGeometryFile(elem);
+            break;
+        case TagMeshFile:
+            startMeshFile(elem);
+            break;
+        case TagMeshModelReference:
+            startMeshModel(elem);
+            modelRecord_ = std::move(record);
+            break;
+        default:
+            startMeshObject(tag, elem);
+            break;
+        }
+        elem->release();
+        break;
+    }
+    case TagUnknown:
+        break;
+    default:
+        // Leaf elements are parsed when complete
+        capturing_ = true;
+        captureDepth_ = depth_;
+        captureTag_ = tag;
+        copyElement(qname, attrs, current_);
+        break;
+    }
+}
+
+
+void
+MeshLinkSAXHandler::endElement(const XMLCh *const uri,
+    const XMLCh *const localname, const XMLCh *const qname)
+{
+    if (skipDepth_ > 0 && depth_ > skipDepth_) {
+        --depth_;
+        return;
+    }
+    if (filterDepth_ > 0) {
+        if (depth_ == filterDepth_) {
+            filterDepth_ = 0;
+        }
+        --depth_;
+        return;
+    }
+    if (capturing_) {
+        if (depth_ == captureDepth_) {
+            capturing_ = false;
+            switch (captureTag_) {
+            case TagAttributeGroup:
+                attributeGroups_.push_back(std::move(current_));
+                break;
+            case TagGeometryGroup:
+                geometryGroups_.push_back(std::move(current_));
+                break;
+            case TagTransform:
+                transforms_.push_back(std::move(current_));
+                break;
+            case TagMeshElementLinkage:
+                linkages_.push_back(std::move(current_));
+                break;
+            case TagMeshPointReference:
+                // Model level points refer to the model ParamVertex
+                // elements, which may follow
+                if (NULL != model_ && NULL == topo_) {
+                    modelPointRefs_.push_back(std::move(current_));
+                }
+                break;
+            default: {
+                DOMElement *elem = toDOMElement(current_);
+                parseElement(captureTag_, elem);
+                elem->release();
+                break;
+            }
+            }
+        }
+        --depth_;
+        return;
+    }
+
+    switch (getTag(localname)) {
+    case TagGeometryFile:
+        endGeometryFile();
+        break;
+    case TagMeshFile:
+        endMeshFile();
+        break;
+    case TagMeshModelReference:
+        endMeshModel();
+        break;
+    case TagMeshSheet:
+    case TagMeshSheetReference:
+    case TagMeshString:
+    case TagMeshStringReference:
+        endMeshObject();
+        break;
+    default:
+        break;
+    }
+    --depth_;
+}
+
+
+void
+MeshLinkSAXHandler::characters(const XMLCh *const chars,
+    const XMLSize_t length)
+{
+    // Only the CDATA section is kept when an element has one
+    if (capturing_ && (inCDATA_ || !current_.cdata)) {
+        current_.text.append(chars, length);
+    }
+}
+
+
+void
+MeshLinkSAXHandler::startCDATA()
+{
+    inCDATA_ = true;
+    if (capturing_ && !current_.cdata) {
+        current_.cdata = true;
+        current_.text.clear();
+    }
+}
+
+
+void
+MeshLinkSAXHandler::endCDATA()
+{
+    inCDATA_ = false;
+}
+
+
+// Parse a complete leaf element
+void
+MeshLinkSAXHandler::parseElement(Tag tag, DOMElement *elem)
+{
+    switch (tag) {
+    case TagAttribute:
+        parser_.parseAttribute(elem, false);
+        break;
+    case TagGeometryReference:
+        if (NULL != geomFile_ && geometryOK_) {
+            GeometryGroup geom_group;
+            if ((geometryOK_ = parseGeomRefDOM(elem, geom_group))) {
+                geomFile_->addGeometryGroupID(geom_group.getID());
+                meshAssociativity_->addGeometryGroup(std::move(geom_group));
+            }
+        }
+        break;
+    case TagParamVertex:
+        if (NULL != topo_) {
+            if (!parser_.parseParamVertex(topo_, elem)) {
+                std::cout << topoName_ << ": error parsing vertex." <<
+                    std::endl;
+                failMeshObject();
+            }
+        }
+        else if (NULL != model_) {
+            if (!parser_.parseParamVertex(model_, elem)) {
+                std::cout << "MeshModel: error parsing vertex." << std::endl;
+                failMeshFile();
+            }
+        }
+        break;
+    case TagParamVertexArray:
+        if (NULL != topo_) {
+            if (!parser_.parseParamVertexArray(topo_, elem)) {
+                std::cout << topoName_ << ": error parsing vertex." <<
+                    std::endl;
+                failMeshObject();
+            }
+        }
+        else if (NULL != model_) {
+            if (!parser_.parseParamVertexArray(model_, elem)) {
+                std::cout << "MeshModel: error parsing vertex." << std::endl;
+                failMeshFile();
+            }
+        }
+        break;
+    case TagMeshFace:
+    case TagMeshFaceReference:
+    case TagMeshEdge:
+    case TagMeshEdgeReference: {
+        if (NULL == topo_) {
+            break;
+        }
+        pParseMeshObj parseMeshObj = NULL;
+        bool isSheet = (TagMeshSheet == topoTag_ ||
+            TagMeshSheetReference == topoTag_);
+        if (isSheet && TagMeshFace == tag) {
+            parseMeshObj = &MeshLinkParserXerces::parseMeshFace;
+        }
+        else if (isSheet && TagMeshFaceReference == tag) {
+            parseMeshObj = &MeshLinkParserXerces::parseMeshFaceReference;
+        }
+        else if (!isSheet && TagMeshEdge == tag) {
+            parseMeshObj = &MeshLinkParserXerces::parseMeshEdge;
+        }
+        else if (!isSheet && TagMeshEdgeReference == tag) {
+            parseMeshObj = &MeshLinkParserXerces::parseMeshEdgeReference;
+        }
+        if (NULL != parseMeshObj) {
+            ++topoItems_;
+            if (!(parser_.*parseMeshObj)(model_, topo_, elem)) {
+                std::cout << topoName_ << ": error parsing " <<
+                    tagNames_[tag] << "." << std::endl;
+                failMeshObject();
+            }
+        }
+        break;
+    }
+    default:
+        break;
+    }
+}
+
+
+void
+MeshLinkSAXHandler::startGeometryFile(DOMElement *elem)
+{
+    if (!geometryOK_ || NULL != geomFile_) {
+        return;
+    }
+    std::string filename, aref;
+    if (!parseFileAttributes(elem, "GeometryFile", filename, aref)) {
+        geometryOK_ = false;
+        return;
+    }
+    geomFile_ = new GeometryFile(filename, aref);
+}
+
+
+void
+MeshLinkSAXHandler::endGeometryFile()
+{
+    if (NULL != geomFile_) {
+        meshAssociativity_->addGeometryFile(std::move(*geomFile_));
+        delete geomFile_;
+        geomFile_ = NULL;
+    }
+}
+
+
+void
+MeshLinkSAXHandler::startMeshFile(DOMElement *elem)
+{
+    if (NULL != meshFile_) {
+        return;
+    }
+    ++meshFileCount_;
+    meshFileDepth_ = depth_;
+    modelCount_ = 0;
+    meshFileOK_ = true;
+
+    std::string filename, aref;
+    if (!parseFileAttributes(elem, "MeshFile", filename, aref)) {
+        meshResult_ = false;
+        skipDepth_ = depth_;
+        return;
+    }
+    meshFile_ = new MeshFile(filename, aref);
+}
+
+
+void
+MeshLinkSAXHandler::endMeshFile()
+{
+    skipDepth_ = 0;
+    if (NULL == meshFile_) {
+        return;
+    }
+    if (0 == modelCount_) {
+        std::cout << "MeshFile node: no model references." << std::endl;
+        meshResult_ = false;
+    }
+    else {
+        meshAssociativity_->addMeshFile(std::move(*meshFile_));
+        if (!meshFileOK_) {
+            std::cout << "MeshFile node: problem parsing mesh reference." <<
+                std::endl;
+            meshResult_ = false;
+        }
+    }
+    delete meshFile_;
+    meshFile_ = NULL;
+}
+
+
+void
+MeshLinkSAXHandler::startMeshModel(DOMElement *elem)
+{
+    if (NULL == meshFile_ || NULL != model_) {
+        return;
+    }
+    ++modelCount_;
+    if (!parser_.loadFilterAccepts(parser_.modelFilter_, elem)) {
+        filterDepth_ = depth_;
+        return;
+    }
+    for (int i = 0; i < NumTags; ++i) {
+        objCounts_[i] = 0;
+    }
+    model_ = parser_.createMeshModel(*meshFile_, elem);
+    if (NULL == model_) {
+        failMeshFile();
+    }
+}
+
+
+void
+MeshLinkSAXHandler::endMeshModel()
+{
+    if (NULL == model_) {
+        return;
+    }
+    for (size_t i = 0; i < modelPointRefs_.size(); ++i) {
+        DOMElement *elem = toDOMElement(modelPointRefs_[i]);
+        bool result = parser_.parseMeshPointReference(model_, elem);
+        elem->release();
+        if (!result) {
+            std::cout << "MeshModelReference node: problem "
+                "parsing MeshPointReference " << (i + 1) << std::endl;
+            failMeshFile();
+            return;
+        }
+    }
+    modelPointRefs_.clear();
+
+    DOMElement *elem = toDOMElement(modelRecord_);
+    parser_.printMeshModelInfo(elem, model_);
+    elem->release();
+    model_ = NULL;
+}
+
+
+void
+MeshLinkSAXHandler::startMeshObject(Tag tag, DOMElement *elem)
+{
+    if (NULL == model_ || NULL != topo_) {
+        return;
+    }
+    ++objCounts_[tag];
+    bool isSheet = (TagMeshSheet == tag || TagMeshSheetReference == tag);
+    if (!parser_.loadFilterAccepts(
+            isSheet ? parser_.sheetFilter_ : parser_.stringFilter_, elem)) {
+        filterDepth_ = depth_;
+        return;
+    }
+    topoTag_ = tag;
+    topoItems_ = 0;
+    topoMapID_ = false;
+    if (isSheet) {
+        // Becomes the responsibility of the MeshModel if
+        // parsing is successful.
+        topo_ = new MeshSheet();
+        topoName_ = "MeshSheet";
+    }
+    else {
+        topo_ = new MeshString();
+        topoName_ = "MeshString";
+    }
+    if (!parser_.parseMeshObjectAttributes(model_, topo_, elem, topoMapID_)) {
+        failMeshObject();
+    }
+}
+
+
+void
+MeshLinkSAXHandler::endMeshObject()
+{
+    if (NULL == topo_) {
+        return;
+    }
+    if (0 == topoItems_) {
+        std::cout << topoName_ << ": error missing content." << std::endl;
+        failMeshObject();
+        return;
+    }
+
+    bool result;
+    if (TagMeshSheet == topoTag_ || TagMeshSheetReference == topoTag_) {
+        result = parser_.storeMeshSheet(model_,
+            static_cast<MeshSheet *>(topo_));
+    }
+    else {
+        result = parser_.storeMeshString(model_,
+            static_cast<MeshString *>(topo_), topoMapID_);
+    }
+    if (!result) {
+        failMeshObject();
+        return;
+    }
+    // Now owned by the MeshModel
+    topo_ = NULL;
+}
+
+
+// Delete the MeshSheet or MeshString being read
+void
+MeshLinkSAXHandler::deleteMeshObject()
+{
+    if (TagMeshSheet == topoTag_ || TagMeshSheetReference == topoTag_) {
+        delete static_cast<MeshSheet *>(topo_);
+    }
+    else {
+        delete static_cast<MeshString *>(topo_);
+    }
+    topo_ = NULL;
+}
+
+
+// Discard the MeshSheet or MeshString being read and the rest of its MeshFile
+void
+MeshLinkSAXHandler::failMeshObject()
+{
+    std::cout << "MeshModelReference node: problem "
+        "parsing " << tagNames_[topoTag_] << " " << objCounts_[topoTag_] <<
+        std::endl;
+    failMeshFile();
+}
+
+
+// Skip the rest of the MeshFile being read
+void
+MeshLinkSAXHandler::failMeshFile()
+{
+    deleteMeshObject();
+    model_ = NULL;
+    modelPointRefs_.clear();
+    meshFileOK_ = false;
+    skipDepth_ = meshFileDepth_;
+}
+
+
+// Read MeshLink document with the SAX2 parser
+bool
+MeshLinkParserXercesSAX::parseMeshLinkInput(
+    const MeshLinkInput &input,
+    MeshAssociativity *meshAssociativity)
+{
+    if (!meshAssociativity) { return false; }
+    meshAssociativity_ = meshAssociativity;
+    bool result = true;
+    XercesPlatformSession session;
+    if (!session) {
+        return false;
+    }
+
+    XMLGrammarPool *grammarPool = nullptr;
+    if (validateOnParse_ && !schemaName_.empty() &&
+            nullptr == (grammarPool = getSchemaGrammarPool(schemaName_))) {
+        return false;
+    }
+
+    SAX2XMLReader *parser = XMLReaderFactory::createXMLReader(
+        XMLPlatformUtils::fgMemoryManager, grammarPool);
+    MeshLinkSAXHandler *handler(new MeshLinkSAXHandler(*this));
+    SAXErrorHandler *errHandler(new SAXErrorHandler());
+    parser->setContentHandler(handler);
+    parser->setLexicalHandler(handler);
+    parser->setErrorHandler(errHandler);
+
+    try {
+        parser->setFeature(XMLUni::fgSAX2CoreValidation, validateOnParse_);
+        if (validateOnParse_) {
+            parser->setFeature(XMLUni::fgXercesDynamic, false);
+            parser->setFeature(XMLUni::fgXercesSchema, true);
+            parser->setFeature(XMLUni::fgXercesUseCachedGrammarInParse,
+                nullptr != grammarPool);
+        }
+        parser->setFeature(XMLUni::fgSAX2CoreNameSpaces, true);
+        // Report the xmlns attributes of the root element
+        parser->setFeature(XMLUni::fgSAX2CoreNameSpacePrefixes, true);
+        MeshLinkInputSource source(input.fname.c_str(), input.buffer,
+            input.length, mapInputFiles_);
+        parser->parse(source);
+        errHandler->outputCounts();
+        result = handler->getResult();
+        if (validateOnParse_ && 0 < errHandler->getErrorCount()) {
+            std::cout << "MeshLink document does not conform to the schema." <<
+                std::endl;
+            result = false;
+        }
+    }
+    catch (const XMLException &toCatch) {
+        char *msg = XMLString::transcode(toCatch.getMessage());
+        std::cout << "Exception message: " << msg << std::endl;
+        XMLString::release(&msg);
+        result = false;
+    }
+    catch (const SAXException &toCatch) {
+        char *msg = XMLString::transcode(toCatch.getMessage());
+        std::cout << "SAX Exception message: " << msg << std::endl;
+        XMLString::release(&msg);
+        result = false;
+    }
+    catch (const DOMException &toCatch) {
+        char *msg = XMLString::transcode(toCatch.getMessage());
+        std::cout << "DOM Exception message: " << msg << std::endl;
+        XMLString::release(&msg);
+        result = false;
+    }
+
+    delete parser;
+    delete handler;
+    delete errHandler;
+
+    if (result && reorderEntities_) {
+        meshAssociativity_->reorderEntities();
     }
 
     return result;
@@ -15,6 +15,7 @@
 #include "MeshLinkParser.h"
 
 #include <map>
+#include <set>
 #include <string>
 #include <vector>
 
@@ -26,13 +27,80 @@ namespace xercesc_3_2 {
 
 class MeshLinkWriterXerces;
 class MeshAssociativity;
+class MeshFile;
 class MeshModel;
+class MeshSheet;
+class MeshString;
 class MeshTopo;
 class ParamVertex;
 
 class XMLMeshEdge;
 class XMLMeshFace;
 class MeshLinkParser;
+class MeshLinkSAXHandler;
+class MeshLinkBinaryView;
+
+
+/****************************************************************************
+ * MeshLinkLoadFilter class
+ ***************************************************************************/
+/**
+ * \class MeshLinkLoadFilter
+ *
+ * \brief Selects the MeshModelReference, MeshSheet or MeshString elements
+ * read by a MeshLinkParserXerces, by name or gref.
+ *
+ * An element is read if it matches an include entry (or no entries were
+ * included) and matches no exclude entry.
+ */
+class MeshLinkLoadFilter {
+public:
+    /// \brief Read only the elements with this name (and other includes)
+    void include(const std::string &name) {
+        includeNames_.insert(name);
+    }
+
+    /// \brief Read only the elements with this gref (and other includes)
+    void include(MLINT gref) {
+        includeGrefs_.insert(gref);
+    }
+
+    /// \brief Skip the elements with this name
+    void exclude(const std::string &name) {
+        excludeNames_.insert(name);
+    }
+
+    /// \brief Skip the elements with this gref
+    void exclude(MLINT gref) {
+        excludeGrefs_.insert(gref);
+    }
+
+    /// \brief Remove all include and exclude entries
+    void clear() {
+        includeNames_.clear();
+        includeGrefs_.clear();
+        excludeNames_.clear();
+        excludeGrefs_.clear();
+    }
+
+    /// \brief Whether an element with this name and gref is read
+    ///
+    /// \param name the element name, empty if it has none
+    /// \param gref the element gref, MESH_TOPO_INVALID_REF if it has none
+    bool accepts(const std::string &name, MLINT gref) const {
+        if (excludeNames_.count(name) > 0 || excludeGrefs_.count(gref) > 0) {
+            return false;
+        }
+        return (includeNames_.empty() && includeGrefs_.empty()) ||
+            includeNames_.count(name) > 0 || includeGrefs_.count(gref) > 0;
+    }
+
+private:
+    std::set<std::string> includeNames_;
+    std::set<MLINT> includeGrefs_;
+    std::set<std::string> excludeNames_;
+    std::set<MLINT> excludeGrefs_;
+};
 
 
 /****************************************************************************
@@ -61,13 +129,20 @@ public:
     /// Default constructor
     MeshLinkParserXerces():
         meshAssociativity_(NULL),
-        verbose_level_(0)
+        document_(NULL),
+        verbose_level_(0),
+        reorderEntities_(false),
+        mapInputFiles_(false),
+        validateOnParse_(false)
     {}
     /// Destructor
-    ~MeshLinkParserXerces();
+    virtual ~MeshLinkParserXerces();
 
     /// \brief Validate XML file against MeshLink schema using the Xerces parser
     ///
+    /// The compiled schema is cached for the life of the process (see
+    /// releaseSchemaGrammars).
+    ///
     /// \param fileName the MeshLink XML file name
     /// \param schemaName the MeshLink XML Schema Definition (XSD) file name
     ///
@@ -77,6 +152,12 @@ public:
     /// \brief Parse a MeshLink XML file and populate a MeshAssociativity using the
     ///     Xerces XML parser.
     ///
+    /// A gzip-compressed file is recognized by its content and decoded as
+    /// it is read when the parser is built with zlib (HAVE_ZLIB). A
+    /// MeshLinkBinary container is also recognized by its content and is
+    /// read through a memory map, without XML parsing; a gzip-compressed
+    /// container is decoded into memory.
+    ///
     /// \param fname the MeshLink XML file name
     /// \param meshAssociativity the MeshAssociativity object to populate
     ///
@@ -84,6 +165,41 @@ public:
     ///     was populated
     bool parseMeshLinkFile(std::string fname, MeshAssociativity *meshAssociativity) override;
 
+    /// \brief Parse a MeshLink XML document held in memory and populate a
+    ///     MeshAssociativity using the Xerces XML parser.
+    ///
+    /// The buffer is read in place; it is not copied. The document may
+    /// also be a MeshLinkBinary container.
+    ///
+    /// \param buffer the MeshLink XML document
+    /// \param length the length of the document in bytes
+    /// \param meshAssociativity the MeshAssociativity object to populate
+    ///
+    /// \return true if the document was successfully read and the
+    ///     MeshAssociativity object was populated
+    bool parseMeshLinkBuffer(const char *buffer, size_t length,
+        MeshAssociativity *meshAssociativity) override;
+
+    /// \brief Parse several MeshLink XML files concurrently and merge them
+    ///     into a single MeshAssociativity using the Xerces XML parser.
+    ///
+    /// The XML files are read into DOM models concurrently, a round of
+    /// files at a time. Each file of the round is then populated into its
+    /// own MeshAssociativity and merged, in the order given, so unnamed
+    /// entities are named as if the files had been read one after another.
+    /// MeshLinkBinary containers, and all files read by the SAX parser,
+    /// are read in turn when they are populated.
+    ///
+    /// \param fnames the MeshLink XML file names
+    /// \param meshAssociativity the MeshAssociativity object to populate
+    /// \param offsetPointIndices if true, point indices of each file are offset
+    ///     to follow those already loaded
+    ///
+    /// \return true if all files were successfully read and merged
+    bool parseMeshLinkFiles(const std::vector<std::string> &fnames,
+        MeshAssociativity *meshAssociativity,
+        bool offsetPointIndices = true) override;
+
     /// \brief Obtain the MeshLink XML file properties after reading
     ///
     /// \param[out] xmlns the XML namespace string
@@ -113,12 +229,139 @@ public:
     void setVerboseLevel(int level) {
         verbose_level_ = level;
     }
-private:
+
+    /// \brief Set whether entities are sorted in point index order after reading
+    ///
+    /// By default, entities are stored in file order.
+    /// \see MeshAssociativity::reorderEntities
+    void setReorderEntities(bool reorder) {
+        reorderEntities_ = reorder;
+    }
+
+    /// \brief Set whether parseMeshLinkFile reads files through a memory map
+    ///
+    /// Mapping avoids copying the file through buffered reads. By default,
+    /// files are read with buffered I/O. Gzip-compressed files are never
+    /// mapped.
+    void setMapInputFiles(bool map) {
+        mapInputFiles_ = map;
+    }
+
+    /// \brief Set whether parseMeshLinkFile validates the document against
+    ///     the MeshLink schema while reading it
+    ///
+    /// Validating in the same pass avoids the separate parse made by
+    /// validate. A document that does not conform to the schema is not
+    /// read. The compiled schema is cached for the life of the process and
+    /// shared by all parsers.
+    ///
+    /// \param validate whether to validate while reading
+    /// \param schemaName the MeshLink XML Schema Definition (XSD) file name;
+    ///     if empty, the XML file must designate the XSD file location
+    void setValidateOnParse(bool validate,
+        const std::string &schemaName = std::string()) {
+        validateOnParse_ = validate;
+        schemaName_ = schemaName;
+    }
+
+    /// \brief Return the filter selecting the MeshModelReference elements
+    ///     read by parseMeshLinkFile
+    ///
+    /// A skipped MeshModelReference is not read, nor are its MeshSheet,
+    /// MeshString, ParamVertex and MeshPointReference elements.
+    MeshLinkLoadFilter &getModelFilter() {
+        return modelFilter_;
+    }
+
+    /// \brief Return the filter selecting the MeshSheet and
+    ///     MeshSheetReference elements read by parseMeshLinkFile
+    MeshLinkLoadFilter &getSheetFilter() {
+        return sheetFilter_;
+    }
+
+    /// \brief Return the filter selecting the MeshString and
+    ///     MeshStringReference elements read by parseMeshLinkFile
+    MeshLinkLoadFilter &getStringFilter() {
+        return stringFilter_;
+    }
+
+    /// \brief Release the schema grammars cached by validate and
+    ///     validating parses
+    ///
+    /// Must not be called while any parser is reading.
+    static void releaseSchemaGrammars();
+protected:
+    friend class MeshLinkSAXHandler;
+
+    /// \brief The MeshLink document to parse, a file or a memory buffer
+    struct MeshLinkInput {
+        MeshLinkInput() : buffer(NULL), length(0) {}
+
+        /// File name, or document name when reading a buffer
+        std::string fname;
+        /// Document in memory, or NULL to read fname
+        const char *buffer;
+        /// Length of buffer in bytes
+        size_t length;
+    };
+
+    /// \brief Parse a MeshLink document and populate a MeshAssociativity
+    virtual bool parseMeshLinkInput(const MeshLinkInput &input,
+        MeshAssociativity *meshAssociativity);
+
+    /// \brief Return a new parser of the same kind, used to read each
+    ///     file in parseMeshLinkFiles
+    virtual MeshLinkParserXerces *createParser() const {
+        return new MeshLinkParserXerces();
+    }
+
+    /// \brief A MeshLink document read into a Xerces DOM model
+    struct LoadedDocument;
+
+    /// \brief Read a MeshLink XML file into a Xerces DOM model, to be
+    ///     populated by buildDocument
+    ///
+    /// \param fname the MeshLink file name
+    /// \param[out] loaded false if the file is not read ahead, as for a
+    ///     MeshLinkBinary container; it is then read by parseMeshLinkFile
+    ///
+    /// \return false if the file could not be read
+    virtual bool loadMeshLinkFile(const std::string &fname, bool &loaded);
+    /// \brief Read a MeshLink document into a Xerces DOM model, held until
+    ///     releaseDocument
+    bool loadDocument(const MeshLinkInput &input);
+    /// \brief Populate a MeshAssociativity from the loaded document
+    bool buildDocument(MeshAssociativity *meshAssociativity);
+    /// \brief Destroy the loaded document
+    void releaseDocument();
+
+    /// \brief Populate a MeshAssociativity from a MeshLinkBinary container
+    ///
+    /// The container is used in place; it is not copied unless it is
+    /// not 8-byte aligned.
+    bool parseMeshLinkBinary(const char *data, size_t length,
+        MeshAssociativity *meshAssociativity);
+    /// \brief Create a MeshModel, its MeshSheets and MeshStrings from a
+    ///     MeshLinkBinary container model record
+    bool loadBinaryModel(const MeshLinkBinaryView &view, MeshFile &meshFile,
+        size_t index);
+    /// \brief Create a MeshSheet or MeshString in the given model from a
+    ///     MeshLinkBinary container record
+    bool loadBinaryContainer(const MeshLinkBinaryView &view, MeshModel *model,
+        size_t index);
+
     /// \brief Populate the MeshLinkAttribute objects
     bool parseAttributes(xercesc_3_2::DOMElement *root);
+    /// \brief Create a MeshLinkAttribute from an Attribute or
+    ///     AttributeGroup element
+    bool parseAttribute(xercesc_3_2::DOMElement *attNode, bool isGroup);
 
     /// \brief Populate the Transform and MeshElementLinkage objects
     bool parsePeriodicInfo(xercesc_3_2::DOMElement *root);
+    /// \brief Create a MeshLinkTransform from a Transform element
+    bool parseTransform(xercesc_3_2::DOMElement *attNode);
+    /// \brief Create a MeshElementLinkage from a MeshElementLinkage element
+    bool parseMeshElementLinkage(xercesc_3_2::DOMElement *attNode);
 
     /// \brief Populate the GeometryGroup objects
     bool parseGeometryRefs(xercesc_3_2::DOMElement *root);
@@ -127,6 +370,18 @@ private:
     bool parseMeshFile(xercesc_3_2::DOMElement *element);
     /// \brief Create a MeshModel from the Xerces DOM model
     bool parseMeshRefModel(MeshFile &meshFile, xercesc_3_2::DOMElement *modelRef);
+    /// \brief Create and store an empty MeshModel from the attributes of a
+    ///     MeshModelReference element
+    ///
+    /// \return the new model, or NULL on error
+    MeshModel *createMeshModel(MeshFile &meshFile,
+        xercesc_3_2::DOMElement *modelRef);
+    /// \brief Print the MeshModel summary when verbose
+    void printMeshModelInfo(xercesc_3_2::DOMElement *modelRef,
+        MeshModel *meshModel);
+    /// \brief Whether a filter selects an element by its name and gref
+    static bool loadFilterAccepts(const MeshLinkLoadFilter &filter,
+        xercesc_3_2::DOMElement *element);
     /// \brief Create a MeshSheet in the given model from the Xerces DOM model
     bool parseMeshSheet(MeshModel *model, xercesc_3_2::DOMElement *meshSheetNode);
     /// \brief Create a MeshSheet from reference data in the given model from the Xerces DOM model
@@ -135,8 +390,23 @@ private:
     bool parseMeshString(MeshModel *model, xercesc_3_2::DOMElement *meshStringNode);
     /// \brief Create a MeshString from reference data in the given model from the Xerces DOM model
     bool parseMeshStringReference(MeshModel *model, xercesc_3_2::DOMElement *meshStringNode);
+    /// \brief Add a parsed MeshSheet to the given model
+    ///
+    /// The model takes ownership of the sheet on success.
+    bool storeMeshSheet(MeshModel *model, MeshSheet *meshSheet);
+    /// \brief Add a parsed MeshString to the given model
+    ///
+    /// The model takes ownership of the string on success.
+    bool storeMeshString(MeshModel *model, MeshString *meshString, bool mapID);
+    /// \brief Print the MeshSheet summary when verbose
+    void printMeshSheetInfo(MeshSheet *meshSheet);
+    /// \brief Print the MeshString summary when verbose
+    void printMeshStringInfo(MeshString *meshString);
     /// \brief Create a ParamVertex for the given MeshTopo entity from the Xerces DOM model
     bool parseParamVertex(MeshTopo *meshTopo, xercesc_3_2::DOMElement *element);
+    /// \brief Create the ParamVertex objects of a base64 ParamVertexArray
+    ///     for the given MeshTopo entity from the Xerces DOM model
+    bool parseParamVertexArray(MeshTopo *meshTopo, xercesc_3_2::DOMElement *element);
     /// \brief Create a MeshPoint in the given model from the Xerces DOM model
     bool parseMeshPoint(MeshModel *model, xercesc_3_2::DOMElement *meshPoint);
     /// \brief Create a MeshPoint from reference data in the given model from the Xerces DOM model
@@ -159,6 +429,28 @@ private:
     ///     from the Xerces DOM model
     bool parseMeshFace(MeshModel *model,
         MeshTopo * meshTopo, xercesc_3_2::DOMElement *element);
+    /// \brief Add count faces from a packed index array to the given model
+    ///     and parent MeshTopo entity
+    ///
+    /// The parent's ParamVertex objects are indexed by point index once per
+    /// call rather than looked up by vref string for every face point. The
+    /// faces are stored with MeshModel::addFaces and MeshSheet::addFaces.
+    ///
+    /// \param indices 3 (triFace) or 4 point indices per face
+    void addMeshFaces(MeshModel *model, MeshTopo *meshTopo,
+        const MLINT *indices, size_t count, bool triFace,
+        MLINT mid, MLINT aref, MLINT gref, std::string &name, bool mapID);
+    /// \brief Add count edges from a packed index array to the given model
+    ///     and parent MeshTopo entity
+    ///
+    /// The parent's ParamVertex objects are indexed by point index once per
+    /// call rather than looked up by vref string for every edge point. The
+    /// edges are stored with MeshModel::addEdges and MeshString::addEdges.
+    ///
+    /// \param indices 2 point indices per edge
+    void addMeshEdges(MeshModel *model, MeshTopo *meshTopo,
+        const MLINT *indices, size_t count,
+        MLINT mid, MLINT aref, MLINT gref, std::string &name, bool mapID);
     /// \brief Create a MeshFace from reference data in the given model and parent
     ///     MeshTopo entity from the Xerces DOM model
     bool parseMeshFaceReference(MeshModel *model,
@@ -172,12 +464,90 @@ private:
         xercesc_3_2::DOMElement *xmlObj,
         const char *objName,
         ParseMeshObjMap &parseMeshObjMap, bool &mapID);
+    /// \brief Parse the MeshSheet and MeshString elements of a
+    ///     MeshModelReference into the given MeshModel, in document order
+    bool parseMeshObjects(MeshModel *model,
+        xercesc_3_2::DOMElement *modelRef);
+    /// \brief Collect the MeshSheet, MeshSheetReference, MeshString and
+    ///     MeshStringReference elements of a MeshModelReference selected by
+    ///     the load filters, with the kind and ordinal (among the elements
+    ///     of its kind) of each
+    void getMeshObjects(xercesc_3_2::DOMElement *modelRef,
+        std::vector<xercesc_3_2::DOMElement *> &objs,
+        std::vector<size_t> &kinds, std::vector<size_t> &ordinals);
+
+    /// \brief Content of a MeshFace, MeshEdge or ParamVertexArray element
+    ///     decoded ahead of populating the MeshAssociativity
+    struct DecodedContent {
+        DecodedContent() : result(false) {}
+
+        /// Whether the content was read
+        bool result;
+        /// MeshFace or MeshEdge attribute values, as from parseNode
+        std::vector<std::string> atts;
+        /// MeshFace or MeshEdge content not decoded into indices
+        std::string value;
+        /// MeshFace or MeshEdge point indices
+        std::vector<MLINT> indices;
+        /// ParamVertexArray packed arrays
+        std::vector<unsigned char> bytes;
+    };
+    typedef std::map<const xercesc_3_2::DOMElement *, DecodedContent>
+        DecodedContentMap;
+
+    /// \brief Decode the MeshFace, MeshEdge and ParamVertexArray elements
+    ///     of the selected models, sheets and strings concurrently
+    ///
+    /// The MeshAssociativity is then populated sequentially in document
+    /// order, each element parser taking its decoded content instead of
+    /// decoding the element, so unnamed entities are named in document
+    /// order.
+    void decodeContent(xercesc_3_2::DOMElement *root);
+    /// \brief Read the attributes and content of a MeshFace or MeshEdge
+    ///     element as parseNode does, taking the content decoded by
+    ///     decodeContent if there is any
+    bool parseIndexNode(xercesc_3_2::DOMElement *node,
+        std::vector<std::string> &atts, std::string &value,
+        std::vector<MLINT> &indices);
+    /// \brief Take the content of a ParamVertexArray element decoded by
+    ///     decodeContent, if there is any
+    bool takeDecodedBytes(xercesc_3_2::DOMElement *node,
+        std::vector<unsigned char> &bytes);
+    /// \brief Set the identifying attributes of a MeshTopo object from
+    ///     its MeshSheet or MeshString element
+    bool parseMeshObjectAttributes(MeshModel *model,
+        MeshTopo* meshTopo,
+        xercesc_3_2::DOMElement *xmlObj, bool &mapID);
 
     /// \brief the MeshAssociativity object to be populated
     MeshAssociativity *meshAssociativity_;
 
+    /// The document read by loadDocument, or NULL
+    LoadedDocument *document_;
+
+    /// Content of the loaded document decoded by decodeContent and not
+    /// yet taken by the element parsers
+    DecodedContentMap decodedContent_;
+
     int verbose_level_;
 
+    /// Whether to sort entities in point index order after reading
+    bool reorderEntities_;
+
+    /// Whether to read files through a memory map
+    bool mapInputFiles_;
+
+    /// Whether to validate against the schema while reading
+    bool validateOnParse_;
+
+    /// Schema used when validating while reading
+    std::string schemaName_;
+
+    /// Selected MeshModelReference, MeshSheet and MeshString elements
+    MeshLinkLoadFilter modelFilter_;
+    MeshLinkLoadFilter sheetFilter_;
+    MeshLinkLoadFilter stringFilter_;
+
     // Parsed Xml 'header' attributes cached for use when writing out
     // Xml file based on parsed/modified Meshassociativity. Supports
     // 'round tripping' of MeshLink files
@@ -192,6 +562,45 @@ private:
     std::string schemaLocation_;
 };
 
+
+/****************************************************************************
+ * MeshLinkParserXercesSAX class
+ ***************************************************************************/
+/**
+ * \class MeshLinkParserXercesSAX
+ *
+ * \brief A streaming MeshLink data parser using the Apache Xerces SAX2 API.
+ *
+ * The MeshAssociativity is populated as elements are read instead of
+ * from a complete DOM of the file. Only the element being read is held
+ * in memory, so peak memory does not grow with the file size.
+ *
+ * Attribute, GeometryReference and mesh elements are stored as they are
+ * read. AttributeGroup, GeometryGroup, Transform and MeshElementLinkage
+ * elements may refer to items defined anywhere in the file and are stored
+ * at the end of the document. Model level MeshPointReference elements are
+ * stored at the end of their MeshModelReference, after its ParamVertex
+ * elements.
+ */
+class MeshLinkParserXercesSAX : public MeshLinkParserXerces {
+protected:
+    /// \brief Parse a MeshLink document and populate a MeshAssociativity
+    ///     using the Xerces SAX2 parser.
+    bool parseMeshLinkInput(const MeshLinkInput &input,
+        MeshAssociativity *meshAssociativity) override;
+
+    MeshLinkParserXerces *createParser() const override {
+        return new MeshLinkParserXercesSAX();
+    }
+
+    /// \brief Files are read by the SAX parser as they are populated, so
+    ///     none is loaded ahead
+    bool loadMeshLinkFile(const std::string &, bool &loaded) override {
+        loaded = false;
+        return true;
+    }
+};
+
 #endif
 
 /****************************************************************************
@@ -25,6 +25,18 @@ ML_createMeshLinkParserXercesObj(MeshLinkParserObj *parseObj)
     return 1;
 }
 
+int
+ML_createMeshLinkParserXercesSAXObj(MeshLinkParserObj *parseObj)
+{
+    if (parseObj) {
+        *parseObj = (MeshLinkParserObj) new MeshLinkParserXercesSAX;
+        if (*parseObj) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
 void
 ML_freeMeshLinkParserXercesObj(MeshLinkParserObj *parseObj)
 {
@@ -44,6 +56,26 @@ ML_setMeshLinkParserVerboseLevel(MeshLinkParserObj parseObj, MLINT level)
     }
 }
 
+void
+ML_setMeshLinkParserMapInputFiles(MeshLinkParserObj parseObj, MLINT map)
+{
+    MeshLinkParserXerces *parser = (MeshLinkParserXerces *)parseObj;
+    if (parser) {
+        parser->setMapInputFiles(0 != map);
+    }
+}
+
+void
+ML_setMeshLinkParserValidateOnParse(MeshLinkParserObj parseObj,
+    MLINT validate, const char *schemaFilename)
+{
+    MeshLinkParserXerces *parser = (MeshLinkParserXerces *)parseObj;
+    if (parser) {
+        parser->setValidateOnParse(0 != validate,
+            schemaFilename ? schemaFilename : "");
+    }
+}
+
 /****************************************************************************
  *
  * This file is licensed under the Cadence Public License Version 1.0 (the
@@ -21,6 +21,18 @@
 /** @cond */ ML_EXTERN ML_STORAGE_CLASS /** @endcond */
 int  ML_createMeshLinkParserXercesObj(MeshLinkParserObj *parseObj);
 
+/**
+ * \brief Allocates a new streaming MeshLinkParserXercesSAX Object.
+ *
+ * The object is used like a MeshLinkParserXerces object, but reads the
+ * MeshLink file with the SAX2 API so memory use does not grow with the
+ * file size. Free it with ML_freeMeshLinkParserXercesObj.
+ * @param[in,out] MeshLinkParserObj MeshLinkParserXercesSAX object
+ * \returns ML_STATUS_OK / ML_STATUS_ERROR
+ */
+/** @cond */ ML_EXTERN ML_STORAGE_CLASS /** @endcond */
+int  ML_createMeshLinkParserXercesSAXObj(MeshLinkParserObj *parseObj);
+
 /**
  * \brief Frees a MeshLinkParserXerces Object.
  * @param[in,out] MeshLinkParserObj MeshLinkParserXerces object
@@ -40,6 +52,30 @@ void   ML_freeMeshLinkParserXercesObj(MeshLinkParserObj *parseObj);
 void   ML_setMeshLinkParserVerboseLevel(MeshLinkParserObj parseObj,
     MLINT level);
 
+/**
+ * \brief Set whether the MeshLinkParserXerces reads files through a
+ * memory map.
+ * @param[in,out] MeshLinkParserObj MeshLinkParserXerces object
+ * @param[in] map 1 to map input files, 0 to use buffered reads (default)
+ */
+/** @cond */ ML_EXTERN ML_STORAGE_CLASS /** @endcond */
+void   ML_setMeshLinkParserMapInputFiles(MeshLinkParserObj parseObj,
+    MLINT map);
+
+/**
+ * \brief Set whether the MeshLinkParserXerces validates MeshLink files
+ * against the schema while reading them.
+ *
+ * The compiled schema is cached and reused by later reads.
+ * @param[in,out] MeshLinkParserObj MeshLinkParserXerces object
+ * @param[in] validate 1 to validate while reading, 0 to not validate (default)
+ * @param[in] schemaFilename schema filename; if NULL or empty, the MeshLink
+ *     file must designate the schema location
+ */
+/** @cond */ ML_EXTERN ML_STORAGE_CLASS /** @endcond */
+void   ML_setMeshLinkParserValidateOnParse(MeshLinkParserObj parseObj,
+    MLINT validate, const char *schemaFilename);
+
 
 #endif
 
@@ -33,6 +33,14 @@
         ENDFUNCTION ML_createMeshLinkParserXercesObj
         
 
+! Allocate a new streaming MeshLinkParserXercesSAXObj 
+        INTEGER(C_INT) FUNCTION ML_createMeshLinkParserXercesSAXObj(parseObj) bind(C, name="ML_createMeshLinkParserXercesSAXObj")
+          use, intrinsic :: iso_c_binding
+          implicit none
+          TYPE(C_PTR), INTENT(OUT) :: parseObj
+        ENDFUNCTION ML_createMeshLinkParserXercesSAXObj
+        
+
 ! Free MeshLinkParserXercesObj memory 
         subroutine ML_freeMeshLinkParserXercesObj(parseObj) bind(C, name="ML_freeMeshLinkParserXercesObj")
           use, intrinsic :: iso_c_binding
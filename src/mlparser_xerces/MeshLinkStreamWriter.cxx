@@ -0,0 +1,1137 @@
+/****************************************************************************
+ *
+ * (C) 2021 Cadence Design Systems, Inc. All rights reserved worldwide.
+ *
+ * This sample source code is not supported by Cadence Design Systems, Inc.
+ * It is provided freely for demonstration purposes only.
+ * SEE THE WARRANTY DISCLAIMER AT THE BOTTOM OF THIS FILE.
+ *
+ ***************************************************************************/
+
+#include "MeshAssociativity.h"
+
+#include "MeshLinkInternal.h"
+#include "MeshLinkOutput.h"
+#include "MeshLinkStreamWriter.h"
+#include "TextFormatter.h"
+#include "ThreadPool.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cerrno>
+#include <climits>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <iostream>
+#include <memory>
+
+// Base64 output matches the Xerces encoder: 15 quads per line, each
+// line ending with a line feed
+static const int BASE64_QUADS_PER_LINE = 15;
+
+static const char base64Alphabet[] =
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+
+// Whether the value needs a 64-bit packed integer
+static bool
+isWide(MLINT64 value)
+{
+    return value < INT_MIN || value > INT_MAX;
+}
+
+
+/****************************************************************************
+* Output buffer
+***************************************************************************/
+
+void
+MeshLinkStreamWriter::openSink(MeshLinkSinkFunc sink, void *userData)
+{
+    sink_ = sink;
+    sinkData_ = userData;
+    buffer_.clear();
+    buffer_.reserve(bufferSize_);
+    ok_ = true;
+    openElements_.clear();
+    startTagOpen_ = false;
+    hasText_ = false;
+}
+
+
+bool
+MeshLinkStreamWriter::closeSink()
+{
+    if (nullptr == sink_) {
+        return ok_;
+    }
+    flush();
+    sink_ = nullptr;
+    sinkData_ = nullptr;
+    // Release the buffer between documents
+    std::vector<char>().swap(buffer_);
+    return ok_;
+}
+
+
+bool
+MeshLinkStreamWriter::flush()
+{
+    if (!buffer_.empty() && nullptr != sink_ && ok_) {
+        if (!sink_(buffer_.data(), buffer_.size(), sinkData_)) {
+            std::cout << "Failed writing MeshLink output." << std::endl;
+            ok_ = false;
+        }
+    }
+    buffer_.clear();
+    return ok_;
+}
+
+
+void
+MeshLinkStreamWriter::put(const char *str, size_t len)
+{
+    if (memory_) {
+        buffer_.insert(buffer_.end(), str, str + len);
+        return;
+    }
+    while (len > 0) {
+        size_t room = bufferSize_ - buffer_.size();
+        size_t n = (len < room ? len : room);
+        buffer_.insert(buffer_.end(), str, str + n);
+        str += n;
+        len -= n;
+        if (buffer_.size() >= bufferSize_) {
+            flush();
+        }
+    }
+}
+
+
+void
+MeshLinkStreamWriter::put(const char *str)
+{
+    put(str, strlen(str));
+}
+
+
+void
+MeshLinkStreamWriter::put(const std::string &str)
+{
+    put(str.data(), str.size());
+}
+
+
+// Serialize a part of the parent's document into memory, nested within
+// the parent's open elements. Parts serialized concurrently compress and
+// format on their own thread, as nested pool jobs run serially
+void
+MeshLinkStreamWriter::beginPart(const MeshLinkStreamWriter &parent)
+{
+    meshAssoc_ = parent.meshAssoc_;
+    compress_ = parent.compress_;
+    codec_ = parent.codec_;
+    memory_ = true;
+    buffer_.clear();
+    ok_ = true;
+    openElements_ = parent.openElements_;
+    startTagOpen_ = false;
+    hasText_ = false;
+}
+
+
+size_t
+MeshLinkStreamWriter::threadCount() const
+{
+    return ThreadPool::getConcurrency();
+}
+
+
+// Write character data, escaping markup characters (and quotes in
+// attribute values)
+void
+MeshLinkStreamWriter::putEscaped(const std::string &str, bool attribute)
+{
+    const char *start = str.data();
+    const char *end = start + str.size();
+    const char *run = start;
+    for (const char *c = start; c != end; ++c) {
+        const char *entity = nullptr;
+        switch (*c) {
+        case '&': entity = "&amp;"; break;
+        case '<': entity = "&lt;"; break;
+        case '>': entity = "&gt;"; break;
+        case '"':
+            if (attribute) {
+                entity = "&quot;";
+            }
+            break;
+        default:
+            break;
+        }
+        if (nullptr != entity) {
+            put(run, c - run);
+            put(entity);
+            run = c + 1;
+        }
+    }
+    put(run, end - run);
+}
+
+
+/****************************************************************************
+* Element emission
+***************************************************************************/
+
+void
+MeshLinkStreamWriter::indent()
+{
+    static const char spaces[] = "                                ";
+    size_t n = openElements_.size() * 2;
+    while (n > 0) {
+        size_t len = (n < sizeof(spaces) - 1 ? n : sizeof(spaces) - 1);
+        put(spaces, len);
+        n -= len;
+    }
+}
+
+
+void
+MeshLinkStreamWriter::startElement(const char *name)
+{
+    if (startTagOpen_) {
+        put(">\n");
+    }
+    indent();
+    put("<");
+    put(name);
+    openElements_.push_back(name);
+    startTagOpen_ = true;
+    hasText_ = false;
+}
+
+
+void
+MeshLinkStreamWriter::attribute(const char *name, const std::string &value)
+{
+    put(" ");
+    put(name);
+    put("=\"");
+    putEscaped(value, true);
+    put("\"");
+}
+
+
+void
+MeshLinkStreamWriter::attribute(const char *name, MLINT value)
+{
+    attribute(name, intString(value));
+}
+
+
+void
+MeshLinkStreamWriter::text(const std::string &str)
+{
+    if (startTagOpen_) {
+        put(">");
+        startTagOpen_ = false;
+    }
+    putEscaped(str, false);
+    hasText_ = true;
+}
+
+
+void
+MeshLinkStreamWriter::numericText(const char *str)
+{
+    if (startTagOpen_) {
+        put(">");
+        startTagOpen_ = false;
+    }
+    put(str);
+    hasText_ = true;
+}
+
+
+void
+MeshLinkStreamWriter::comment(const std::string &str)
+{
+    if (startTagOpen_) {
+        put(">\n");
+        startTagOpen_ = false;
+    }
+    indent();
+    put("<!--");
+    put(str);
+    put("-->\n");
+}
+
+
+void
+MeshLinkStreamWriter::endElement()
+{
+    if (openElements_.empty()) {
+        return;
+    }
+    const char *name = openElements_.back();
+    openElements_.pop_back();
+    if (startTagOpen_) {
+        put("/>\n");
+    }
+    else {
+        if (!hasText_) {
+            indent();
+        }
+        put("</");
+        put(name);
+        put(">\n");
+    }
+    startTagOpen_ = false;
+    hasText_ = false;
+}
+
+
+/****************************************************************************
+* Base64 text emission
+***************************************************************************/
+
+// Declare the packed array format, integer width (when not the default
+// 32), host byte order and compression codec (when compressed), then
+// begin the base64 text
+void
+MeshLinkStreamWriter::startBase64(int width)
+{
+    attribute("format", "base64");
+    if (64 == width) {
+        attribute("width", "64");
+    }
+    attribute("byteOrder", hostIsBigEndian() ? "big" : "little");
+    if (MeshLinkCompression::CodecNone != codec_) {
+        attribute("compression", MeshLinkCompression::getName(codec_));
+    }
+    text("\n\t");
+    base64PendingLen_ = 0;
+    base64LineQuads_ = 0;
+    uncompressed_.clear();
+    valueSize_ = width / 8;
+}
+
+
+// Start a section of packed values of another size, compressing the
+// pending bytes of the previous section
+void
+MeshLinkStreamWriter::base64ValueSize(size_t valueSize)
+{
+    if (MeshLinkCompression::CodecNone != codec_) {
+        compressPending(true);
+    }
+    valueSize_ = valueSize;
+}
+
+
+// Append packed bytes, compressing them when a batch of chunks is full
+void
+MeshLinkStreamWriter::base64Bytes(const void *data, size_t len)
+{
+    const unsigned char *bytes = (const unsigned char *)data;
+    if (MeshLinkCompression::CodecNone == codec_) {
+        encodeBase64(bytes, len);
+        return;
+    }
+    uncompressed_.insert(uncompressed_.end(), bytes, bytes + len);
+    if (uncompressed_.size() >=
+            MeshLinkCompression::DefaultChunkSize * threadCount()) {
+        compressPending(false);
+    }
+}
+
+
+// Compress and encode the pending bytes, all of them when final and
+// otherwise the whole chunks
+void
+MeshLinkStreamWriter::compressPending(bool final)
+{
+    const size_t chunkSize = MeshLinkCompression::DefaultChunkSize;
+    size_t len = uncompressed_.size();
+    if (!final) {
+        len -= len % chunkSize;
+    }
+    if (0 == len) {
+        return;
+    }
+    compressed_.clear();
+    if (!MeshLinkCompression::compress(codec_, uncompressed_.data(), len,
+            valueSize_, compressed_, chunkSize, threadCount())) {
+        ok_ = false;
+    }
+    encodeBase64(compressed_.data(), compressed_.size());
+    uncompressed_.erase(uncompressed_.begin(), uncompressed_.begin() + len);
+}
+
+
+// Base64 encode bytes, carrying a partial quad to the next call
+void
+MeshLinkStreamWriter::encodeBase64(const unsigned char *bytes, size_t len)
+{
+    for (size_t i = 0; i < len; ++i) {
+        base64Pending_[base64PendingLen_++] = bytes[i];
+        if (3 == base64PendingLen_) {
+            if (BASE64_QUADS_PER_LINE == base64LineQuads_) {
+                put("\n", 1);
+                base64LineQuads_ = 0;
+            }
+            const unsigned char *b = base64Pending_;
+            char quad[4];
+            quad[0] = base64Alphabet[b[0] >> 2];
+            quad[1] = base64Alphabet[((b[0] & 0x03) << 4) | (b[1] >> 4)];
+            quad[2] = base64Alphabet[((b[1] & 0x0f) << 2) | (b[2] >> 6)];
+            quad[3] = base64Alphabet[b[2] & 0x3f];
+            put(quad, 4);
+            ++base64LineQuads_;
+            base64PendingLen_ = 0;
+        }
+    }
+}
+
+
+// Append an integer packed at the given width
+void
+MeshLinkStreamWriter::base64Int(MLINT64 value, int width)
+{
+    if (64 == width) {
+        base64Bytes(&value, sizeof(value));
+    }
+    else {
+        MLINT32 narrow = (MLINT32)value;
+        base64Bytes(&narrow, sizeof(narrow));
+    }
+}
+
+
+// Pad the final quad and end the base64 text
+void
+MeshLinkStreamWriter::endBase64()
+{
+    if (MeshLinkCompression::CodecNone != codec_) {
+        compressPending(true);
+        std::vector<unsigned char>().swap(uncompressed_);
+        std::vector<unsigned char>().swap(compressed_);
+    }
+    if (base64PendingLen_ > 0) {
+        if (BASE64_QUADS_PER_LINE == base64LineQuads_) {
+            put("\n", 1);
+        }
+        const unsigned char *b = base64Pending_;
+        unsigned char b1 = (2 == base64PendingLen_ ? b[1] : 0);
+        char quad[4];
+        quad[0] = base64Alphabet[b[0] >> 2];
+        quad[1] = base64Alphabet[((b[0] & 0x03) << 4) | (b1 >> 4)];
+        quad[2] = (2 == base64PendingLen_ ?
+            base64Alphabet[(b1 & 0x0f) << 2] : '=');
+        quad[3] = '=';
+        put(quad, 4);
+        base64PendingLen_ = 0;
+    }
+    put("\n", 1);
+    text("\t");
+}
+
+
+/****************************************************************************
+* MeshAssociativity content
+***************************************************************************/
+
+bool
+MeshLinkStreamWriter::writeRootAttributes()
+{
+    std::vector<const MeshLinkAttribute *> atts = meshAssoc_->getAttributes();
+    for (auto att : atts) {
+        MLINT attID = att->getAttID();
+        const char *name{ nullptr };
+        const char *value{ nullptr };
+        meshAssoc_->getAttribute(attID, &name, &value);
+        if (nullptr != name && nullptr != value) {
+            startElement(att->isGroup() ? "AttributeGroup" : "Attribute");
+            attribute("attid", attID);
+            attribute("name", name);
+            text(value);
+            endElement();
+        }
+        else {
+            std::cout << "Failed to getAttribute (id: " << attID <<
+                ") name and/or value." << std::endl;
+        }
+    }
+    return true;
+}
+
+
+bool
+MeshLinkStreamWriter::writePeriodicInfo()
+{
+    std::vector<const MeshLinkTransform *> xforms;
+    meshAssoc_->getTransforms(xforms);
+    for (auto xform : xforms) {
+        startElement("Transform");
+        attribute("xid", xform->getXID());
+
+        const std::string &name = xform->getName();
+        if (!name.empty()) {
+            attribute("name", name);
+        }
+        if (xform->hasAref()) {
+            attribute("aref", xform->getAref());
+        }
+        const std::string &contents = xform->getContents();
+        if (!contents.empty()) {
+            text(contents);
+        }
+        endElement();
+    }
+
+    std::vector<MeshElementLinkage *> links;
+    meshAssoc_->getMeshElementLinkages(links);
+    for (auto link : links) {
+        startElement("MeshElementLinkage");
+        std::string sourceEntityRef;
+        std::string targetEntityRef;
+        link->getEntityRefs(sourceEntityRef, targetEntityRef);
+        attribute("sourceEntityRef", sourceEntityRef);
+        attribute("targetEntityRef", targetEntityRef);
+
+        const char *name{ nullptr };
+        link->getName(&name);
+        attribute("name", nullptr != name ? name : "");
+
+        if (link->hasAref()) {
+            attribute("aref", link->getAref());
+        }
+        MLINT xref;
+        if (link->getXref(&xref)) {
+            attribute("xref", xref);
+        }
+        endElement();
+    }
+    return true;
+}
+
+
+bool
+MeshLinkStreamWriter::writeGeometryRefs()
+{
+    MLINT id;
+    // Stores the GeometryGroup ids of GeometryReferences that are
+    // part of GeometryGroups
+    std::set<MLINT> groupIDs;
+
+    const std::vector<GeometryFile> &geomFiles =
+        meshAssoc_->getGeometryFiles();
+    for (const auto &geomFile : geomFiles) {
+        startElement("GeometryFile");
+        attribute("filename", geomFile.getFilename());
+        MLINT aref;
+        if (geomFile.getArefID(&aref)) {
+            attribute("aref", aref);
+        }
+
+        // Get the GeometryReferences
+        const std::vector<MLINT> &gids = geomFile.getGeometryGroupIDs();
+        for (auto gid : gids) {
+            GeometryGroup *group = meshAssoc_->getGeometryGroupByID(gid);
+            if (nullptr != group) {
+                startElement("GeometryReference");
+                attribute("gid", group->getID());
+                if (group->getArefID(&id)) {
+                    attribute("aref", id);
+                }
+                // Entity name - should only be one
+                const std::set<std::string> &names = group->getEntityNameSet();
+                attribute("ref", *names.begin());
+                endElement();
+                // Get the Group id and add to groupIDs set
+                MLINT groupID;
+                if (group->getGroupID(groupID)) {
+                    groupIDs.insert(groupID);
+                }
+            }
+        }
+        endElement();
+    }
+
+    // Geometry Group - we only know about them if they're in the groupIDs set
+    for (auto gid : groupIDs) {
+        GeometryGroup *group = meshAssoc_->getGeometryGroupByID(gid);
+        startElement("GeometryGroup");
+        attribute("gid", group->getID());
+        attribute("name", group->getName());
+        // ids of GeometryReferences that make this a group
+        const std::vector<MLINT> &ids = group->getGIDs();
+        if (!ids.empty()) {
+            std::string strIDs;
+            for (auto id : ids) {
+                strIDs += intString(id) + std::string(" ");
+            }
+            strIDs.pop_back();
+            text(strIDs);
+        }
+        endElement();
+    }
+    return true;
+}
+
+
+bool
+MeshLinkStreamWriter::writeParamVertexArray(const ParamVertVrefMap &vertMap)
+{
+    // Packed as vref[count], gref[count], mid[count] (when any vertex has
+    // an ID) as integers of the smallest width holding them, then
+    // uv[count*2] as doubles. Sized in a first pass, then streamed one
+    // section at a time
+    bool wide = false;
+    bool wideMids = false;
+    bool hasMids = false;
+    ParamVertVrefMap::const_iterator pvIter = vertMap.begin();
+    for (; pvIter != vertMap.end(); ++pvIter) {
+        const ParamVertex *vert = pvIter->second;
+        MLINT64 vref;
+        if (!toInt64(pvIter->first, vref)) {
+            // Not representable, fall back to ParamVertex elements
+            return false;
+        }
+        wide = wide || isWide(vref) || isWide(vert->getGref());
+        wideMids = wideMids || isWide(vert->getID());
+        if (MESH_TOPO_INVALID_REF != vert->getID()) {
+            hasMids = true;
+        }
+    }
+    int width = (wide || (hasMids && wideMids)) ? 64 : 32;
+
+    startElement("ParamVertexArray");
+    attribute("count", (MLINT)vertMap.size());
+    attribute("dim", "2");
+    if (hasMids) {
+        attribute("mids", "true");
+    }
+    startBase64(width);
+    MLINT64 vref;
+    for (pvIter = vertMap.begin(); pvIter != vertMap.end(); ++pvIter) {
+        toInt64(pvIter->first, vref);
+        base64Int(vref, width);
+    }
+    for (pvIter = vertMap.begin(); pvIter != vertMap.end(); ++pvIter) {
+        base64Int(pvIter->second->getGref(), width);
+    }
+    if (hasMids) {
+        for (pvIter = vertMap.begin(); pvIter != vertMap.end(); ++pvIter) {
+            base64Int(pvIter->second->getID(), width);
+        }
+    }
+    base64ValueSize(sizeof(double));
+    for (pvIter = vertMap.begin(); pvIter != vertMap.end(); ++pvIter) {
+        MLREAL u, v;
+        pvIter->second->getUV(&u, &v);
+        double uv[2] = { u, v };
+        base64Bytes(uv, sizeof(uv));
+    }
+    endBase64();
+    endElement();
+    return true;
+}
+
+
+bool
+MeshLinkStreamWriter::writeParamVertices(const ParamVertVrefMap &vertMap)
+{
+    if (0 == vertMap.size()) {
+        return false;
+    }
+
+    // Packed ParamVertexArray when compressing and representable
+    if (compress_ && writeParamVertexArray(vertMap)) {
+        return true;
+    }
+
+    // n ParameVertices, the UV text of a batch formatted in parallel
+    std::vector<MLREAL> uv;
+    std::vector<char> uvText;
+    std::vector<size_t> offsets;
+    ParamVertVrefMap::const_iterator pvIter = vertMap.begin();
+    while (pvIter != vertMap.end()) {
+        uv.clear();
+        ParamVertVrefMap::const_iterator batchIter = pvIter;
+        for (; batchIter != vertMap.end() && uv.size() < 2 * ParamVertexBatch;
+                ++batchIter) {
+            MLREAL u, v;
+            batchIter->second->getUV(&u, &v);
+            uv.push_back(u);
+            uv.push_back(v);
+        }
+        TextFormatter::formatRealTuples(uv.data(), uv.size() / 2, 2, uvText,
+            offsets, threadCount());
+
+        for (size_t i = 0; pvIter != batchIter; ++pvIter, ++i) {
+            const ParamVertex *vert = pvIter->second;
+            startElement("ParamVertex");
+            attribute("vref", pvIter->first);
+            if (MESH_TOPO_INVALID_REF < vert->getGref()) {
+                attribute("gref", vert->getGref());
+            }
+            if (MESH_TOPO_INVALID_REF < vert->getID()) {
+                attribute("mid", vert->getID());
+            }
+            attribute("dim", "2");
+            numericText(&uvText[offsets[i]]);
+            endElement();
+        }
+    }
+    return true;
+}
+
+
+bool
+MeshLinkStreamWriter::writeMeshPointReferences(MeshModel *meshModel)
+{
+    const ParamVertVrefMap &vertMap = meshModel->getParamVertVrefMap();
+    if (vertMap.empty()) {
+        return false;
+    }
+
+    // Write out MeshPointReference node first, then the ParamVertex nodes
+    // Common gref for MeshPointReference and each ParamVertex
+    MLINT gref = MESH_TOPO_INVALID_REF;
+    bool packed = compress_;
+    bool wide = false;
+    ParamVertVrefMap::const_iterator iter = vertMap.begin();
+    for (; iter != vertMap.end(); ++iter) {
+        if (MESH_TOPO_INVALID_REF == gref) {
+            gref = iter->second->getGref();
+        }
+        else if (gref != iter->second->getGref()) {
+            assert(0 == "MeshPointReference: grefs not identical");
+        }
+        // Packed ids when compressing and all ids are integers
+        MLINT64 id;
+        if (packed && toInt64(iter->first, id)) {
+            wide = wide || isWide(id);
+        }
+        else {
+            packed = false;
+        }
+    }
+
+    startElement("MeshPointReference");
+    attribute("gref", gref);
+    attribute("count", (MLINT)vertMap.size());
+    if (packed) {
+        int width = wide ? 64 : 32;
+        startBase64(width);
+        MLINT64 id;
+        for (iter = vertMap.begin(); iter != vertMap.end(); ++iter) {
+            toInt64(iter->first, id);
+            base64Int(id, width);
+        }
+        endBase64();
+    }
+    else {
+        size_t index = 1;
+        for (iter = vertMap.begin(); iter != vertMap.end(); ++iter, ++index) {
+            text(iter->first);
+            if (index < vertMap.size()) {
+                text(" ");
+            }
+        }
+    }
+    endElement();
+
+    // Now for the ParamVerts
+    writeParamVertices(vertMap);
+    return true;
+}
+
+
+bool
+MeshLinkStreamWriter::writeMeshFace(MeshTopo *container)
+{
+    MeshSheet *meshSheet = dynamic_cast<MeshSheet*>(container);
+    if (nullptr == meshSheet) {
+        return false;
+    }
+    std::vector<const MeshFace *> faces;
+    meshSheet->getMeshFaces(faces);
+    if (faces.empty()) {
+        return false;
+    }
+    size_t count = faces.size();
+    const MeshFace *face = faces[0];
+
+    // Check this face - if indices are not valid, this is a
+    // MeshFaceReference
+    MLINT numInds;
+    MLINT inds[4];
+    face->getInds(inds, &numInds);
+    bool reference = (0 == numInds);
+    MLINT faceType = reference ? count : numInds;
+    bool triFace = (3 == faceType);
+    int numPerFace = triFace ? 3 : 4;
+
+    // Packed index width from a first pass over the faces
+    int width = 32;
+    if (!reference && compress_) {
+        for (auto face : faces) {
+            face->getInds(inds, &numInds);
+            for (int i = 0; i < numPerFace && 32 == width; ++i) {
+                if (isWide(inds[i])) {
+                    width = 64;
+                }
+            }
+        }
+    }
+
+    startElement(reference ? "MeshFaceReference" : "MeshFace");
+    // Name is not written; the parser would assign it to every face
+    if (MESH_TOPO_INVALID_REF != face->getAref()) {
+        attribute("aref", face->getAref());
+    }
+    if (MESH_TOPO_INVALID_REF != face->getID()) {
+        attribute("mid", face->getID());
+    }
+    attribute("count", (MLINT)count);
+    attribute("etype", triFace ? "Tri3" : "Quad4");
+
+    if (!reference && compress_) {
+        startBase64(width);
+        for (auto face : faces) {
+            face->getInds(inds, &numInds);
+            for (int i = 0; i < numPerFace; ++i) {
+                base64Int(inds[i], width);
+            }
+        }
+        endBase64();
+    }
+    else {
+        attribute("format", "text");
+        text("\n\t ");
+        size_t index = 1;
+        for (auto face : faces) {
+            std::string str;
+            if (!reference) {
+                face->getInds(inds, &numInds);
+                str = intString(inds[0]) + " " + intString(inds[1]) + " " +
+                    intString(inds[2]);
+                if (!triFace) {
+                    str += " " + intString(inds[3]);
+                }
+                str += (index == count ? "\n\t" : "\n\t ");
+            }
+            else {
+                str = face->getRef();
+                str += (index == count ? "\n\t" : " ");
+            }
+            text(str);
+            ++index;
+        }
+    }
+    endElement();
+    return true;
+}
+
+
+bool
+MeshLinkStreamWriter::writeMeshEdge(MeshTopo *container)
+{
+    MeshString *meshString = dynamic_cast<MeshString*>(container);
+    if (nullptr == meshString) {
+        return false;
+    }
+    std::vector<const MeshEdge *> edges;
+    meshString->getMeshEdges(edges);
+    if (edges.empty()) {
+        return false;
+    }
+    size_t count = edges.size();
+    const MeshEdge *edge = edges[0];
+    MLINT numInds;
+    MLINT inds[2];
+    edge->getInds(inds, &numInds);
+    bool reference = (0 == numInds);
+
+    // Packed index width from a first pass over the edges
+    int width = 32;
+    if (!reference && compress_) {
+        for (auto edge : edges) {
+            edge->getInds(inds, &numInds);
+            if (isWide(inds[0]) || isWide(inds[1])) {
+                width = 64;
+                break;
+            }
+        }
+    }
+
+    startElement(reference ? "MeshEdgeReference" : "MeshEdge");
+    if (MESH_TOPO_INVALID_REF != edge->getAref()) {
+        attribute("aref", edge->getAref());
+    }
+    if (MESH_TOPO_INVALID_REF != edge->getID()) {
+        attribute("mid", edge->getID());
+    }
+    attribute("etype", "Edge2");
+    attribute("count", (MLINT)count);
+
+    if (!reference && compress_) {
+        startBase64(width);
+        for (auto edge : edges) {
+            edge->getInds(inds, &numInds);
+            base64Int(inds[0], width);
+            base64Int(inds[1], width);
+        }
+        endBase64();
+    }
+    else {
+        attribute("format", "text");
+        size_t index = 1;
+        for (auto edge : edges) {
+            std::string str;
+            if (!reference) {
+                edge->getInds(inds, &numInds);
+                str = intString(inds[0]) + " " + intString(inds[1]);
+            }
+            else {
+                str = edge->getRef();
+            }
+            if (index < count) {
+                str += " ";
+            }
+            text(str);
+            ++index;
+        }
+    }
+    endElement();
+    return true;
+}
+
+
+bool
+MeshLinkStreamWriter::writeMeshContainer(const char *elemName,
+    MeshTopo *container, TopoWriter writeTopo)
+{
+    startElement(elemName);
+    attribute("name", container->getName());
+    if (MESH_TOPO_INVALID_REF != container->getGref()) {
+        attribute("gref", container->getGref());
+    }
+    if (MESH_TOPO_INVALID_REF != container->getAref()) {
+        attribute("aref", container->getAref());
+    }
+    if (MESH_TOPO_INVALID_REF != container->getID()) {
+        attribute("mid", container->getID());
+    }
+    writeParamVertices(container->getParamVertVrefMap());
+    (this->*writeTopo)(container);
+    endElement();
+    return ok_;
+}
+
+
+// Write the MeshSheet or MeshString elements of a model. A round of
+// containers is serialized concurrently, each into its own buffer, and
+// the buffers are then written in order
+bool
+MeshLinkStreamWriter::writeMeshContainers(const char *elemName,
+    const std::vector<MeshTopo *> &containers, TopoWriter writeTopo)
+{
+    size_t numThreads = std::min(threadCount(), containers.size());
+    if (numThreads <= 1) {
+        for (auto container : containers) {
+            writeMeshContainer(elemName, container, writeTopo);
+        }
+        return ok_;
+    }
+
+    // The containers follow the model's start tag
+    if (startTagOpen_) {
+        put(">\n");
+        startTagOpen_ = false;
+    }
+    size_t roundSize = numThreads * ContainersPerThread;
+    for (size_t first = 0; first < containers.size(); first += roundSize) {
+        size_t count = std::min(roundSize, containers.size() - first);
+        std::vector<std::unique_ptr<MeshLinkStreamWriter> > parts(count);
+        for (size_t i = 0; i < count; ++i) {
+            parts[i].reset(new MeshLinkStreamWriter());
+            parts[i]->beginPart(*this);
+        }
+
+        ThreadPool::parallelFor(count, [&](size_t i) {
+            parts[i]->writeMeshContainer(elemName, containers[first + i],
+                writeTopo);
+        });
+
+        for (size_t i = 0; i < count; ++i) {
+            put(parts[i]->buffer_.data(), parts[i]->buffer_.size());
+            ok_ = ok_ && parts[i]->ok_;
+            parts[i].reset();
+        }
+    }
+    return ok_;
+}
+
+
+#define WriteMeshContainer(MeshObj, TopoType)                           \
+{                                                                       \
+    std::vector<MeshObj *> objs;                                        \
+    meshModelRef->get##MeshObj##s(objs);                                \
+    std::vector<MeshTopo *> containers(objs.begin(), objs.end());       \
+    writeMeshContainers(#MeshObj, containers,                           \
+        &MeshLinkStreamWriter::write##TopoType);                        \
+}
+
+
+bool
+MeshLinkStreamWriter::writeMeshFiles()
+{
+    const std::vector<MeshFile> &meshFiles = meshAssoc_->getMeshFiles();
+    for (const auto &meshFile : meshFiles) {
+        startElement("MeshFile");
+        attribute("filename", meshFile.getFilename());
+
+        // 1-n MeshModelReferences
+        const std::vector<std::string> &modelRefs = meshFile.getModelRefs();
+        for (const auto &ref : modelRefs) {
+            MeshModel *meshModelRef = meshAssoc_->getMeshModelByRef(ref.c_str());
+            startElement("MeshModelReference");
+            attribute("ref", meshModelRef->getRef());
+            const std::string &name = meshModelRef->getName();
+            if (!name.empty()) {
+                attribute("name", name);
+            }
+            if (MESH_TOPO_INVALID_REF != meshModelRef->getGref()) {
+                attribute("gref", meshModelRef->getGref());
+            }
+            if (MESH_TOPO_INVALID_REF != meshModelRef->getAref()) {
+                attribute("aref", meshModelRef->getAref());
+            }
+            if (MESH_TOPO_INVALID_REF != meshModelRef->getID()) {
+                attribute("mid", meshModelRef->getID());
+            }
+
+            // n MeshPoints
+            writeMeshPointReferences(meshModelRef);
+
+            // n Mesh sheets
+            WriteMeshContainer(MeshSheet, MeshFace);
+
+            // n Mesh strings
+            WriteMeshContainer(MeshString, MeshEdge);
+
+            endElement();
+        }
+        endElement();
+    }
+    return ok_;
+}
+
+
+// Write MeshAssociativity to MeshLink file (XML roundtrip)
+bool
+MeshLinkStreamWriter::writeMeshLinkFile(const std::string &fname,
+    MeshAssociativity *meshAssociativity, bool compress, bool terminatePlatform)
+{
+    MeshLinkFileOutput output;
+    if (!output.open(fname)) {
+        return false;
+    }
+    bool result = writeMeshLinkSink(meshAssociativity,
+        MeshLinkFileOutput::write, &output, compress, terminatePlatform);
+    if (!output.close(result)) {
+        return false;
+    }
+    std::cout << "Completed writing " << fname << std::endl;
+    return true;
+}
+
+
+// Write MeshAssociativity to an output sink (XML roundtrip)
+bool
+MeshLinkStreamWriter::writeMeshLinkSink(MeshAssociativity *meshAssociativity,
+    MeshLinkSinkFunc sink, void *userData, bool compress,
+    bool terminatePlatform)
+{
+    if (nullptr != meshAssociativity) {
+        meshAssoc_ = meshAssociativity;
+    }
+    if (nullptr == meshAssoc_) {
+        std::cout << "Meshassociativity can't be null.\n";
+        return false;
+    }
+    if (nullptr == sink) {
+        return false;
+    }
+    compress_ = compress;
+
+    closeSink();
+    openSink(sink, userData);
+    bool result = writeDocument();
+    return closeSink() && result;
+}
+
+
+// Write the document to the open sink
+bool
+MeshLinkStreamWriter::writeDocument()
+{
+    bool result = true;
+
+    put("<?xml version=\"1.0\" encoding=\"UTF-8\" standalone=\"yes\" ?>\n");
+    startElement("MeshLink");
+    attribute("xmlns", NSStr);
+    attribute("version", "1.0");
+    if (!xmlns_xsi_.empty()) {
+        attribute("xmlns:xsi", xmlns_xsi_);
+    }
+    if (!schemaLocation_.empty()) {
+        attribute("xsi:schemaLocation", schemaLocation_);
+    }
+
+    // Date/Time
+    std::time_t t = std::time(nullptr);
+    std::string time = ctime(&t);
+    time.pop_back();
+    comment(time);
+
+    // Attribute and AttributeGroup elements
+    if (!writeRootAttributes()) {
+        std::cout << "Failed to write Mesh Link root attributes." << std::endl;
+        result = false;
+    }
+
+    if (result && !writeGeometryRefs()) {
+        std::cout << "Failed to write Geometry references." << std::endl;
+        result = false;
+    }
+
+    if (result && !writeMeshFiles()) {
+        std::cout << "Failed to write Mesh Files." << std::endl;
+        result = false;
+    }
+
+    // Transform and MeshElementLinkage elements
+    if (result && !writePeriodicInfo()) {
+        std::cout << "Failed to write Mesh Link transform and linkage info." << std::endl;
+        result = false;
+    }
+
+    endElement();
+    return result;
+}
+
+/****************************************************************************
+ *
+ * This file is licensed under the Cadence Public License Version 1.0 (the
+ * "License"), a copy of which is found in the included file named "LICENSE",
+ * and is distributed "AS IS." TO THE MAXIMUM EXTENT PERMITTED BY APPLICABLE
+ * LAW, CADENCE DISCLAIMS ALL WARRANTIES AND IN NO EVENT SHALL BE LIABLE TO
+ * ANY PARTY FOR ANY DAMAGES ARISING OUT OF OR RELATING TO USE OF THIS FILE.
+ * Please see the License for the full text of applicable terms.
+ *
+ ****************************************************************************/
@@ -0,0 +1,209 @@
+/****************************************************************************
+ *
+ * (C) 2021 Cadence Design Systems, Inc. All rights reserved worldwide.
+ *
+ * This sample source code is not supported by Cadence Design Systems, Inc.
+ * It is provided freely for demonstration purposes only.
+ * SEE THE WARRANTY DISCLAIMER AT THE BOTTOM OF THIS FILE.
+ *
+ ***************************************************************************/
+
+#ifndef MESH_LINK_STREAM_WRITER
+#define MESH_LINK_STREAM_WRITER
+
+#include "Types.h"
+#include "MeshLinkWriter.h"
+#include "MeshLinkCompression.h"
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+
+class MeshAssociativity;
+class MeshModel;
+class MeshTopo;
+
+
+/****************************************************************************
+* MeshLinkStreamWriter class
+***************************************************************************/
+/**
+* \class MeshLinkStreamWriter
+*
+* \brief A MeshLink data writer emitting XML directly to a file
+*
+* Walks the MeshAssociativity and writes each element as it is visited
+* through a fixed size output buffer, without building a DOM document.
+* Memory use is bounded by the buffer size and the largest single mesh
+* topology container rather than by the size of the document.
+*
+* The elements, attributes and data written match MeshLinkWriterXerces;
+* only insignificant whitespace may differ.
+*/
+class MeshLinkStreamWriter : public MeshLinkWriter {
+public:
+    MeshLinkStreamWriter()
+    {
+    }
+
+    MeshLinkStreamWriter(const std::string &xmlns, const std::string &xmlns_xsi,
+        const std::string &schemaLocation):
+        xmlns_(xmlns),
+        xmlns_xsi_(xmlns_xsi),
+        schemaLocation_(schemaLocation)
+    {}
+    ~MeshLinkStreamWriter()
+    {
+        closeSink();
+    }
+
+    /// \brief Write MeshAssociativity data to a MeshLink XML file
+    ///
+    /// Files whose names end in ".gz" are written gzip-compressed
+    /// (see MeshLinkFileOutput). The terminatePlatform argument is accepted for interface
+    /// compatibility; this writer does not use the Xerces platform.
+    bool writeMeshLinkFile(const std::string &fname,
+        MeshAssociativity *meshAssociativity, bool compress=true,
+        bool terminatePlatform=true) override;
+
+    /// \brief Write MeshAssociativity data to an output sink
+    ///
+    /// The sink receives the output buffer each time it fills.
+    bool writeMeshLinkSink(MeshAssociativity *meshAssociativity,
+        MeshLinkSinkFunc sink, void *userData, bool compress=true,
+        bool terminatePlatform=true) override;
+
+    // Need to provide these if using the default constructor (C API
+    // call), otherwise XML file will not validate
+    bool setMeshLinkAttributes(const std::string &xmlns,
+        const std::string &xmlns_xsi, const std::string &schemaLocation) override
+    {
+        xmlns_ = xmlns;
+        xmlns_xsi_ = xmlns_xsi;
+        schemaLocation_ = schemaLocation;
+        return true;
+    }
+
+    /// \brief Set the size in bytes of the output buffer
+    ///
+    /// The buffer is written to the file or sink each time it fills.
+    void setBufferSize(size_t size)
+    {
+        bufferSize_ = (size > 0 ? size : 1);
+    }
+
+    /// \brief Set the codec compressing packed binary arrays
+    ///
+    /// Used when writing with compress true. Defaults to the best codec
+    /// available; CodecNone writes uncompressed base64 arrays.
+    /// \return false if the codec is not available in this build
+    bool setCompressionCodec(MeshLinkCompression::Codec codec)
+    {
+        if (!MeshLinkCompression::isAvailable(codec)) {
+            return false;
+        }
+        codec_ = codec;
+        return true;
+    }
+
+private:
+    typedef bool (MeshLinkStreamWriter::*TopoWriter)(MeshTopo *container);
+
+    // Output buffer
+    void openSink(MeshLinkSinkFunc sink, void *userData);
+    bool closeSink();
+    bool flush();
+    void put(const char *str, size_t len);
+    void put(const char *str);
+    void put(const std::string &str);
+    void putEscaped(const std::string &str, bool attribute);
+    void beginPart(const MeshLinkStreamWriter &parent);
+    size_t threadCount() const;
+
+    // Element emission
+    void startElement(const char *name);
+    void attribute(const char *name, const std::string &value);
+    void attribute(const char *name, MLINT value);
+    void text(const std::string &str);
+    // Text of numbers, which need no escaping
+    void numericText(const char *str);
+    void comment(const std::string &str);
+    void endElement();
+    void indent();
+
+    // Base64 text emission
+    void startBase64(int width);
+    void base64Bytes(const void *data, size_t len);
+    void base64Int(MLINT64 value, int width);
+    void endBase64();
+    void base64ValueSize(size_t valueSize);
+    void encodeBase64(const unsigned char *bytes, size_t len);
+    void compressPending(bool final);
+
+    bool writeDocument();
+    bool writeRootAttributes();
+    bool writePeriodicInfo();
+    bool writeGeometryRefs();
+    bool writeMeshFiles();
+
+    bool writeParamVertices(const ParamVertVrefMap &vertMap);
+    bool writeParamVertexArray(const ParamVertVrefMap &vertMap);
+    bool writeMeshFace(MeshTopo *container);
+    bool writeMeshEdge(MeshTopo *container);
+    bool writeMeshPointReferences(MeshModel *meshModel);
+    bool writeMeshContainer(const char *elemName, MeshTopo *container,
+        TopoWriter writeTopo);
+    bool writeMeshContainers(const char *elemName,
+        const std::vector<MeshTopo *> &containers, TopoWriter writeTopo);
+
+    bool compress_ { false };
+    MeshAssociativity *meshAssoc_ { nullptr };
+
+    MeshLinkSinkFunc sink_ { nullptr };
+    void *sinkData_ { nullptr };
+    std::vector<char> buffer_;
+    size_t bufferSize_ { 1 << 20 };
+    bool ok_ { true };
+    // Part of the document serialized into memory, the buffer holding
+    // all of its output
+    bool memory_ { false };
+
+    // Names of the open elements, innermost last
+    std::vector<const char *> openElements_;
+    // Start tag of the innermost element not yet closed with '>'
+    bool startTagOpen_ { false };
+    // Innermost element has text content
+    bool hasText_ { false };
+
+    // Packed bytes awaiting block compression, compressed a batch of
+    // whole chunks at a time
+    MeshLinkCompression::Codec codec_ { MeshLinkCompression::getDefaultCodec() };
+    std::vector<unsigned char> uncompressed_;
+    size_t valueSize_ { 4 };
+    std::vector<unsigned char> compressed_;
+
+    // Pending base64 input bytes and output line position
+    unsigned char base64Pending_[3];
+    int base64PendingLen_ { 0 };
+    int base64LineQuads_ { 0 };
+
+    // Parsed Xml 'header' attributes cached for use when writing out
+    // Xml file based on parsed/modified Meshassociativity. Supports
+    // 'round tripping' of MeshLink files
+    std::string xmlns_;
+    std::string xmlns_xsi_;
+    std::string schemaLocation_;
+};
+#endif // MESH_LINK_STREAM_WRITER
+
+/****************************************************************************
+ *
+ * This file is licensed under the Cadence Public License Version 1.0 (the
+ * "License"), a copy of which is found in the included file named "LICENSE",
+ * and is distributed "AS IS." TO THE MAXIMUM EXTENT PERMITTED BY APPLICABLE
+ * LAW, CADENCE DISCLAIMS ALL WARRANTIES AND IN NO EVENT SHALL BE LIABLE TO
+ * ANY PARTY FOR ANY DAMAGES ARISING OUT OF OR RELATING TO USE OF THIS FILE.
+ * Please see the License for the full text of applicable terms.
+ *
+ ****************************************************************************/
@@ -12,7 +12,16 @@
 
 
 #include "MeshLinkWriter_xerces.h"
-
+#include "MeshLinkInternal.h"
+#include "MeshLinkOutput.h"
+#include "TextFormatter.h"
+#include "ThreadPool.h"
+#include "XercesPlatformSession.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <climits>
 #include <ctime>
 #include <iostream>
 #include <iomanip>
@@ -32,55 +41,13 @@
 #include <xercesc/dom/DOMImplementation.hpp>
 #include <xercesc/dom/DOMLSSerializer.hpp>
 #include <xercesc/dom/DOMLSOutput.hpp>
-#include <xercesc/framework/MemBufFormatTarget.hpp>
+#include <xercesc/framework/XMLFormatter.hpp>
 #include <xercesc/util/XercesDefs.hpp>
 #include <xercesc/util/XMLUni.hpp>
 #include <xercesc/util/Base64.hpp>
-#include <fstream>
 
 using namespace xercesc;
 
-static const int MAX_ID = 1024;
-
-class PlatformGuard {
-public:
-    PlatformGuard(bool terminate) :
-        terminate_(terminate),
-        init_(false)
-    {
-        init();
-    }
-
-    ~PlatformGuard()
-    {
-        if (terminate_ && init_) {
-            XMLPlatformUtils::Terminate();
-            std::cout << "Successfully terminated xerces API." << std::endl;
-        }
-    }
-
-    operator bool()
-    {
-        return init_;
-    }
-private:
-    void init()
-    {
-        init_ = true;
-        try {
-            XMLPlatformUtils::Initialize();
-            std::cout << "Successfully initialized xerces API." << std::endl;
-        }
-        catch (const XMLException &) {
-            std::cout << "Failed to initialize xerces API." << std::endl;
-            init_ = false;
-        }
-    }
-
-    bool terminate_;
-    bool init_;
-};
-
 // Replaces xerces XMLString::transcode() method to take care of
 // releasing the transcoded result automatically (inefficent but convenient!)
 template <typename T, typename U>
@@ -116,8 +83,6 @@ private:
     U *val_;
 };
 
-static const char *NSStr{"https://pointwise.com"};
-
 // Very temporary - use in function calls only
 #define X(str) XMLCopier<char, XMLCh>(str).convert()
 #define Char(str) XMLCopier<XMLCh, char>(str).convert()
@@ -249,7 +214,7 @@ MeshLinkWriterXerces::writeGeometryRefs()
     // Process the GeometryFiles
     const std::vector<GeometryFile> &geomFiles =
         meshAssoc_->getGeometryFiles();
-    for (auto geomFile : geomFiles) {
+    for (const auto &geomFile : geomFiles) {
         // Create DOMElement for each geometry file
         DOMElement *fileElement = meshDoc_->createElementNS(X(NSStr),
             X("GeometryFile"));
@@ -260,7 +225,7 @@ MeshLinkWriterXerces::writeGeometryRefs()
         }
 
         // Get the GeometryReferences
-        std::vector<MLINT> gids = geomFile.getGeometryGroupIDs();
+        const std::vector<MLINT> &gids = geomFile.getGeometryGroupIDs();
         for (auto gid : gids) {
             GeometryGroup *group = meshAssoc_->getGeometryGroupByID(gid);
             if (nullptr != group) {
@@ -317,49 +282,238 @@ MeshLinkWriterXerces::writeGeometryRefs()
 }
 
 
+// Smallest integer width (32 or 64 bits) holding all of the values
+static int
+packedWidth(const std::vector<MLINT64> &values)
+{
+    for (auto val : values) {
+        if (val < INT_MIN || val > INT_MAX) {
+            return 64;
+        }
+    }
+    return 32;
+}
+
+
+// Append raw bytes to the byte buffer of a packed binary array
+template<typename T>
+static void
+appendBytes(std::vector<XMLByte> &bytes, const std::vector<T> &data)
+{
+    const XMLByte *first = (const XMLByte *)data.data();
+    bytes.insert(bytes.end(), first, first + data.size() * sizeof(T));
+}
+
+
+// Append integers packed at the given width to a packed binary array
+static void
+appendInts(std::vector<XMLByte> &bytes, const std::vector<MLINT64> &values,
+    int width)
+{
+    if (64 == width) {
+        appendBytes(bytes, values);
+    }
+    else {
+        std::vector<MLINT32> narrow(values.begin(), values.end());
+        appendBytes(bytes, narrow);
+    }
+}
+
+
+// Prepare bytes of a packed binary array as base64 text, declaring the
+// integer width (when not the default 32), the host byte order and the
+// block compression codec (when compressed). Bytes from realOffset on
+// are doubles, compressed separately from the integers.
 bool
-MeshLinkWriterXerces::writeParamVertices(xercesc_3_2::DOMElement *node,
-    const ParamVertVrefMap &vertMap)
+MeshLinkWriterXerces::formatBase64Text(const std::vector<XMLByte> &bytes,
+    int width, size_t realOffset, size_t numThreads, ElementContent &content)
 {
-    if (nullptr == node || 0 == vertMap.size()) {
+    std::vector<XMLByte> compressed;
+    const std::vector<XMLByte> *payload = &bytes;
+    if (MeshLinkCompression::CodecNone != codec_) {
+        size_t intBytes = std::min(realOffset, bytes.size());
+        if (!MeshLinkCompression::compress(codec_, bytes.data(), intBytes,
+                width / 8, compressed, MeshLinkCompression::DefaultChunkSize,
+                numThreads) ||
+            !MeshLinkCompression::compress(codec_, bytes.data() + intBytes,
+                bytes.size() - intBytes, sizeof(double), compressed,
+                MeshLinkCompression::DefaultChunkSize, numThreads)) {
+            return false;
+        }
+        payload = &compressed;
+    }
+    XMLByte *encodedData{ nullptr };
+    XMLSize_t len = 0;
+    try {
+        encodedData = Base64::encode(payload->data(), payload->size(), &len);
+    }
+    catch (...) {
+        std::cout << "Base64 encoding failed.\n";
+        return false;
+    }
+    if (nullptr == encodedData || 0 == len) {
+        std::cout << "Failed to encode binary data.\n";
+        return false;
+    }
+    content.atts.push_back(std::make_pair("format", "base64"));
+    if (64 == width) {
+        content.atts.push_back(std::make_pair("width", "64"));
+    }
+    content.atts.push_back(std::make_pair("byteOrder",
+        hostIsBigEndian() ? "big" : "little"));
+    if (MeshLinkCompression::CodecNone != codec_) {
+        content.atts.push_back(std::make_pair("compression",
+            MeshLinkCompression::getName(codec_)));
+    }
+    content.text = "\n\t";
+    content.text.append((const char *)encodedData, len);
+    content.text += "\t";
+    XMLString::release((char**)(&encodedData));
+    return true;
+}
+
+
+// Set the prepared attributes and text of an element
+void
+MeshLinkWriterXerces::setContent(xercesc_3_2::DOMElement *node,
+    const ElementContent &content)
+{
+    for (const auto &att : content.atts) {
+        node->setAttribute(X(att.first.c_str()), X(att.second.c_str()));
+    }
+    if (!content.text.empty()) {
+        node->appendChild(meshDoc_->createTextNode(X(content.text.c_str())));
+    }
+}
+
+
+// Store bytes of a packed binary array as base64 text
+bool
+MeshLinkWriterXerces::appendBase64Text(xercesc_3_2::DOMElement *node,
+    const std::vector<XMLByte> &bytes, int width, size_t realOffset)
+{
+    ElementContent content;
+    if (!formatBase64Text(bytes, width, realOffset, 0, content)) {
         return false;
     }
+    setContent(node, content);
+    return true;
+}
 
-    // n ParameVertices
+
+bool
+MeshLinkWriterXerces::writeParamVertexArray(xercesc_3_2::DOMElement *node,
+    const ParamVertVrefMap &vertMap)
+{
+    // Packed as vref[count], gref[count], mid[count] (when any vertex has
+    // an ID) as integers of the smallest width holding them, then
+    // uv[count*2] as doubles
+    size_t count = vertMap.size();
+    std::vector<MLINT64> ints;
+    std::vector<MLINT64> vrefs, grefs, mids;
+    std::vector<double> uvs;
+    vrefs.reserve(count);
+    grefs.reserve(count);
+    mids.reserve(count);
+    uvs.reserve(count * 2);
+    bool hasMids = false;
     ParamVertVrefMap::const_iterator pvIter = vertMap.begin();
-    while (pvIter != vertMap.end()) {
-        DOMElement *vertex = meshDoc_->createElementNS(X(NSStr), X("ParamVertex"));
-        const std::string &vref = pvIter->first;
+    for (; pvIter != vertMap.end(); ++pvIter) {
         const ParamVertex *vert = pvIter->second;
-        vertex->setAttribute(X("vref"), X(vref.c_str()));
-        if (MESH_TOPO_INVALID_REF < vert->getGref()) {
-            setUintAtt(vert->getGref(), vertex, "gref");
+        MLINT64 vref;
+        if (!toInt64(pvIter->first, vref)) {
+            // Not representable, fall back to ParamVertex elements
+            return false;
         }
-        if (MESH_TOPO_INVALID_REF < vert->getID()) {
-            setUintAtt(vert->getID(), vertex, "mid");
+        vrefs.push_back(vref);
+        grefs.push_back(vert->getGref());
+        mids.push_back(vert->getID());
+        if (MESH_TOPO_INVALID_REF != vert->getID()) {
+            hasMids = true;
         }
-        vertex->setAttribute(X("dim"), X("2"));
         MLREAL u, v;
         vert->getUV(&u, &v);
-        char buf[128];
-        sprintf(buf, "%.15g %.15g", u, v);
-        DOMText *textNode = meshDoc_->createTextNode(X(buf));
-        vertex->appendChild(textNode);
-        node->appendChild(vertex);
-        ++pvIter;
+        uvs.push_back(u);
+        uvs.push_back(v);
+    }
+
+    ints.reserve(count * 3);
+    ints.insert(ints.end(), vrefs.begin(), vrefs.end());
+    ints.insert(ints.end(), grefs.begin(), grefs.end());
+    if (hasMids) {
+        ints.insert(ints.end(), mids.begin(), mids.end());
+    }
+    int width = packedWidth(ints);
+    std::vector<XMLByte> bytes;
+    appendInts(bytes, ints, width);
+    size_t realOffset = bytes.size();
+    appendBytes(bytes, uvs);
+
+    DOMElement *array = meshDoc_->createElementNS(X(NSStr),
+        X("ParamVertexArray"));
+    setUintAtt(count, array, "count");
+    array->setAttribute(X("dim"), X("2"));
+    if (hasMids) {
+        array->setAttribute(X("mids"), X("true"));
     }
+    if (!appendBase64Text(array, bytes, width, realOffset)) {
+        array->release();
+        return false;
+    }
+    node->appendChild(array);
     return true;
 }
 
 
-static XMLSize_t
-encodeCData(std::vector<int> &data, XMLByte *&encodedData)
+bool
+MeshLinkWriterXerces::writeParamVertices(xercesc_3_2::DOMElement *node,
+    const ParamVertVrefMap &vertMap)
 {
-    XMLSize_t length;
-    size_t bytesToEncode = data.size() * sizeof(int);
-    encodedData = Base64::encode((XMLByte *)(data.data()), bytesToEncode, &length);
+    if (nullptr == node || 0 == vertMap.size()) {
+        return false;
+    }
+
+    // Packed ParamVertexArray when compressing and representable
+    if (compress_ && writeParamVertexArray(node, vertMap)) {
+        return true;
+    }
 
-    return length;
+    // n ParameVertices, the UV text of a batch formatted in parallel
+    std::vector<MLREAL> uv;
+    std::vector<char> text;
+    std::vector<size_t> offsets;
+    ParamVertVrefMap::const_iterator pvIter = vertMap.begin();
+    while (pvIter != vertMap.end()) {
+        uv.clear();
+        ParamVertVrefMap::const_iterator batchIter = pvIter;
+        for (; batchIter != vertMap.end() && uv.size() < 2 * ParamVertexBatch;
+                ++batchIter) {
+            MLREAL u, v;
+            batchIter->second->getUV(&u, &v);
+            uv.push_back(u);
+            uv.push_back(v);
+        }
+        TextFormatter::formatRealTuples(uv.data(), uv.size() / 2, 2, text,
+            offsets);
+
+        for (size_t i = 0; pvIter != batchIter; ++pvIter, ++i) {
+            DOMElement *vertex = meshDoc_->createElementNS(X(NSStr), X("ParamVertex"));
+            const std::string &vref = pvIter->first;
+            const ParamVertex *vert = pvIter->second;
+            vertex->setAttribute(X("vref"), X(vref.c_str()));
+            if (MESH_TOPO_INVALID_REF < vert->getGref()) {
+                setUintAtt(vert->getGref(), vertex, "gref");
+            }
+            if (MESH_TOPO_INVALID_REF < vert->getID()) {
+                setUintAtt(vert->getID(), vertex, "mid");
+            }
+            vertex->setAttribute(X("dim"), X("2"));
+            DOMText *textNode = meshDoc_->createTextNode(X(&text[offsets[i]]));
+            vertex->appendChild(textNode);
+            node->appendChild(vertex);
+        }
+    }
+    return true;
 }
 
 
@@ -392,6 +546,33 @@ MeshLinkWriterXerces::writeMeshPointReferences(xercesc_3_2::DOMElement *model,
     }
     setUintAtt(gref, node, "gref");
     setUintAtt(ids.size(), node, "count");
+
+    // Packed ids when compressing and all ids are integers
+    std::vector<MLINT64> intIDs;
+    if (compress_) {
+        intIDs.reserve(ids.size());
+        MLINT64 id;
+        for (auto &str : ids) {
+            if (!toInt64(str, id)) {
+                intIDs.clear();
+                break;
+            }
+            intIDs.push_back(id);
+        }
+    }
+    if (!intIDs.empty()) {
+        int width = packedWidth(intIDs);
+        std::vector<XMLByte> bytes;
+        appendInts(bytes, intIDs, width);
+        if (!appendBase64Text(node, bytes, width)) {
+            node->release();
+            return false;
+        }
+        model->appendChild(node);
+        writeParamVertices(model, vertMap);
+        return true;
+    }
+
     std::ostringstream os;
     size_t index = 1;
     for (auto id : ids) {
@@ -411,9 +592,11 @@ MeshLinkWriterXerces::writeMeshPointReferences(xercesc_3_2::DOMElement *model,
 }
 
 
+// Prepare the MeshFace or MeshFaceReference element of a sheet. A sheet
+// without faces has no element and leaves the content name empty
 bool
-MeshLinkWriterXerces::writeMeshFace(xercesc_3_2::DOMElement *sheet,
-    MeshTopo *container)
+MeshLinkWriterXerces::formatMeshFace(MeshTopo *container, size_t numThreads,
+    ElementContent &content)
 {
     MeshSheet *meshSheet = dynamic_cast<MeshSheet*>(container);
     if (nullptr == meshSheet) {
@@ -422,7 +605,8 @@ MeshLinkWriterXerces::writeMeshFace(xercesc_3_2::DOMElement *sheet,
     std::vector<const MeshFace *> faces;
     meshSheet->getMeshFaces(faces);
     if (faces.empty()) {
-        return false;
+        // No MeshFace element
+        return true;
     }
     size_t count = faces.size();
     const MeshFace *face = faces[0]; // no bounds checking using []
@@ -430,130 +614,104 @@ MeshLinkWriterXerces::writeMeshFace(xercesc_3_2::DOMElement *sheet,
     // Check this face - if indices are not valid, this is a
     // MeshFaceReference
     MLINT numInds;
-    MLINT *inds = new MLINT[4];
+    MLINT inds[4];
     face->getInds(inds, &numInds);
     bool reference = (0 == numInds);
-
-    DOMElement *node;
-    if (!reference) {
-        node = meshDoc_->createElementNS(X(NSStr), X("MeshFace"));
-    }
-    else {
-        node = meshDoc_->createElementNS(X(NSStr), X("MeshFaceReference"));
-    }
+    content.name = reference ? "MeshFaceReference" : "MeshFace";
 
     // Attributes
 
     // Can't put name out becaue the parser will assign it
     // to every face in the MeshFace, which will abort import with
     // face name collisions
-    // node->setAttribute(X("name"), X(face->getName().c_str()));
 
     if (MESH_TOPO_INVALID_REF != face->getAref()) {
-        setUintAtt(face->getAref(), node, "aref");
+        content.atts.push_back(std::make_pair("aref",
+            intString(face->getAref())));
     }
     if (MESH_TOPO_INVALID_REF != face->getID()) {
-        setUintAtt(face->getID(), node, "mid");
+        content.atts.push_back(std::make_pair("mid",
+            intString(face->getID())));
     }
-    setUintAtt(count, node, "count");
+    content.atts.push_back(std::make_pair("count", intString((MLINT)count)));
 
     MLINT faceType = reference ? count : numInds;
     // etype
     bool triFace = 3 == faceType ? true : false;
-    if (triFace) {
-        node->setAttribute(X("etype"), X("Tri3"));
-    }
-    else {
-        node->setAttribute(X("etype"), X("Quad4"));
-    }
+    content.atts.push_back(std::make_pair("etype", triFace ? "Tri3" : "Quad4"));
 
-    // Add text node containing face info
-    DOMText *faceData;
+    // Face info text
     if (!reference && compress_) {
         // Get vector of all the face indices
-        std::vector<int> indices;
+        std::vector<MLINT64> indices;
         indices.reserve(faces.size() * (triFace ? 3 : 4));
         for (auto face : faces) {
             // Indices
             face->getInds(inds, &numInds);
-            indices.push_back((int)inds[0]);
-            indices.push_back((int)inds[1]);
-            indices.push_back((int)inds[2]);
+            indices.push_back(inds[0]);
+            indices.push_back(inds[1]);
+            indices.push_back(inds[2]);
             if (!triFace) {
-                indices.push_back((int)inds[3]);
+                indices.push_back(inds[3]);
             }
         }
-        XMLByte *encodedData{ nullptr };
-        XMLSize_t len;
-        try {
-            len = encodeCData(indices, encodedData);
-        }
-        catch (...) {
-            std::cout << "Face data: Base64 encoding failed.\n";
-            return false;
-        }
-        // Store uncompressed size in count
-        if (0 < len) {
-            node->setAttribute(X("format"), X("base64"));
-            faceData = meshDoc_->createTextNode(X("\n\t"));
-            faceData->appendData(X((char*)encodedData));
-            faceData->appendData(X("\t"));
-            XMLString::release((char**)(&encodedData));
-        }
-        else {
+        int width = packedWidth(indices);
+        std::vector<XMLByte> bytes;
+        appendInts(bytes, indices, width);
+        if (!formatBase64Text(bytes, width, (size_t)-1, numThreads,
+                content)) {
             std::cout << "Failed to compress face data.\n";
             return false;
         }
+        return true;
     }
-    else {
-        // Put all the face indices into a string
-        std::ostringstream os;
-        bool first = true;
-        size_t index = 1;
-        std::vector<const MeshFace *>::const_iterator it = faces.begin();
-        for (; it != faces.end(); ++it, ++index) {
-            face = *it;
-            if (first) {
-                first = false;
+
+    // Put all the face indices into a string
+    std::ostringstream os;
+    bool first = true;
+    size_t index = 1;
+    std::vector<const MeshFace *>::const_iterator it = faces.begin();
+    for (; it != faces.end(); ++it, ++index) {
+        face = *it;
+        if (first) {
+            first = false;
+            os << "\n\t ";
+        }
+        if (!reference) {
+            // Indices
+            face->getInds(inds, &numInds);
+            os << inds[0] << " " << inds[1] << " " << inds[2];
+            if (!triFace) {
+                os << " " << inds[3];
+            }
+            if (index == count) {
+                os << "\n\t";
+            }
+            else {
                 os << "\n\t ";
             }
-            if (!reference) {
-                // Indices
-                face->getInds(inds, &numInds);
-                os << inds[0] << " " << inds[1] << " " << inds[2];
-                if (!triFace) {
-                    os << " " << inds[3];
-                }
-                if (index == count) {
-                    os << "\n\t";
-                }
-                else {
-                    os << "\n\t ";
-                }
+        }
+        else {
+            os << face->getRef();
+            if (index == count) {
+                os << "\n\t";
             }
             else {
-                os << face->getRef();
-                if (index == count) {
-                    os << "\n\t";
-                }
-                else {
-                    os << " ";
-                }
+                os << " ";
             }
         }
-        node->setAttribute(X("format"), X("text"));
-        faceData = meshDoc_->createTextNode(X(os.str().c_str()));
     }
-    delete [] inds;
-    node->appendChild(faceData);
-    sheet->appendChild(node);
+    content.atts.push_back(std::make_pair("format", "text"));
+    content.text = os.str();
     return true;
 }
 
 
+// Prepare the MeshEdge or MeshEdgeReference element of a string. A
+// string without edges has no element and leaves the content name empty
 bool
-MeshLinkWriterXerces::writeMeshEdge(xercesc_3_2::DOMElement *string,
-    MeshTopo *container)
+MeshLinkWriterXerces::formatMeshEdge(MeshTopo *container, size_t numThreads,
+    ElementContent &content)
 {
     MeshString *meshString = dynamic_cast<MeshString*>(container);
     if (nullptr == meshString) {
@@ -562,34 +720,45 @@ MeshLinkWriterXerces::writeMeshEdge(xercesc_3_2::DOMElement *string,
     std::vector<const MeshEdge *> edges;
     meshString->getMeshEdges(edges);
     if (edges.empty()) {
-        return false;
+        // No MeshEdge element
+        return true;
     }
     size_t count = edges.size();
     const MeshEdge *edge = edges[0]; // no bounds checking using []
     MLINT numInds;
-    MLINT *inds = new MLINT[2];
+    MLINT inds[2];
     edge->getInds(inds, &numInds);
     bool reference = (0 == numInds);
-
-    DOMElement *node;
-    if (!reference) {
-        node = meshDoc_->createElementNS(X(NSStr), X("MeshEdge"));
-    }
-    else {
-        node = meshDoc_->createElementNS(X(NSStr), X("MeshEdgeReference"));
-    }
+    content.name = reference ? "MeshEdgeReference" : "MeshEdge";
 
     // Attributes
     if (MESH_TOPO_INVALID_REF != edge->getAref()) {
-        setUintAtt(edge->getAref(), node, "aref");
+        content.atts.push_back(std::make_pair("aref",
+            intString(edge->getAref())));
     }
     if (MESH_TOPO_INVALID_REF != edge->getID()) {
-        setUintAtt(edge->getID(), node, "mid");
+        content.atts.push_back(std::make_pair("mid",
+            intString(edge->getID())));
     }
-    node->setAttribute(X("format"), X("text"));
     // eType
-    node->setAttribute(X("etype"), X("Edge2"));
-    setUintAtt(count, node, "count");
+    content.atts.push_back(std::make_pair("etype", "Edge2"));
+    content.atts.push_back(std::make_pair("count", intString((MLINT)count)));
+    if (!reference && compress_) {
+        // Packed edge indices
+        std::vector<MLINT64> indices;
+        indices.reserve(count * 2);
+        for (auto edge : edges) {
+            edge->getInds(inds, &numInds);
+            indices.push_back(inds[0]);
+            indices.push_back(inds[1]);
+        }
+        int width = packedWidth(indices);
+        std::vector<XMLByte> bytes;
+        appendInts(bytes, indices, width);
+        return formatBase64Text(bytes, width, (size_t)-1, numThreads,
+            content);
+    }
+    content.atts.push_back(std::make_pair("format", "text"));
     std::ostringstream os;
     size_t index = 1;
     for (auto edge : edges) {
@@ -609,56 +778,94 @@ MeshLinkWriterXerces::writeMeshEdge(xercesc_3_2::DOMElement *string,
         }
         ++index;
     }
-    delete [] inds;
-    // Add text node containing edge info
-    DOMText *textNode = meshDoc_->createTextNode(X(os.str().c_str()));
-    node->appendChild(textNode);
-    string->appendChild(node);
+    content.text = os.str();
+    return true;
+}
+
+
+// Write the MeshSheet or MeshString elements of a model. The face or
+// edge content of a round of containers is prepared concurrently, one
+// container per thread at a time, then the elements are built in order.
+// Fails if the content of any container could not be prepared
+bool
+MeshLinkWriterXerces::writeMeshContainers(xercesc_3_2::DOMElement *model,
+    const char *elemName, const std::vector<MeshTopo *> &containers,
+    TopoFormatter formatTopo)
+{
+    size_t roundSize = ThreadPool::getConcurrency() * ContainersPerThread;
+
+    std::vector<ElementContent> contents;
+    for (size_t first = 0; first < containers.size(); first += roundSize) {
+        size_t count = std::min(roundSize, containers.size() - first);
+        contents.clear();
+        contents.resize(count);
+
+        std::atomic<bool> formatted(true);
+        ThreadPool::parallelFor(count, [&](size_t i) {
+            // Compresses on all the threads only when alone in the round
+            if (!(this->*formatTopo)(containers[first + i], 0,
+                    contents[i])) {
+                formatted = false;
+            }
+        });
+        if (!formatted) {
+            return false;
+        }
+
+        for (size_t i = 0; i < count; ++i) {
+            MeshTopo *obj = containers[first + i];
+            DOMElement *node = meshDoc_->createElementNS(X(NSStr), X(elemName));
+            node->setAttribute(X("name"), X(obj->getName().c_str()));
+            if (MESH_TOPO_INVALID_REF != obj->getGref()) {
+                setUintAtt(obj->getGref(), node, "gref");
+            }
+            if (MESH_TOPO_INVALID_REF != obj->getAref()) {
+                setUintAtt(obj->getAref(), node, "aref");
+            }
+            if (MESH_TOPO_INVALID_REF != obj->getID()) {
+                setUintAtt(obj->getID(), node, "mid");
+            }
+            const ParamVertVrefMap &vertMap = obj->getParamVertVrefMap();
+            writeParamVertices(node, vertMap);
+            const ElementContent &content = contents[i];
+            if (!content.name.empty()) {
+                DOMElement *topo = meshDoc_->createElementNS(X(NSStr),
+                    X(content.name.c_str()));
+                setContent(topo, content);
+                node->appendChild(topo);
+            }
+            model->appendChild(node);
+        }
+    }
     return true;
 }
 
 
-#define WriteMeshContainer(ParentNode, MeshObj, MeshTopo)               \
+#define WriteMeshContainer(ParentNode, MeshObj, TopoType)               \
 {                                                                       \
     std::vector<MeshObj *> objs;                                        \
     meshModelRef->get##MeshObj##s(objs);                                \
-    for (auto obj : objs) {                                             \
-        DOMElement *node = meshDoc_->createElementNS(X(NSStr), X(#MeshObj)); \
-        node->setAttribute(X("name"), X(obj->getName().c_str()));       \
-        if (MESH_TOPO_INVALID_REF != obj->getGref()) {                  \
-            setUintAtt(obj->getGref(), node, "gref");                   \
-        }                                                               \
-        if (MESH_TOPO_INVALID_REF != obj->getAref()) {                  \
-            setUintAtt(obj->getAref(), node, "aref");                   \
-        }                                                               \
-        if (MESH_TOPO_INVALID_REF != obj->getID()) {                    \
-            setUintAtt(obj->getID(), node, "mid");                      \
-        }                                                               \
-        const ParamVertVrefMap &vertMap = obj->getParamVertVrefMap();   \
-        writeParamVertices(node, vertMap);                              \
-        write##MeshTopo(node, obj);                                     \
-        ParentNode->appendChild(node);                                  \
+    std::vector<MeshTopo *> containers(objs.begin(), objs.end());       \
+    if (!writeMeshContainers(ParentNode, #MeshObj, containers,          \
+            &MeshLinkWriterXerces::format##TopoType)) {                 \
+        return false;                                                   \
     }                                                                   \
 }
 
 
 bool
-MeshLinkWriterXerces::writeMeshFiles(bool compress)
+MeshLinkWriterXerces::writeMeshFiles()
 {
-    if (compress) {
-        return true;
-    }
-
     // Mesh files
     const std::vector<MeshFile> &meshFiles = meshAssoc_->getMeshFiles();
-    for (auto meshFile : meshFiles) {
+    for (const auto &meshFile : meshFiles) {
         DOMElement *fileElement = meshDoc_->createElementNS(X(NSStr),
             X("MeshFile"));
         fileElement->setAttribute(X("filename"), X(meshFile.getFilename()));
 
         // 1-n MeshModelReferences
         const std::vector<std::string> &modelRefs = meshFile.getModelRefs();
-        for (auto ref : modelRefs) {
+        for (const auto &ref : modelRefs) {
             MeshModel *meshModelRef = meshAssoc_->getMeshModelByRef(ref.c_str());
             DOMElement *model = meshDoc_->createElementNS(X(NSStr),
                 X("MeshModelReference"));
@@ -696,11 +903,100 @@ MeshLinkWriterXerces::writeMeshFiles(bool compress)
 }
 
 
+/****************************************************************************
+* SinkFormatTarget class
+***************************************************************************/
+/**
+* \class SinkFormatTarget
+*
+* \brief Xerces format target passing serialized output to a
+* MeshLinkSinkFunc
+*
+* The serializer writes in small pieces, which are collected into a
+* buffer passed to the sink each time it fills.
+*/
+class SinkFormatTarget : public XMLFormatTarget {
+public:
+    SinkFormatTarget(MeshLinkSinkFunc sink, void *userData) :
+        sink_(sink),
+        userData_(userData)
+    {
+        buffer_.reserve(BufferSize);
+    }
+
+    void writeChars(const XMLByte *const toWrite, const XMLSize_t count,
+        XMLFormatter *const formatter) override
+    {
+        if (buffer_.size() + count > BufferSize) {
+            flush();
+        }
+        if (count > BufferSize) {
+            pass((const char *)toWrite, count);
+        }
+        else {
+            buffer_.insert(buffer_.end(), (const char *)toWrite,
+                (const char *)toWrite + count);
+        }
+    }
+
+    void flush() override
+    {
+        pass(buffer_.data(), buffer_.size());
+        buffer_.clear();
+    }
+
+    /// Whether the sink accepted all of the output
+    bool ok() const
+    {
+        return ok_;
+    }
+
+private:
+    static const size_t BufferSize = 1 << 16;
+
+    void pass(const char *data, size_t len)
+    {
+        if (ok_ && len > 0 && !sink_(data, len, userData_)) {
+            std::cout << "Failed writing MeshLink output." << std::endl;
+            ok_ = false;
+        }
+    }
+
+    MeshLinkSinkFunc sink_;
+    void *userData_;
+    std::vector<char> buffer_;
+    bool ok_ { true };
+};
+
+
 // Write MeshAssociativity to MeshLink file (XML roundtrip)
 bool
 MeshLinkWriterXerces::writeMeshLinkFile(const std::string &fname,
     MeshAssociativity *meshAssociativity, bool compress, bool terminatePlatform)
 {
+    MeshLinkFileOutput output;
+    if (!output.open(fname)) {
+        return false;
+    }
+    bool result = writeMeshLinkSink(meshAssociativity,
+        MeshLinkFileOutput::write, &output, compress, terminatePlatform);
+    if (!output.close(result)) {
+        return false;
+    }
+    std::cout << "Completed writing " << fname << std::endl;
+    return true;
+}
+
+
+// Write MeshAssociativity to an output sink (XML roundtrip)
+bool
+MeshLinkWriterXerces::writeMeshLinkSink(MeshAssociativity *meshAssociativity,
+    MeshLinkSinkFunc sink, void *userData, bool compress,
+    bool terminatePlatform)
+{
+    if (nullptr == sink) {
+        return false;
+    }
     if (nullptr != meshAssociativity) {
         meshAssoc_ = meshAssociativity;
     }
@@ -710,8 +1006,12 @@ MeshLinkWriterXerces::writeMeshLinkFile(const std::string &fname,
     }
     compress_ = compress;
 
-    PlatformGuard guard(terminatePlatform);
-    if (!guard) {
+    if (!terminatePlatform) {
+        // Leave the platform initialized after this file is written
+        XercesPlatformSession::holdForProcess();
+    }
+    XercesPlatformSession session;
+    if (!session) {
         return false;
     }
     bool result = true;
@@ -724,7 +1024,7 @@ MeshLinkWriterXerces::writeMeshLinkFile(const std::string &fname,
         return false;
     }
 
-    meshDoc_ = impl->createDocument(X("https://pointwise.com"),
+    meshDoc_ = impl->createDocument(X(NSStr),
         X("MeshLink"), nullptr);
     if (nullptr == meshDoc_) {
         std::cout << "Failed to create DOM document." << std::endl;
@@ -757,36 +1057,43 @@ MeshLinkWriterXerces::writeMeshLinkFile(const std::string &fname,
     // Attribute and AttributeGroup elements
     if (!writeRootAttributes()) {
         std::cout << "Failed to write Mesh Link root attributes." << std::endl;
-        return false;
+        result = false;
     }
 
-    if (!writeGeometryRefs()) {
+    if (result && !writeGeometryRefs()) {
         std::cout << "Failed to write Geometry references." << std::endl;
-        return false;
+        result = false;
     }
 
     // Write MeshFiles - multiple ModelReferences each containing
     // multiple MeshSheets, each containing multiple ParamVertices
-    // (points) and one MeshFaceArray - which can be compressed in a
-    // CDATA section if called with 'true'
-    if (!writeMeshFiles(false)) {
+    // (points) and one MeshFaceArray. When compressing, the arrays are
+    // packed, block compressed and base64 encoded
+    if (result && !writeMeshFiles()) {
         std::cout << "Failed to write Mesh Files." << std::endl;
-        return false;
+        result = false;
     }
 
     // Transform and MeshElementLinkage elements
-    if (!writePeriodicInfo()) {
+    if (result && !writePeriodicInfo()) {
         std::cout << "Failed to write Mesh Link transform and linkage info." << std::endl;
+        result = false;
+    }
+
+    if (!result) {
+        // The platform may stay initialized, so release what was built
+        meshDoc_->release();
+        meshDoc_ = nullptr;
         return false;
     }
 
 
-    // Set up raw buffer, output stream objects
-    MemBufFormatTarget *buffer = new MemBufFormatTarget();
+    // Serialize straight to the sink, without a copy of the document
+    SinkFormatTarget target(sink, userData);
     DOMLSOutput *stream = impl->createLSOutput();
 
     // Set encoding
-    stream->setByteStream(buffer);
+    stream->setByteStream(&target);
     stream->setEncoding(XMLUni::fgUTF8EncodingString);
 
     // Create serializer and output (serialize) the root DOM node...
@@ -794,14 +1101,19 @@ MeshLinkWriterXerces::writeMeshLinkFile(const std::string &fname,
     writer->setNewLine(X("\n"));
     DOMConfiguration *config = writer->getDomConfig();
     config->setParameter(XMLUni::fgDOMWRTFormatPrettyPrint, true);
-    writer->write(meshDoc_, stream);
+    if (!writer->write(meshDoc_, stream)) {
+        std::cout << "Failed to serialize DOM document." << std::endl;
+        result = false;
+    }
+    target.flush();
+    if (!target.ok()) {
+        result = false;
+    }
 
-    // Get char* array containing serialized document and write to file
-    std::string xmlOutput  = (char*)(buffer->getRawBuffer());
-    std::ofstream outFile(fname);
-    outFile << xmlOutput;
-    outFile.close();
-    std::cout << "Completed writing " << fname << std::endl;
+    writer->release();
+    stream->release();
+    meshDoc_->release();
+    meshDoc_ = nullptr;
 
     return result;
 }
@@ -13,9 +13,11 @@
 
 #include "Types.h"
 #include "MeshLinkWriter.h"
+#include "MeshLinkCompression.h"
 
 #include <map>
 #include <string>
+#include <utility>
 #include <vector>
 
 
@@ -58,10 +60,22 @@ public:
     {
     }
 
+    /// \brief Write MeshAssociativity data to a MeshLink XML file
+    ///
+    /// Files whose names end in ".gz" are written gzip-compressed (see
+    /// MeshLinkFileOutput).
     bool writeMeshLinkFile(const std::string &fname,
         MeshAssociativity *meshAssociativity, bool compress=true,
         bool terminatePlatform=true) override;
 
+    /// \brief Write MeshAssociativity data to an output sink
+    ///
+    /// The document is serialized straight to the sink; it is not
+    /// held in memory as text.
+    bool writeMeshLinkSink(MeshAssociativity *meshAssociativity,
+        MeshLinkSinkFunc sink, void *userData, bool compress=true,
+        bool terminatePlatform=true) override;
+
     // Need to provide these if using the default constructor (C API
     // call), otherwise XML file will not validate
     bool setMeshLinkAttributes(const std::string &xmlns,
@@ -73,20 +87,59 @@ public:
         return true;
     }
 
+    /// \brief Set the codec compressing packed binary arrays
+    ///
+    /// Used when writing with compress true. Defaults to the best codec
+    /// available; CodecNone writes uncompressed base64 arrays.
+    /// \return false if the codec is not available in this build
+    bool setCompressionCodec(MeshLinkCompression::Codec codec)
+    {
+        if (!MeshLinkCompression::isAvailable(codec)) {
+            return false;
+        }
+        codec_ = codec;
+        return true;
+    }
+
 private:
+    // Attributes and text of an element, prepared without the DOM so
+    // that the content of many elements can be prepared concurrently
+    struct ElementContent {
+        std::string name;   // element name, empty if there is none
+        std::vector<std::pair<std::string, std::string> > atts;
+        std::string text;
+    };
+    typedef bool (MeshLinkWriterXerces::*TopoFormatter)(MeshTopo *container,
+        size_t numThreads, ElementContent &content);
+
     bool writeRootAttributes();
     bool writePeriodicInfo();
     bool writeGeometryRefs();
-    bool writeMeshFiles(bool compress);
+    bool writeMeshFiles();
 
     bool writeParamVertices(xercesc_3_2::DOMElement *node,
              const ParamVertVrefMap &vertMap);
-    bool writeMeshFace(xercesc_3_2::DOMElement *sheet, MeshTopo *container);
-    bool writeMeshEdge(xercesc_3_2::DOMElement *string, MeshTopo *container);
+    bool writeParamVertexArray(xercesc_3_2::DOMElement *node,
+             const ParamVertVrefMap &vertMap);
+    bool appendBase64Text(xercesc_3_2::DOMElement *node,
+        const std::vector<unsigned char> &bytes, int width,
+        size_t realOffset = (size_t)-1);
+    bool formatBase64Text(const std::vector<unsigned char> &bytes, int width,
+        size_t realOffset, size_t numThreads, ElementContent &content);
+    void setContent(xercesc_3_2::DOMElement *node,
+        const ElementContent &content);
+    bool formatMeshFace(MeshTopo *container, size_t numThreads,
+        ElementContent &content);
+    bool formatMeshEdge(MeshTopo *container, size_t numThreads,
+        ElementContent &content);
+    bool writeMeshContainers(xercesc_3_2::DOMElement *model,
+        const char *elemName, const std::vector<MeshTopo *> &containers,
+        TopoFormatter formatTopo);
     bool writeMeshPointReferences(xercesc_3_2::DOMElement *model,
         MeshModel *meshModel);
 
     bool compress_ { false };
+    MeshLinkCompression::Codec codec_ { MeshLinkCompression::getDefaultCodec() };
     MeshAssociativity *meshAssoc_ { nullptr };
     xercesc_3_2::DOMDocument *meshDoc_;
     xercesc_3_2::DOMElement *meshLinkRoot_;
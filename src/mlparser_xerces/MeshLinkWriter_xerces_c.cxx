@@ -10,6 +10,7 @@
 
 #include "MeshAssociativity.h"
 
+#include "MeshLinkStreamWriter.h"
 #include "MeshLinkWriter_xerces.h"
 #include "MeshLinkWriter_xerces_c.h"
 
@@ -35,6 +36,28 @@ ML_freeMeshLinkWriterXercesObj(MeshLinkWriterObj *writerObj)
     }
 }
 
+int
+ML_createMeshLinkStreamWriterObj(MeshLinkWriterObj *writerObj)
+{
+    if (writerObj) {
+        *writerObj = (MeshLinkWriterObj) new MeshLinkStreamWriter;
+        if (*writerObj) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+void
+ML_freeMeshLinkStreamWriterObj(MeshLinkWriterObj *writerObj)
+{
+    MeshLinkStreamWriter *writer = (MeshLinkStreamWriter *)*writerObj;
+    if (writer) {
+        delete writer;
+        *writerObj = NULL;
+    }
+}
+
 /****************************************************************************
  *
  * This file is licensed under the Cadence Public License Version 1.0 (the
@@ -22,6 +22,14 @@ int  ML_createMeshLinkWriterXercesObj(MeshLinkWriterObj *writerObj);
 ML_EXTERN ML_STORAGE_CLASS
 void   ML_freeMeshLinkWriterXercesObj(MeshLinkWriterObj *writerObj);
 
+/* Allocate a new MeshLinkStreamWriterObj, writing XML without a DOM */
+ML_EXTERN ML_STORAGE_CLASS
+int  ML_createMeshLinkStreamWriterObj(MeshLinkWriterObj *writerObj);
+
+/* Free MeshLinkStreamWriterObj memory */
+ML_EXTERN ML_STORAGE_CLASS
+void   ML_freeMeshLinkStreamWriterObj(MeshLinkWriterObj *writerObj);
+
 
 
 #endif
@@ -41,6 +41,22 @@
         END subroutine ML_freeMeshLinkWriterXercesObj
 
 
+! Allocate a new MeshLinkStreamWriterObj
+        INTEGER(C_INT) FUNCTION ML_createMeshLinkStreamWriterObj(writerObj) bind(C, name="ML_createMeshLinkStreamWriterObj")
+          use, intrinsic :: iso_c_binding
+          implicit none
+          TYPE(C_PTR), INTENT(OUT) :: writerObj
+        ENDFUNCTION ML_createMeshLinkStreamWriterObj
+
+
+! Free MeshLinkStreamWriterObj memory
+        subroutine ML_freeMeshLinkStreamWriterObj(writerObj) bind(C, name="ML_freeMeshLinkStreamWriterObj")
+          use, intrinsic :: iso_c_binding
+          implicit none
+          TYPE(C_PTR), INTENT(OUT) :: writerObj
+        END subroutine ML_freeMeshLinkStreamWriterObj
+
+
       end interface
     end module
 
@@ -0,0 +1,87 @@
+/****************************************************************************
+ *
+ * (C) 2021 Cadence Design Systems, Inc. All rights reserved worldwide.
+ *
+ * This sample source code is not supported by Cadence Design Systems, Inc.
+ * It is provided freely for demonstration purposes only.
+ * SEE THE WARRANTY DISCLAIMER AT THE BOTTOM OF THIS FILE.
+ *
+ ***************************************************************************/
+
+#include "XercesPlatformSession.h"
+
+#include <iostream>
+#include <mutex>
+
+#include <xercesc/util/PlatformUtils.hpp>
+#include <xercesc/util/XMLException.hpp>
+
+using namespace xercesc;
+
+// Xerces platform initialization is reference counted but not thread
+// safe. Count the sessions here so that Initialize and Terminate are only
+// called on the first and last session, serialized by the mutex.
+static std::mutex sessionMutex;
+static int sessionCount = 0;
+
+// Session held by holdForProcess
+static XercesPlatformSession *processSession = nullptr;
+
+
+XercesPlatformSession::XercesPlatformSession() :
+    init_(false)
+{
+    std::lock_guard<std::mutex> lock(sessionMutex);
+    if (0 == sessionCount) {
+        try {
+            XMLPlatformUtils::Initialize();
+            std::cout << "Successfully initialized xerces API." << std::endl;
+        }
+        catch (const XMLException &) {
+            std::cout << "Failed to initialize xerces API." << std::endl;
+            return;
+        }
+    }
+    ++sessionCount;
+    init_ = true;
+}
+
+
+XercesPlatformSession::~XercesPlatformSession()
+{
+    if (!init_) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(sessionMutex);
+    if (0 == --sessionCount) {
+        try {
+            XMLPlatformUtils::Terminate();
+            std::cout << "Successfully terminated xerces API." << std::endl;
+        }
+        catch (const XMLException &) {
+            std::cout << "Failed to terminate xerces API." << std::endl;
+        }
+    }
+}
+
+
+void
+XercesPlatformSession::holdForProcess()
+{
+    // Never released
+    static std::once_flag once;
+    std::call_once(once, []() {
+        processSession = new XercesPlatformSession();
+    });
+}
+
+/****************************************************************************
+ *
+ * This file is licensed under the Cadence Public License Version 1.0 (the
+ * "License"), a copy of which is found in the included file named "LICENSE",
+ * and is distributed "AS IS." TO THE MAXIMUM EXTENT PERMITTED BY APPLICABLE
+ * LAW, CADENCE DISCLAIMS ALL WARRANTIES AND IN NO EVENT SHALL BE LIABLE TO
+ * ANY PARTY FOR ANY DAMAGES ARISING OUT OF OR RELATING TO USE OF THIS FILE.
+ * Please see the License for the full text of applicable terms.
+ *
+ ****************************************************************************/
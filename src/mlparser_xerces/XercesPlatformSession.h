@@ -0,0 +1,74 @@
+/****************************************************************************
+ *
+ * (C) 2021 Cadence Design Systems, Inc. All rights reserved worldwide.
+ *
+ * This sample source code is not supported by Cadence Design Systems, Inc.
+ * It is provided freely for demonstration purposes only.
+ * SEE THE WARRANTY DISCLAIMER AT THE BOTTOM OF THIS FILE.
+ *
+ ***************************************************************************/
+
+#ifndef XERCES_PLATFORM_SESSION
+#define XERCES_PLATFORM_SESSION
+
+
+/****************************************************************************
+ * XercesPlatformSession class
+ ***************************************************************************/
+/**
+ * \class XercesPlatformSession
+ *
+ * \brief Holds the Xerces platform initialized for the lifetime of the
+ * object.
+ *
+ * Sessions are counted process-wide: the platform is initialized when the
+ * first session is created and terminated when the last one is destroyed.
+ * The MeshLinkParserXerces and MeshLinkWriterXerces open a session for
+ * each file they read or write, so an application that processes many
+ * files can hold a session of its own to initialize the platform only
+ * once. Sessions may be created and destroyed from any thread, and
+ * holding one keeps the platform stable while files are read or written
+ * concurrently.
+ *
+ * All Xerces objects must be destroyed before the last session.
+ */
+class XercesPlatformSession {
+public:
+    /// \brief Open a session, initializing the platform if needed
+    XercesPlatformSession();
+    /// \brief Close the session, terminating the platform if it was the
+    ///     last one
+    ~XercesPlatformSession();
+
+    /// \brief Whether the platform was successfully initialized
+    bool isInitialized() const {
+        return init_;
+    }
+
+    /// \brief Whether the platform was successfully initialized
+    explicit operator bool() const {
+        return init_;
+    }
+
+    /// \brief Keep the platform initialized for the rest of the process
+    static void holdForProcess();
+
+private:
+    XercesPlatformSession(const XercesPlatformSession &) = delete;
+    XercesPlatformSession &operator=(const XercesPlatformSession &) = delete;
+
+    bool init_;
+};
+
+#endif // XERCES_PLATFORM_SESSION
+
+/****************************************************************************
+ *
+ * This file is licensed under the Cadence Public License Version 1.0 (the
+ * "License"), a copy of which is found in the included file named "LICENSE",
+ * and is distributed "AS IS." TO THE MAXIMUM EXTENT PERMITTED BY APPLICABLE
+ * LAW, CADENCE DISCLAIMS ALL WARRANTIES AND IN NO EVENT SHALL BE LIABLE TO
+ * ANY PARTY FOR ANY DAMAGES ARISING OUT OF OR RELATING TO USE OF THIS FILE.
+ * Please see the License for the full text of applicable terms.
+ *
+ ****************************************************************************/
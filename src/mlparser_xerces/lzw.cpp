@@ -8,6 +8,9 @@
  *
  ***************************************************************************/
 
+// Errors on corrupt input must not abort the application. The codec
+// routines stop and the caller detects the short output.
+#define LZW_ERROR(message) ((void)(message))
 #define LZW_IMPLEMENTATION
 #include "lzw.hpp"
 
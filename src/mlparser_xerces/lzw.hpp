@@ -176,6 +176,7 @@ constexpr int MaxDictBits    = 12;
 constexpr int StartBits      = 9;
 constexpr int FirstCode      = (1 << (StartBits - 1)); // 256
 constexpr int MaxDictEntries = (1 << MaxDictBits);     // 4096
+constexpr int HashTableSize  = (MaxDictEntries * 2);   // Power of two.
 
 class Dictionary final
 {
@@ -191,10 +192,17 @@ public:
     int size;
     Entry entries[MaxDictEntries];
 
+    // Open addressing index of the entries past the byte range, keyed
+    // by (code, value). Holds entry index + 1, or 0 for an empty slot.
+    std::uint16_t hashTable[HashTableSize];
+
     Dictionary();
     int findIndex(int code, int value) const;
     bool add(int code, int value);
     bool flush(int & codeBitsWidth);
+
+private:
+    static int hashSlot(int code, int value);
 };
 
 // ========================================================
@@ -528,6 +536,13 @@ Dictionary::Dictionary()
         entries[i].code  = Nil;
         entries[i].value = i;
     }
+    std::memset(hashTable, 0, sizeof(hashTable));
+}
+
+int Dictionary::hashSlot(const int code, const int value)
+{
+    const std::uint32_t key = (static_cast<std::uint32_t>(code) << 8) | static_cast<std::uint32_t>(value);
+    return static_cast<int>((key * 2654435761u) >> 19) & (HashTableSize - 1);
 }
 
 int Dictionary::findIndex(const int code, const int value) const
@@ -537,10 +552,11 @@ int Dictionary::findIndex(const int code, const int value) const
         return value;
     }
 
-    // Linear search for now.
-    // TODO: Worth optimizing with a proper hash-table?
-    for (int i = 0; i < size; ++i)
+    // Entries past the byte range are found through the hash table.
+    for (int slot = hashSlot(code, value); hashTable[slot] != 0;
+         slot = (slot + 1) & (HashTableSize - 1))
     {
+        const int i = hashTable[slot] - 1;
         if (entries[i].code == code && entries[i].value == value)
         {
             return i;
@@ -560,6 +576,14 @@ bool Dictionary::add(const int code, const int value)
 
     entries[size].code  = code;
     entries[size].value = value;
+
+    int slot = hashSlot(code, value);
+    while (hashTable[slot] != 0)
+    {
+        slot = (slot + 1) & (HashTableSize - 1);
+    }
+    hashTable[slot] = static_cast<std::uint16_t>(size + 1);
+
     ++size;
     return true;
 }
@@ -574,6 +598,7 @@ bool Dictionary::flush(int & codeBitsWidth)
             // Clear the dictionary (except the first 256 byte entries).
             codeBitsWidth = StartBits;
             size = FirstCode;
+            std::memset(hashTable, 0, sizeof(hashTable));
             return true;
         }
     }
@@ -725,6 +750,14 @@ int easyDecode(const std::uint8_t * compressed, const int compressedSizeBytes, c
         assert(codeBitsWidth <= MaxDictBits);
         code = static_cast<int>(bitStream.readBitsU64(codeBitsWidth));
 
+        // Reject codes the encoder cannot have produced, so corrupt
+        // input stops decoding instead of reading past the dictionary.
+        if ((prevCode == Nil && code >= FirstCode) || code > dictionary.size)
+        {
+            LZW_ERROR("lzw::easyDecode(): Invalid code in stream!");
+            break;
+        }
+
         if (prevCode == Nil)
         {
             if (!outputByte(code, uncompressed,
@@ -226,6 +226,27 @@ if dist > tol:
 	die('Bad point projection', dist,' > ', tol)
 
 
+# Project the edge end points and midpoint as a batch, each result
+# matching the single point projection
+batchPoints = [ edgePoints[0], edgePoints[1], midPoint ]
+batchInfo = ProjectPointsToMeshTopoGeometry( meshAssoc, geomKernel, meshEdge,
+	[ x for pt in batchPoints for x in pt ] )
+if not batchInfo['success']:
+	die('Batch point projection failed')
+for i, pt in enumerate(batchPoints):
+	if not batchInfo['pointSuccess'][i]:
+		die('Batch point projection failed for point', i)
+	projectInfo = ProjectPointToMeshTopoGeometry( meshAssoc, geomKernel, meshEdge, pt )
+	dist = PointToPointDistance( projectInfo['XYZ'], batchInfo['XYZ'][3*i:3*i+3] )
+	if dist > tol:
+		die('Bad batch point projection', dist,' > ', tol)
+	for n in range(2):
+		if abs(projectInfo['UV'][n] - batchInfo['UV'][2*i+n]) > tol:
+			die('Bad batch projection UV', batchInfo['UV'][2*i+n],' != ', projectInfo['UV'][n])
+	if projectInfo['hitEntityName'] != batchInfo['hitEntityName'][i]:
+		die('Bad batch projection entity', batchInfo['hitEntityName'][i],' != ', projectInfo['hitEntityName'])
+
+
 # clean up
 DeleteGeode( geomKernelObj )
 DeleteMeshAssocObject(meshAssocObj)    